@@ -38,6 +38,7 @@
  * - LV_STDLIB_CLIB:        Standard C functions, like malloc, strlen, etc
  * - LV_STDLIB_MICROPYTHON: MicroPython implementation
  * - LV_STDLIB_RTTHREAD:    RT-Thread implementation
+ * - LV_STDLIB_POOL:        Size class pools with per-thread caches on top of the C library's malloc
  * - LV_STDLIB_CUSTOM:      Implement the functions externally
  */
 #define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
@@ -83,6 +84,16 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL
+    /** Size of the slabs taken from the C library and split into blocks of one size class.
+     *  Larger allocations (e.g. draw buffers) are passed to the C library directly. */
+    #define LV_MEM_SLAB_SIZE (16 * 1024U)     /**< [bytes] */
+
+    /** Number of free blocks per size class cached by each thread to allocate and free without locking.
+     *  Used only if `LV_USE_OS` is `LV_OS_PTHREAD` or `LV_OS_WINDOWS`. 0: disable the per-thread caches. */
+    #define LV_MEM_MAGAZINE_SIZE 32
+#endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL*/
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -151,6 +162,11 @@
  * Set it to 0 to have no limit. */
 #define LV_DRAW_LAYER_MAX_MEMORY 0  /**< No limit by default [bytes]*/
 
+/** Keep the buffers of the finished layers up to this size to reuse them for new layers
+ *  with the same width, height, stride and color format, instead of freeing and allocating them in every frame.
+ *  The least recently used buffers are freed first. 0: disable */
+#define LV_DRAW_LAYER_BUF_POOL_SIZE 0  /**< [bytes]*/
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -208,9 +224,12 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /** Allow buffering some shadow calculation.
          *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
+         *  `shadow_width + radius`.  Caching a shadow has `2 * shadow_size^2` RAM cost. */
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+        /** Maximum RAM used by the buffered shadows in bytes. The least recently used shadows are freed first. */
+        #define LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY (32 * 1024)
+
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
@@ -227,6 +246,11 @@
     /** Enable drawing complex gradients in software: linear at an angle, radial or conical */
     #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
 
+    /** Keep the color and opacity maps of the gradients to reuse them in the next frames.
+     *  The maximum total size of the kept maps in bytes. The least recently used ones are freed first.
+     *  0: disable */
+    #define LV_DRAW_SW_GRADIENT_CACHE_SIZE      0
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -529,10 +553,29 @@
  *  released immediately after use. */
 #define LV_CACHE_DEF_SIZE       0
 
+/** Split the image cache into this many independently locked parts to let the draw threads
+ *  use it at the same time. Each part can hold `LV_CACHE_DEF_SIZE / LV_IMAGE_CACHE_SHARD_CNT` bytes.
+ *  0 or 1: use a single part. */
+#define LV_IMAGE_CACHE_SHARD_CNT 0
+
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** 1: Decode the images missing from the image cache in a background thread instead of the rendering.
+ *  The images are not drawn until they are decoded, then their widgets are invalidated.
+ *  Requires `LV_USE_OS` and `LV_CACHE_DEF_SIZE > 0`. */
+#define LV_IMAGE_DECODER_ASYNC  0
+
+/** 1: Store the decoded images of image files and variables in a directory set by `lv_image_disk_cache_set_path()`
+ *  and load them from there (e.g. after a reboot) instead of decoding them again.
+ *  Requires `LV_CACHE_DEF_SIZE > 0`. */
+#define LV_USE_IMAGE_DISK_CACHE 0
+#if LV_USE_IMAGE_DISK_CACHE
+    /** Maximum total size of the stored images [bytes] */
+    #define LV_IMAGE_DISK_CACHE_MAX_SIZE (16 * 1024 * 1024)
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -548,6 +591,32 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Keep a small per-object table of resolved style property values (keyed by part, state and property)
+ *  so repeated getters during drawing are O(1). Costs ~400 bytes per drawn widget.
+ *  The table is invalidated when the widget's (or an ancestor's) styles or state change. */
+#define LV_OBJ_STYLE_PROP_CACHE 0
+
+/** Share the local styles of widgets which have the same local properties with the same values,
+ *  instead of allocating a private style for each widget. */
+#define LV_OBJ_LOCAL_STYLE_INTERN 0
+
+/** Max. memory for the bitmaps of the widgets having `LV_OBJ_FLAG_CACHE_LAYER`.
+ *  Such widgets are rendered with their children once and the bitmap is reused until
+ *  something changes in the subtree. The least recently used bitmaps are freed first.
+ *  0: disable, the flag is ignored */
+#define LV_OBJ_CACHE_LAYER_MAX_MEMORY 0  /**< [bytes]*/
+
+/** Don't draw the widgets (or parts of them) which are covered by their opaque younger siblings.
+ *  The skipped widgets don't get draw events either.
+ *  See `lv_display_get_occlusion_stats()` for the culled pixels. */
+#define LV_REFR_OCCLUSION_CULLING 0
+
+/** In `LV_DISPLAY_RENDER_MODE_DIRECT` move the pixels of a scrolled widget in the draw buffer
+ *  and redraw only the newly exposed areas instead of the whole widget.
+ *  Used only for widgets with a plain opaque background and no custom drawing.
+ *  See `lv_display_get_sync_stats()` for the moved bytes. */
+#define LV_REFR_SCROLL_BLIT 0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -879,6 +948,10 @@
 /** A layout similar to Grid in CSS. */
 #define LV_USE_GRID 1
 
+/** 1: Cache the measured size of the children and the result of each track of flex and grid containers.
+ *  If only the size of some children changed, only the affected tracks are recalculated. */
+#define LV_LAYOUT_INCREMENTAL 0
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -104,6 +104,7 @@ extern "C" {
 
 #include "src/tick/lv_tick_private.h"
 #include "src/stdlib/builtin/lv_tlsf_private.h"
+#include "src/stdlib/pool/lv_mem_pool_private.h"
 #include "src/libs/rlottie/lv_rlottie_private.h"
 #include "src/libs/ffmpeg/lv_ffmpeg_private.h"
 #include "src/widgets/lottie/lv_lottie_private.h"
@@ -102,6 +102,7 @@ class CompressMethod(Enum):
     NONE = 0x00
     RLE = 0x01
     LZ4 = 0x02
+    LZ4_TILED = 0x03
 
 
 class ColorFormat(Enum):
@@ -352,6 +353,8 @@ def write_c_array_file(
     flags = "0"
     if compress is not CompressMethod.NONE:
         flags += " | LV_IMAGE_FLAGS_COMPRESSED"
+    if compress is CompressMethod.LZ4_TILED:
+        flags += " | LV_IMAGE_FLAGS_TILED"
     if premultiplied:
         flags += " | LV_IMAGE_FLAGS_PREMULTIPLIED"
 
@@ -495,9 +498,18 @@ class LVGLCompressData:
     def __init__(self,
                  cf: ColorFormat,
                  method: CompressMethod,
-                 raw_data: bytes = b''):
+                 raw_data: bytes = b'',
+                 w: int = 0,
+                 h: int = 0,
+                 stride: int = 0,
+                 tile_size: int = 64):
+        self.cf = cf
         self.blk_size = (cf.bpp + 7) // 8
         self.compress = method
+        self.w = w
+        self.h = h
+        self.stride = stride
+        self.tile_size = tile_size
         self.raw_data = raw_data
         self.raw_data_len = len(raw_data)
         self.compressed = self._compress(raw_data)
@@ -514,6 +526,8 @@ class LVGLCompressData:
             compressed = RLEImage().rle_compress(raw_data + pad, self.blk_size)
         elif self.compress == CompressMethod.LZ4:
             compressed = lz4.block.compress(raw_data, store_size=False)
+        elif self.compress == CompressMethod.LZ4_TILED:
+            compressed = self._compress_tiles(raw_data)
         else:
             raise ParameterError(f"Invalid compress method: {self.compress}")
 
@@ -526,6 +540,46 @@ class LVGLCompressData:
         bin += compressed
         return bin
 
+    def _compress_tiles(self, raw_data: bytes) -> bytearray:
+        """
+        Compress the image in independent tiles, so the decoder can decompress
+        only the tiles of the drawn area. The tile rows are stored without padding.
+        Layout: 16bits tile width, 16bits tile height, 32bits offset of each tile
+        relative to the first tile and the end offset of the last tile, then the
+        LZ4 compressed tiles row by row.
+        """
+        if self.cf not in (ColorFormat.ARGB8888, ColorFormat.XRGB8888,
+                           ColorFormat.RGB888, ColorFormat.RGB565,
+                           ColorFormat.RGB565_SWAPPED, ColorFormat.ARGB8565,
+                           ColorFormat.A8):
+            raise ParameterError(f"Tiled compression is not supported for {self.cf.name}")
+        if self.w == 0 or self.h == 0 or self.stride == 0:
+            raise ParameterError("Tiled compression needs the image size")
+        if not 0 < self.tile_size <= 0xffff:
+            raise ParameterError(f"Invalid tile size: {self.tile_size}")
+
+        tile = self.tile_size
+        tiles = []
+        for y in range(0, self.h, tile):
+            for x in range(0, self.w, tile):
+                start = x * self.blk_size
+                end = min(x + tile, self.w) * self.blk_size
+                rows = b''.join(raw_data[row * self.stride + start:row * self.stride + end]
+                                for row in range(y, min(y + tile, self.h)))
+                tiles.append(lz4.block.compress(rows, store_size=False))
+
+        bin = bytearray()
+        bin += uint16_t(tile)
+        bin += uint16_t(tile)
+        offset = 0
+        for t in tiles:
+            bin += uint32_t(offset)
+            offset += len(t)
+        bin += uint32_t(offset)
+        for t in tiles:
+            bin += t
+        return bin
+
 
 class LVGLImage:
 
@@ -797,6 +851,7 @@ class LVGLImage:
             bin = bytearray()
             flags = 0
             flags |= 0x08 if compress != CompressMethod.NONE else 0
+            flags |= 0x80 if compress == CompressMethod.LZ4_TILED else 0
             flags |= 0x01 if self.premultiplied else 0
 
             header = LVGLImageHeader(self.cf,
@@ -805,7 +860,8 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
+            compressed = LVGLCompressData(self.cf, compress, self.data,
+                                          self.w, self.h, self.stride)
             bin += compressed.compressed
 
             f.write(bin)
@@ -820,7 +876,8 @@ class LVGLImage:
         self._check_dir(filename)
 
         if compress != CompressMethod.NONE:
-            data = LVGLCompressData(self.cf, compress, self.data).compressed
+            data = LVGLCompressData(self.cf, compress, self.data,
+                                    self.w, self.h, self.stride).compressed
         else:
             data = self.data
         write_c_array_file(self.w, self.h, self.stride, self.cf, filename, outputname,
@@ -1448,7 +1505,7 @@ def main():
     parser.add_argument('--compress',
                         help=("Binary data compress method, default to NONE"),
                         default="NONE",
-                        choices=["NONE", "RLE", "LZ4"])
+                        choices=["NONE", "RLE", "LZ4", "LZ4_TILED"])
 
     parser.add_argument('--align',
                         help="stride alignment in bytes for bin image",
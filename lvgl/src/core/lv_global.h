@@ -23,6 +23,7 @@ extern "C" {
 #include "../misc/lv_anim.h"
 #include "../misc/lv_area.h"
 #include "../misc/lv_color_op.h"
+#include "../misc/lv_event.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_style.h"
@@ -37,6 +38,7 @@ extern "C" {
 
 #include "../tick/lv_tick.h"
 #include "../layouts/lv_layout.h"
+#include "lv_refr.h"
 
 #include "../misc/lv_types.h"
 
@@ -45,9 +47,11 @@ extern "C" {
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
 #include "../draw/lv_draw_private.h"
+#include "../draw/lv_image_decoder_private.h"
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../stdlib/builtin/lv_tlsf_private.h"
+#include "../stdlib/pool/lv_mem_pool_private.h"
 #include "../debugging/sysmon/lv_sysmon_private.h"
 #include "../debugging/test/lv_test_private.h"
 #include "../layouts/lv_layout_private.h"
@@ -98,6 +102,13 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_PROP_CACHE
+    uint32_t style_prop_cache_gen;
+#endif
+#if LV_OBJ_LOCAL_STYLE_INTERN
+    lv_style_intern_entry_t ** style_intern_buckets;
+    uint32_t style_intern_cnt;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -109,12 +120,29 @@ typedef struct _lv_global_t {
     uint32_t layout_count;
     lv_layout_dsc_t * layout_list;
     bool layout_update_mutex;
+#if LV_LAYOUT_INCREMENTAL
+    lv_layout_cache_t ** layout_cache;      /**< Sorted by the address of the containers*/
+    uint32_t layout_cache_cnt;
+    uint32_t layout_cache_capacity;
+    uint32_t layout_cache_gen;
+    lv_layout_stats_t layout_stats;
+#endif
 
     uint32_t memory_zero;
     uint32_t math_rand_seed;
 
     lv_event_t * event_header;
     uint32_t event_last_register_id;
+    lv_event_stats_t event_stats;
+
+#if LV_USE_OBSERVER
+    lv_subject_t ** subject_pending;
+    uint32_t subject_pending_cnt;
+    uint32_t subject_pending_capacity;
+    uint32_t subject_batch_depth;
+    bool subject_notify_running;
+    lv_timer_t * subject_notify_timer;
+#endif
 
     lv_timer_state_t timer_state;
     lv_anim_state_t anim_state;
@@ -124,6 +152,16 @@ typedef struct _lv_global_t {
     lv_draw_buf_handlers_t font_draw_buf_handlers;
     lv_draw_buf_handlers_t image_cache_draw_buf_handlers;  /**< Ensure that all assigned draw buffers
                                                             * can be managed by image cache. */
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    lv_ll_t draw_buf_pool_ll;
+    lv_draw_buf_pool_stats_t draw_buf_pool_stats;
+#endif
+
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    lv_ll_t cache_layer_ll;
+    lv_refr_cache_layer_stats_t cache_layer_stats;
+    uint32_t cache_layer_frame_id;
+#endif
 
     lv_ll_t img_decoder_ll;
 #if LV_USE_OS != LV_OS_NONE
@@ -133,15 +171,26 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_t img_decoder_async;
+#endif
+#if LV_USE_IMAGE_DISK_CACHE
+    lv_image_disk_cache_t img_disk_cache;
+#endif
 
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    lv_draw_sw_shadow_cache_t sw_shadow_cache;
+    lv_cache_t * sw_shadow_cache;
 #endif
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if LV_USE_DRAW_SW && LV_DRAW_SW_GRADIENT_CACHE_SIZE
+    lv_cache_t * sw_grad_cache;
+    uint32_t sw_grad_cache_hit_cnt;
+    uint32_t sw_grad_cache_miss_cnt;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
@@ -165,9 +214,12 @@ typedef struct _lv_global_t {
 
 #if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
     lv_tlsf_state_t tlsf_state;
+#elif LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL
+    lv_mem_pool_state_t mem_pool_state;
 #endif
 
     lv_ll_t fsdrv_ll;
+    lv_ll_t fs_mmap_ll;
 #if LV_USE_FS_STDIO != '\0'
     lv_fs_drv_t stdio_fs_drv;
 #endif
@@ -14,7 +14,7 @@
 #include "lv_obj_class_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
-#include "lv_refr.h"
+#include "lv_refr_private.h"
 #include "lv_group.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -27,6 +27,7 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
 #include "lv_obj_draw_private.h"
+#include "../layouts/lv_layout_private.h"
 
 /*********************
  *      DEFINES
@@ -315,6 +316,7 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
     }
 
+    if(f & LV_OBJ_FLAG_CACHE_LAYER) lv_refr_cache_layer_drop(obj);
 }
 
 void lv_obj_set_flag(lv_obj_t * obj, lv_obj_flag_t f, bool v)
@@ -597,10 +599,19 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+    lv_obj_style_prop_cache_free(obj);
 
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
 
+    /*Free the cached bitmap*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_LAYER)) lv_refr_cache_layer_drop(obj);
+
+#if LV_LAYOUT_INCREMENTAL
+    /*Free the saved result of the last layout update*/
+    lv_layout_cache_drop(obj);
+#endif
+
     /*Delete from the group*/
     lv_group_t * group = lv_obj_get_group(obj);
     if(group) lv_group_remove_obj(obj);
@@ -1062,6 +1073,8 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
     lv_obj_invalidate(obj);
 
     obj->state = new_state;
+    /*The children might inherit state dependent values*/
+    lv_obj_style_prop_cache_invalidate(obj, true);
     lv_obj_update_layer_type(obj);
 
     /*Skip transitions if the widget is not rendered yet. */
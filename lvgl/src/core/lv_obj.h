@@ -82,6 +82,7 @@ typedef enum {
     LV_OBJ_FLAG_WIDGET_2        = (1u << 27), /**< Custom flag, free to use by widget*/
     LV_OBJ_FLAG_USER_1          = (1u << 28), /**< Custom flag, free to use by user*/
     LV_OBJ_FLAG_USER_2          = (1u << 29), /**< Custom flag, free to use by user*/
+    LV_OBJ_FLAG_CACHE_LAYER     = (1u << 30), /**< Render the widget with its children to a bitmap and reuse it until something changes. See `LV_OBJ_CACHE_LAYER_MAX_MEMORY`*/
 } lv_obj_flag_t;
 
 #if LV_USE_OBJ_PROPERTY
@@ -62,6 +62,7 @@ lv_result_t lv_obj_send_event(lv_obj_t * obj, lv_event_code_t event_code, void *
     e.stop_bubbling = 0;
     e.stop_processing = 0;
     e.stop_trickling = 0;
+    e.handled = 0;
 
     lv_event_push(&e);
 
@@ -9,6 +9,7 @@
 #include "lv_obj_scroll_private.h"
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_private.h"
+#include "lv_refr_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_scroll.h"
 #include "../display/lv_display.h"
@@ -426,7 +427,9 @@ lv_result_t lv_obj_scroll_by_raw(lv_obj_t * obj, int32_t x, int32_t y)
     lv_obj_move_children_by(obj, x, y, true);
     lv_result_t res = lv_obj_send_event(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RESULT_OK) return res;
-    lv_obj_invalidate(obj);
+
+    /*Try to move the already rendered pixels and redraw only the new parts*/
+    if(!lv_refr_scroll_blit(obj, x, y)) lv_obj_invalidate(obj);
     return LV_RESULT_OK;
 }
 
@@ -9,6 +9,7 @@
 #include "lv_obj_private.h"
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
+#include "../misc/lv_style_private.h"
 #include "lv_obj_class_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -16,6 +17,7 @@
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
 #include "lv_observer_private.h"
+#include "../layouts/lv_layout_private.h"
 
 /*********************
  *      DEFINES
@@ -25,6 +27,8 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define style_prop_cache_gen LV_GLOBAL_DEFAULT()->style_prop_cache_gen
+#define STYLE_PROP_CACHE_PROBE  4
 
 /**********************
  *      TYPEDEFS
@@ -56,7 +60,8 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
+static lv_obj_style_t * find_local_style(lv_obj_t * obj, lv_style_selector_t selector);
+static lv_obj_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_style_selector_t selector);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
@@ -73,6 +78,10 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+#if LV_OBJ_STYLE_PROP_CACHE
+    static lv_style_value_t * style_prop_cache_get_slot(lv_obj_t * obj, lv_style_selector_t selector,
+                                                        lv_style_prop_t prop, bool * hit);
+#endif
 #if LV_USE_OBSERVER
     static void bind_style_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
     static void bind_style_prop_observer_cb(lv_observer_t * observer, lv_subject_t * subject);
@@ -93,6 +102,12 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 void lv_obj_style_init(void)
 {
     lv_ll_init(style_trans_ll_p, sizeof(trans_t));
+#if LV_OBJ_STYLE_PROP_CACHE
+    style_prop_cache_gen = 1;
+#endif
+#if LV_OBJ_LOCAL_STYLE_INTERN
+    lv_style_intern_init();
+#endif
 }
 
 void lv_obj_style_deinit(void)
@@ -102,6 +117,9 @@ void lv_obj_style_deinit(void)
         lv_free(_style_custom_prop_flag_lookup_table);
         _style_custom_prop_flag_lookup_table = NULL;
     }
+#if LV_OBJ_LOCAL_STYLE_INTERN
+    lv_style_intern_deinit();
+#endif
 }
 
 void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selector_t selector)
@@ -236,6 +254,12 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
             trans_delete(obj, part, LV_STYLE_PROP_ANY, NULL);
         }
 
+#if LV_OBJ_LOCAL_STYLE_INTERN
+        if(obj->styles[i].is_local) {
+            lv_style_intern_release(obj->styles[i].style);
+            obj->styles[i].style = NULL;
+        }
+#endif
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
             if(obj->styles[i].style) lv_style_reset((lv_style_t *)obj->styles[i].style);
             lv_free((lv_style_t *)obj->styles[i].style);
@@ -269,6 +293,16 @@ void lv_obj_remove_style_all(lv_obj_t * obj)
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+#if LV_OBJ_STYLE_PROP_CACHE
+    /*Any widget might use the style directly or inherit from it, so drop all cached values*/
+    style_prop_cache_gen++;
+    if(style_prop_cache_gen == 0) style_prop_cache_gen = 1;
+#endif
+
+#if LV_LAYOUT_INCREMENTAL
+    lv_layout_cache_invalidate_all();
+#endif
+
     if(!style_refr) return;
     lv_display_t * d = lv_display_get_next(NULL);
 
@@ -285,6 +319,16 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*Drop the cached values even if refreshing is disabled as the values might be read anyway.
+     *The children inherit the values so drop their cache too if needed.*/
+    lv_obj_style_prop_cache_invalidate(obj, prop == LV_STYLE_PROP_ANY ||
+                                       lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE));
+
+#if LV_LAYOUT_INCREMENTAL
+    /*The layouts might have saved the old values (e.g. margins or grid cells) so they can't be reused*/
+    if(lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYOUT_UPDATE)) lv_layout_cache_invalidate_all();
+#endif
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -373,10 +417,24 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
+#if LV_OBJ_STYLE_PROP_CACHE
+    /*Transitions are created with temporarily skipped transition styles, don't cache these values*/
+    lv_style_value_t * slot = NULL;
+    if(!obj->skip_trans) {
+        bool hit;
+        slot = style_prop_cache_get_slot((lv_obj_t *)obj, selector, prop, &hit);
+        if(hit) return *slot;
+    }
+#endif
+
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) value_act = lv_style_prop_get_default(prop);
 
-    return lv_style_prop_get_default(prop);
+#if LV_OBJ_STYLE_PROP_CACHE
+    if(slot) *slot = value_act;
+#endif
+
+    return value_act;
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -398,14 +456,41 @@ void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_
     LV_PROFILER_STYLE_BEGIN;
 
     /*Stop running transitions with this property */
-    trans_delete(obj, lv_obj_style_get_selector_part(selector), prop, NULL);
+    bool trans_deleted = trans_delete(obj, lv_obj_style_get_selector_part(selector), prop, NULL);
+
+    /*Setting the same value again changes nothing, so don't refresh the styles*/
+    if(!trans_deleted) {
+        lv_style_value_t old_value;
+        if(lv_obj_get_local_style_prop(obj, prop, &old_value, selector) == LV_STYLE_RES_FOUND &&
+           lv_style_value_is_equal(prop, old_value, value)) {
+            LV_PROFILER_STYLE_END;
+            return;
+        }
+    }
+
+#if LV_OBJ_LOCAL_STYLE_INTERN
+    /*Get the shared style first so that nothing is changed if it fails*/
+    lv_obj_style_t * obj_style = find_local_style(obj, selector);
+    const lv_style_t * new_style = lv_style_intern_set_prop(obj_style ? obj_style->style : NULL, prop, value);
+    if(new_style == NULL) {
+        LV_PROFILER_STYLE_END;
+        return;
+    }
+    if(obj_style == NULL) obj_style = get_local_style(obj, selector);
+#else
+    lv_obj_style_t * obj_style = get_local_style(obj, selector);
+#endif
 
-    lv_style_t * style = get_local_style(obj, selector);
     if(selector == LV_PART_MAIN && lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_TRANSFORM)) {
         lv_obj_invalidate(obj);
     }
 
-    lv_style_set_prop(style, prop, value);
+#if LV_OBJ_LOCAL_STYLE_INTERN
+    lv_style_intern_release(obj_style->style);
+    obj_style->style = new_style;
+#else
+    lv_style_set_prop((lv_style_t *)obj_style->style, prop, value);
+#endif
 
 #if LV_OBJ_STYLE_CACHE
     uint32_t prop_shifted = STYLE_PROP_SHIFTED(prop);
@@ -451,7 +536,17 @@ bool lv_obj_remove_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_sty
     /*The style is not found*/
     if(i == obj->style_cnt) return false;
 
+#if LV_OBJ_LOCAL_STYLE_INTERN
+    lv_style_value_t v;
+    if(lv_style_get_prop(obj->styles[i].style, prop, &v) != LV_STYLE_RES_FOUND) return false;
+    const lv_style_t * new_style = lv_style_intern_remove_prop(obj->styles[i].style, prop);
+    if(new_style == NULL) return false;
+    lv_style_intern_release(obj->styles[i].style);
+    obj->styles[i].style = new_style;
+    lv_result_t res = LV_RESULT_OK;
+#else
     lv_result_t res = lv_style_remove_prop((lv_style_t *)obj->styles[i].style, prop);
+#endif
     if(res == LV_RESULT_OK) {
         full_cache_refresh(obj, lv_obj_style_get_selector_part(selector));
         lv_obj_refresh_style(obj, selector, prop);
@@ -532,6 +627,34 @@ lv_style_value_t lv_obj_style_apply_color_filter(const lv_obj_t * obj, lv_part_t
     return v;
 }
 
+void lv_obj_style_prop_cache_invalidate(lv_obj_t * obj, bool deep)
+{
+#if LV_OBJ_STYLE_PROP_CACHE
+    if(obj->style_prop_cache) obj->style_prop_cache->gen = 0;
+
+    if(deep) {
+        uint32_t i;
+        uint32_t child_cnt = lv_obj_get_child_count(obj);
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_style_prop_cache_invalidate(obj->spec_attr->children[i], true);
+        }
+    }
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(deep);
+#endif
+}
+
+void lv_obj_style_prop_cache_free(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_PROP_CACHE
+    lv_free(obj->style_prop_cache);
+    obj->style_prop_cache = NULL;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state1, lv_state_t state2)
 {
     lv_style_state_cmp_t res = LV_STYLE_STATE_CMP_SAME;
@@ -786,22 +909,39 @@ lv_observer_t * lv_obj_bind_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_
  **********************/
 
 /**
- * Get the local style of an object for a given part and for a given state.
- * If the local style for the part-state pair doesn't exist allocate and return it.
+ * Find the local style of an object for a given part and for a given state.
  * @param obj pointer to an object
  * @param selector OR-ed value of parts and state for which the style should be get
- * @return pointer to the local style
+ * @return pointer to the local style entry of the object or NULL if there is no such local style
  */
-static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector)
+static lv_obj_style_t * find_local_style(lv_obj_t * obj, lv_style_selector_t selector)
 {
     uint32_t i;
     for(i = 0; i < obj->style_cnt; i++) {
         if(obj->styles[i].is_local &&
            obj->styles[i].selector == selector) {
-            return (lv_style_t *)obj->styles[i].style;
+            return &obj->styles[i];
         }
     }
 
+    return NULL;
+}
+
+/**
+ * Get the local style of an object for a given part and for a given state.
+ * If the local style for the part-state pair doesn't exist allocate and return it.
+ * With `LV_OBJ_LOCAL_STYLE_INTERN` the style of a new entry is NULL and
+ * an interned style should be assigned to it.
+ * @param obj pointer to an object
+ * @param selector OR-ed value of parts and state for which the style should be get
+ * @return pointer to the local style entry of the object
+ */
+static lv_obj_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector)
+{
+    lv_obj_style_t * obj_style = find_local_style(obj, selector);
+    if(obj_style) return obj_style;
+
+    uint32_t i;
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
     obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
@@ -815,12 +955,14 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
     }
 
     lv_memzero(&obj->styles[i], sizeof(lv_obj_style_t));
+#if LV_OBJ_LOCAL_STYLE_INTERN == 0
     obj->styles[i].style = lv_malloc_zeroed(sizeof(lv_style_t));
     lv_style_init((lv_style_t *)obj->styles[i].style);
+#endif
 
     obj->styles[i].is_local = 1;
     obj->styles[i].selector = selector;
-    return (lv_style_t *)obj->styles[i].style;
+    return &obj->styles[i];
 }
 
 /**
@@ -994,6 +1136,9 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
         }
         tr = tr_prev;
     }
+
+    if(removed) lv_obj_style_prop_cache_invalidate(obj, true);
+
     return removed;
 }
 
@@ -1112,6 +1257,7 @@ static void trans_anim_completed_cb(lv_anim_t * a)
 
                 lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                lv_obj_style_prop_cache_invalidate(obj, lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE));
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
@@ -1141,6 +1287,8 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+    lv_obj_style_prop_cache_invalidate(obj, false);
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1297,6 +1445,58 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
     return LV_STYLE_RES_NOT_FOUND;
 }
 
+#if LV_OBJ_STYLE_PROP_CACHE
+
+/**
+ * Find the slot of a property in the widget's resolved value table.
+ * @param obj       pointer to a widget
+ * @param selector  part and state of the property
+ * @param prop      the property
+ * @param hit       set to true if the slot already stores the value
+ * @return          pointer to the value in the table. On a miss the value should be written there.
+ *                  NULL if the table couldn't be allocated.
+ */
+static lv_style_value_t * style_prop_cache_get_slot(lv_obj_t * obj, lv_style_selector_t selector,
+                                                    lv_style_prop_t prop, bool * hit)
+{
+    *hit = false;
+
+    lv_obj_style_prop_cache_t * cache = obj->style_prop_cache;
+    if(cache == NULL) {
+        cache = lv_malloc_zeroed(sizeof(lv_obj_style_prop_cache_t));
+        if(cache == NULL) return NULL;
+        obj->style_prop_cache = cache;
+    }
+
+    if(cache->gen != style_prop_cache_gen) {
+        lv_memzero(cache->keys, sizeof(cache->keys));
+        cache->gen = style_prop_cache_gen;
+    }
+
+    /*Prop. 0 is invalid so key 0 can mark the empty slots*/
+    uint32_t key = ((uint32_t)selector << 8) | prop;
+    uint32_t home = ((key * 2654435761U) >> 16) & (LV_OBJ_STYLE_PROP_CACHE_SLOTS - 1);
+
+    uint32_t i;
+    for(i = 0; i < STYLE_PROP_CACHE_PROBE; i++) {
+        uint32_t idx = (home + i) & (LV_OBJ_STYLE_PROP_CACHE_SLOTS - 1);
+        if(cache->keys[idx] == key) {
+            *hit = true;
+            return &cache->values[idx];
+        }
+        if(cache->keys[idx] == 0) {
+            cache->keys[idx] = key;
+            return &cache->values[idx];
+        }
+    }
+
+    /*All probed slots are used, evict the entry in the home slot*/
+    cache->keys[home] = key;
+    return &cache->values[home];
+}
+
+#endif /*LV_OBJ_STYLE_PROP_CACHE*/
+
 #if LV_USE_OBSERVER
 
 static void bind_style_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
@@ -20,6 +20,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of slots in the per-object resolved style property table. Must be a power of 2.*/
+#define LV_OBJ_STYLE_PROP_CACHE_SLOTS   32
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +35,14 @@ struct _lv_obj_style_t {
     uint32_t is_disabled : 1;
 };
 
+#if LV_OBJ_STYLE_PROP_CACHE
+struct _lv_obj_style_prop_cache_t {
+    uint32_t gen;                                           /**< Valid only if equals the global generation*/
+    uint32_t keys[LV_OBJ_STYLE_PROP_CACHE_SLOTS];           /**< `(selector << 8) | prop`, 0: empty slot*/
+    lv_style_value_t values[LV_OBJ_STYLE_PROP_CACHE_SLOTS];
+};
+#endif
+
 struct _lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
@@ -85,6 +96,20 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
  */
 void lv_obj_update_layer_type(lv_obj_t * obj);
 
+/**
+ * Drop the cached resolved style values of a widget.
+ * Does nothing if `LV_OBJ_STYLE_PROP_CACHE` is disabled.
+ * @param obj       pointer to a widget
+ * @param deep      true: drop the cache of the children too (e.g. inherited values might have changed)
+ */
+void lv_obj_style_prop_cache_invalidate(lv_obj_t * obj, bool deep);
+
+/**
+ * Free the cached resolved style values of a widget. Called when the widget is deleted.
+ * @param obj       pointer to a widget
+ */
+void lv_obj_style_prop_cache_free(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
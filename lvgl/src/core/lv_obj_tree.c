@@ -8,12 +8,14 @@
  *********************/
 #include "lv_obj_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_style_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_anim_private.h"
 #include "../misc/lv_async.h"
+#include "../layouts/lv_layout_private.h"
 #include "../core/lv_global.h"
 
 /*********************
@@ -111,6 +113,11 @@ void lv_obj_clean(lv_obj_t * obj)
         obj->spec_attr->scroll.y = 0;
     }
 
+#if LV_LAYOUT_INCREMENTAL
+    /*The saved layout data belongs to the deleted children*/
+    lv_layout_cache_drop(obj);
+#endif
+
     if(lv_obj_get_child_count(obj) < cnt) {
         lv_obj_send_event(obj, LV_EVENT_CHILD_CHANGED, NULL);
         lv_obj_send_event(obj, LV_EVENT_CHILD_DELETED, NULL);
@@ -191,6 +198,9 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+    /*The inherited style values might be different in the new parent*/
+    lv_obj_style_prop_cache_invalidate(obj, true);
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
     lv_obj_send_event(old_parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -13,6 +13,7 @@
 #include "../lvgl.h"
 #include "../core/lv_obj_private.h"
 #include "../misc/lv_event_private.h"
+#include "../core/lv_global.h"
 
 /*********************
  *      DEFINES
@@ -22,6 +23,13 @@
     #define FLT_MAX 3.402823466e+38F /* float max value */
 #endif
 
+#define subject_pending LV_GLOBAL_DEFAULT()->subject_pending
+#define subject_pending_cnt LV_GLOBAL_DEFAULT()->subject_pending_cnt
+#define subject_pending_capacity LV_GLOBAL_DEFAULT()->subject_pending_capacity
+#define subject_batch_depth LV_GLOBAL_DEFAULT()->subject_batch_depth
+#define subject_notify_running LV_GLOBAL_DEFAULT()->subject_notify_running
+#define subject_notify_timer LV_GLOBAL_DEFAULT()->subject_notify_timer
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -76,6 +84,10 @@ static void obj_state_observer_cb(lv_observer_t * observer, lv_subject_t * subje
 static void obj_value_changed_event_cb(lv_event_t * e);
 
 static void lv_subject_notify_if_changed(lv_subject_t * subject);
+static bool subject_is_changed(lv_subject_t * subject);
+static void subject_add_pending(lv_subject_t * subject);
+static void subject_remove_pending(lv_subject_t * subject);
+static void subject_notify_timer_cb(lv_timer_t * t);
 
 static void subject_set_string_free_user_data_event_cb(lv_event_t * e);
 
@@ -124,7 +136,8 @@ void lv_subject_set_int(lv_subject_t * subject, int32_t value)
 
     value = LV_CLAMP(subject->min_value.num, value, subject->max_value.num);
 
-    subject->prev_value.num = subject->value.num;
+    /*Keep the last notified value until the pending notification*/
+    if(!subject->pending) subject->prev_value.num = subject->value.num;
     subject->value.num = value;
     lv_subject_notify_if_changed(subject);
 }
@@ -191,7 +204,7 @@ void lv_subject_set_float(lv_subject_t * subject, float value)
 
     value = LV_CLAMP(subject->min_value.float_v, value, subject->max_value.float_v);
 
-    subject->prev_value.float_v = subject->value.float_v;
+    if(!subject->pending) subject->prev_value.float_v = subject->value.float_v;
     subject->value.float_v = value;
     lv_subject_notify_if_changed(subject);
 }
@@ -261,7 +274,7 @@ void lv_subject_copy_string(lv_subject_t * subject, const char * buf)
     }
 
     if(subject->size < 1) return;
-    if(subject->prev_value.pointer) {
+    if(subject->prev_value.pointer && !subject->pending) {
         lv_strlcpy((char *)subject->prev_value.pointer, subject->value.pointer, subject->size);
     }
 
@@ -279,7 +292,7 @@ void lv_subject_snprintf(lv_subject_t * subject, const char * format, ...)
 
     if(subject->size < 1U) return;
 
-    if(subject->prev_value.pointer) {
+    if(subject->prev_value.pointer && !subject->pending) {
         lv_strlcpy((char *)subject->prev_value.pointer, subject->value.pointer, subject->size);
     }
 
@@ -328,7 +341,7 @@ void lv_subject_set_pointer(lv_subject_t * subject, void * ptr)
         return;
     }
 
-    subject->prev_value.pointer = subject->value.pointer;
+    if(!subject->pending) subject->prev_value.pointer = subject->value.pointer;
     subject->value.pointer = ptr;
     lv_subject_notify_if_changed(subject);
 }
@@ -369,7 +382,7 @@ void lv_subject_set_color(lv_subject_t * subject, lv_color_t color)
         return;
     }
 
-    subject->prev_value.color = subject->value.color;
+    if(!subject->pending) subject->prev_value.color = subject->value.color;
     subject->value.color = color;
     lv_subject_notify_if_changed(subject);
 }
@@ -411,6 +424,8 @@ void lv_subject_init_group(lv_subject_t * group_subject, lv_subject_t * list[],
 
 void lv_subject_deinit(lv_subject_t * subject)
 {
+    if(subject->pending) subject_remove_pending(subject);
+
     lv_observer_t * observer = lv_ll_get_head(&subject->subs_ll);
     while(observer) {
         lv_observer_t * observer_next = lv_ll_get_next(&subject->subs_ll, observer);
@@ -583,6 +598,65 @@ void lv_subject_notify(lv_subject_t * subject)
     } while(subject->notify_restart_query);
 }
 
+void lv_subject_batch_begin(void)
+{
+    subject_batch_depth++;
+}
+
+void lv_subject_batch_end(void)
+{
+    if(subject_batch_depth == 0) {
+        LV_LOG_WARN("No batch was started");
+        return;
+    }
+
+    subject_batch_depth--;
+}
+
+void lv_subject_set_deferred(lv_subject_t * subject, bool en)
+{
+    LV_ASSERT_NULL(subject);
+    subject->deferred = en;
+}
+
+void lv_subject_notify_pending(void)
+{
+    /*The Subjects set by the Observers are notified by the running loop*/
+    if(subject_notify_running) return;
+    subject_notify_running = true;
+
+    while(subject_pending_cnt) {
+        /*Notify the groups only when all the other Subjects settled,
+         *so they are notified only once with the final values of their elements*/
+        uint32_t i;
+        for(i = 0; i < subject_pending_cnt; i++) {
+            if(subject_pending[i]->type != LV_SUBJECT_TYPE_GROUP) break;
+        }
+        if(i == subject_pending_cnt) i = 0;
+
+        lv_subject_t * subject = subject_pending[i];
+        subject_remove_pending(subject);
+        if(subject_is_changed(subject)) lv_subject_notify(subject);
+    }
+
+    subject_notify_running = false;
+    if(subject_notify_timer) lv_timer_pause(subject_notify_timer);
+}
+
+void lv_observer_deinit(void)
+{
+    lv_free(subject_pending);
+    subject_pending = NULL;
+    subject_pending_cnt = 0;
+    subject_pending_capacity = 0;
+    subject_batch_depth = 0;
+
+    if(subject_notify_timer) {
+        lv_timer_delete(subject_notify_timer);
+        subject_notify_timer = NULL;
+    }
+}
+
 lv_subject_increment_dsc_t * lv_obj_add_subject_increment_event(lv_obj_t * obj, lv_subject_t * subject,
                                                                 lv_event_code_t trigger, int32_t step)
 {
@@ -950,7 +1024,14 @@ static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject)
 {
     LV_UNUSED(subject);
     lv_subject_t * subject_group = observer->user_data;
-    lv_subject_notify(subject_group);
+
+    /*Notify the group once after all of its changed elements*/
+    if(subject_notify_running || subject_batch_depth > 0 || subject_group->deferred) {
+        subject_add_pending(subject_group);
+    }
+    else {
+        lv_subject_notify(subject_group);
+    }
 }
 
 static void unsubscribe_on_delete_cb(lv_event_t * e)
@@ -1051,40 +1132,96 @@ static void obj_value_changed_event_cb(lv_event_t * e)
 
 static void lv_subject_notify_if_changed(lv_subject_t * subject)
 {
+    if(subject->deferred || subject_batch_depth > 0) {
+        subject_add_pending(subject);
+        return;
+    }
+
+    if(subject_is_changed(subject)) lv_subject_notify(subject);
+}
 
+static bool subject_is_changed(lv_subject_t * subject)
+{
     switch(subject->type) {
         case LV_SUBJECT_TYPE_INVALID :
         case LV_SUBJECT_TYPE_NONE :
-            return;
+            return false;
         case LV_SUBJECT_TYPE_INT :
-            if(subject->value.num != subject->prev_value.num) {
-                lv_subject_notify(subject);
-            }
-            break;
+            return subject->value.num != subject->prev_value.num;
 #if LV_USE_FLOAT
         case LV_SUBJECT_TYPE_FLOAT :
-            if(subject->value.float_v != subject->prev_value.float_v) {
-                lv_subject_notify(subject);
-            }
-            break;
+            return subject->value.float_v != subject->prev_value.float_v;
 #endif
         case LV_SUBJECT_TYPE_GROUP :
         case LV_SUBJECT_TYPE_POINTER :
             /* Always notify as we don't know how to compare this */
-            lv_subject_notify(subject);
-            break;
+            return true;
         case LV_SUBJECT_TYPE_COLOR  :
-            if(!lv_color_eq(subject->value.color, subject->prev_value.color)) {
-                lv_subject_notify(subject);
-            }
-            break;
+            return !lv_color_eq(subject->value.color, subject->prev_value.color);
         case LV_SUBJECT_TYPE_STRING:
-            if(!subject->prev_value.pointer ||
-               lv_strcmp(subject->value.pointer, subject->prev_value.pointer)) {
-                lv_subject_notify(subject);
-            }
+            return !subject->prev_value.pointer ||
+                   lv_strcmp(subject->value.pointer, subject->prev_value.pointer);
+    }
+
+    return false;
+}
+
+/**
+ * Add a Subject to the list of Subjects to notify in the next `lv_timer_handler()` call
+ * @param subject   pointer to Subject
+ */
+static void subject_add_pending(lv_subject_t * subject)
+{
+    if(subject->pending) return;
+
+    if(subject_pending_cnt == subject_pending_capacity) {
+        uint32_t new_capacity = subject_pending_capacity ? subject_pending_capacity * 2 : 8;
+        lv_subject_t ** new_pending = lv_realloc(subject_pending, new_capacity * sizeof(lv_subject_t *));
+        LV_ASSERT_MALLOC(new_pending);
+        if(new_pending == NULL) {
+            /*Don't lose the change*/
+            if(subject_is_changed(subject)) lv_subject_notify(subject);
+            return;
+        }
+        subject_pending = new_pending;
+        subject_pending_capacity = new_capacity;
+    }
+
+    subject_pending[subject_pending_cnt] = subject;
+    subject_pending_cnt++;
+    subject->pending = 1;
+
+    if(subject_notify_timer == NULL) {
+        subject_notify_timer = lv_timer_create(subject_notify_timer_cb, 0, NULL);
+    }
+    else {
+        lv_timer_resume(subject_notify_timer);
+    }
+}
+
+static void subject_remove_pending(lv_subject_t * subject)
+{
+    uint32_t i;
+    for(i = 0; i < subject_pending_cnt; i++) {
+        if(subject_pending[i] == subject) {
+            subject_pending_cnt--;
+            lv_memmove(&subject_pending[i], &subject_pending[i + 1],
+                       (subject_pending_cnt - i) * sizeof(lv_subject_t *));
             break;
+        }
     }
+
+    subject->pending = 0;
+}
+
+static void subject_notify_timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+
+    /*Wait until the batch is closed*/
+    if(subject_batch_depth > 0) return;
+
+    lv_subject_notify_pending();
 }
 
 static void subject_set_string_free_user_data_event_cb(lv_event_t * e)
@@ -73,6 +73,8 @@ struct _lv_subject_t {
     uint32_t size                 : 24;  /**< String buffer size or group length */
     uint32_t notify_restart_query :  1;  /**< If an Observer was deleted during notification,
                                           * start notifying from the beginning. */
+    uint32_t deferred             :  1;  /**< Notify the Observers only once per `lv_timer_handler()` call */
+    uint32_t pending              :  1;  /**< Changed but the Observers are not notified yet */
 };
 
 /**
@@ -402,6 +404,35 @@ void * lv_observer_get_user_data(const lv_observer_t * observer);
  */
 void lv_subject_notify(lv_subject_t * subject);
 
+/**
+ * Start a batch of Subject changes. Until the matching `lv_subject_batch_end()` the Observers
+ * are not notified when a Subject is set. Instead, the Observers of each changed Subject are
+ * notified only once, with the final value, in the next `lv_timer_handler()` call.
+ * Batches can be nested.
+ */
+void lv_subject_batch_begin(void);
+
+/**
+ * Close a batch started by `lv_subject_batch_begin()`.
+ */
+void lv_subject_batch_end(void);
+
+/**
+ * Enable or disable coalescing the notifications of a Subject.
+ * If enabled, setting the Subject doesn't notify the Observers immediately but only once,
+ * with the final value, in the next `lv_timer_handler()` call, like in a batch.
+ * @param subject       pointer to Subject
+ * @param en            true: enable deferred notifications
+ */
+void lv_subject_set_deferred(lv_subject_t * subject, bool en);
+
+/**
+ * Notify the Observers of the Subjects changed in a batch or in deferred mode now, without
+ * waiting for `lv_timer_handler()`. Subjects changed by the Observers in deferred mode are
+ * notified as well. Group Subjects are notified after their elements.
+ */
+void lv_subject_notify_pending(void);
+
 /**
  * Add an event handler to increment (or decrement) the value of a subject on a trigger.
  * @param obj       pointer to a widget
@@ -54,6 +54,11 @@ struct _lv_subject_increment_dsc_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Free the list of pending Subjects and its timer
+ */
+void lv_observer_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
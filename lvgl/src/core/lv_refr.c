@@ -9,6 +9,7 @@
 #include "lv_refr_private.h"
 #include "lv_obj_draw_private.h"
 #include "../misc/lv_area_private.h"
+#include "../misc/lv_event_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../draw/lv_draw_mask.h"
 #include "lv_obj_private.h"
@@ -22,6 +23,7 @@
 #include "../misc/lv_types.h"
 #include "../draw/lv_draw_private.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/cache/instance/lv_image_cache.h"
 #include "lv_global.h"
 
 /*********************
@@ -31,16 +33,39 @@
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+/*Max. number of opaque children tracked to cull the children behind them*/
+#define OCCLUDER_MAX 4
+
+/*Max. number of areas drawn over a scrolled widget which don't move with its children*/
+#define SCROLL_BLIT_STATIC_MAX 8
+
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    #define cache_layer_ll LV_GLOBAL_DEFAULT()->cache_layer_ll
+    #define cache_layer_stats LV_GLOBAL_DEFAULT()->cache_layer_stats
+    #define cache_layer_frame_id LV_GLOBAL_DEFAULT()->cache_layer_frame_id
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_REFR_OCCLUSION_CULLING
+/** An opaque area of a child which covers its older siblings*/
+typedef struct {
+    lv_area_t area;
+    uint32_t child_id;
+} occluder_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
+static bool sync_tiles_prepare(lv_display_t * disp);
+static void sync_tiles_set_area(lv_display_t * disp, const lv_area_t * area, bool en, bool covered_only);
+static bool sync_tiles_range_is_set(const uint32_t * row_bits, int32_t col_start, int32_t col_end);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
 static void refr_configured_layer(lv_layer_t * layer);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
@@ -51,10 +76,36 @@ static void wait_for_flushing(lv_display_t * disp);
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out);
 static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
+static bool refr_obj_cache_layer(lv_layer_t * layer, lv_obj_t * obj);
+static void redraw_children(lv_layer_t * layer, lv_obj_t * obj);
+#if LV_REFR_OCCLUSION_CULLING
+    static uint32_t occluders_collect(lv_layer_t * layer, lv_obj_t * obj, occluder_t * occluders);
+    static bool occlusion_clip_child(lv_layer_t * layer, lv_obj_t * child, uint32_t child_id,
+                                     const occluder_t * occluders, uint32_t occluder_cnt);
+#endif
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    static void cache_layer_render(lv_refr_cache_layer_t * cache, lv_layer_t * parent_layer, const lv_area_t * cache_area);
+    static bool cache_layer_make_room(uint32_t size);
+    static lv_refr_cache_layer_t * cache_layer_find(const lv_obj_t * obj);
+    static void cache_layer_free_buf(lv_refr_cache_layer_t * cache);
+#endif
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     static bool refr_check_obj_clip_overflow(lv_layer_t * layer, lv_obj_t * obj);
     static void refr_obj_matrix(lv_layer_t * layer, lv_obj_t * obj);
 #endif
+#if LV_REFR_SCROLL_BLIT
+    static void refr_scroll_blits(void);
+    static bool scroll_blit_get_area(lv_obj_t * obj, lv_area_t * visible_area, lv_area_t * blit_area);
+    static bool scroll_blit_class_is_plain(const lv_obj_t * obj);
+    static bool scroll_blit_has_draw_event(lv_obj_t * obj, lv_event_code_t first_code);
+    static bool scroll_blit_collect_static(lv_obj_t * obj, const lv_area_t * blit_area, lv_area_t * areas,
+                                           uint32_t * cnt);
+    static bool scroll_blit_add_obj(lv_obj_t * obj, const lv_area_t * blit_area, lv_area_t * areas, uint32_t * cnt);
+    static bool scroll_blit_add_area(const lv_area_t * area, const lv_area_t * blit_area, lv_area_t * areas,
+                                     uint32_t * cnt);
+    static void scroll_blit_inv_moved(lv_display_t * disp, const lv_area_t * area, const lv_area_t * blit_area,
+                                      int32_t dx, int32_t dy);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -78,10 +129,24 @@ static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area);
  */
 void lv_refr_init(void)
 {
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    lv_ll_init(&cache_layer_ll, sizeof(lv_refr_cache_layer_t));
+    lv_memzero(&cache_layer_stats, sizeof(cache_layer_stats));
+    cache_layer_frame_id = 0;
+#endif
 }
 
 void lv_refr_deinit(void)
 {
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    /*The widgets are already deleted, only the not yet freed entries can remain here*/
+    lv_refr_cache_layer_t * cache;
+    while((cache = lv_ll_get_head(&cache_layer_ll)) != NULL) {
+        if(cache->draw_buf) lv_draw_buf_destroy(cache->draw_buf);
+        lv_ll_remove(&cache_layer_ll, cache);
+        lv_free(cache);
+    }
+#endif
 }
 
 void lv_refr_now(lv_display_t * disp)
@@ -153,7 +218,6 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     }
 
     if(refr_children) {
-        uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_count(obj);
         if(child_cnt == 0) {
             /*If the object was visible on the clip area call the post draw events too*/
@@ -173,10 +237,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
             }
 
             if(clip_corner == false) {
-                for(i = 0; i < child_cnt; i++) {
-                    lv_obj_t * child = obj->spec_attr->children[i];
-                    lv_obj_refr(layer, child);
-                }
+                redraw_children(layer, obj);
 
                 /*If the object was visible on the clip area call the post draw events too*/
                 /*If all the children are redrawn make 'post draw' draw*/
@@ -202,10 +263,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 if(lv_area_intersect(&bottom, &bottom, &layer->_clip_area)) {
                     layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &bottom);
 
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer_children, child);
-                    }
+                    redraw_children(layer_children, obj);
 
                     /*If all the children are redrawn send 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer_children);
@@ -223,10 +281,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 if(lv_area_intersect(&top, &top, &layer->_clip_area)) {
                     layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &top);
 
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer_children, child);
-                    }
+                    redraw_children(layer_children, obj);
 
                     /*If all the children are redrawn send 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer_children);
@@ -245,10 +300,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 mid.y2 -= rout;
                 if(lv_area_intersect(&mid, &mid, &layer->_clip_area)) {
                     layer->_clip_area = mid;
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer, child);
-                    }
+                    redraw_children(layer, obj);
 
                     /*If all the children are redrawn make 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer);
@@ -288,6 +340,9 @@ lv_result_t lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+#if LV_REFR_SCROLL_BLIT
+        disp->scroll_blit_cnt = 0;
+#endif
         return LV_RESULT_OK;
     }
 
@@ -390,6 +445,8 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    lv_event_stats_frame_start();
+
     lv_result_t res = lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
     if(res == LV_RESULT_INVALID) {
         LV_TRACE_REFR("deleted");
@@ -410,25 +467,46 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+#if LV_REFR_SCROLL_BLIT
+        disp_refr->scroll_blit_cnt = 0;
+#endif
         LV_LOG_WARN("there is no active screen");
         goto refr_finish;
     }
 
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    /*The bitmaps drawn in this cycle might be used by draw tasks until the end of the cycle.
+     *The ID helps to not free or overwrite them until that.*/
+    cache_layer_frame_id++;
+#endif
+
+#if LV_REFR_OCCLUSION_CULLING
+    disp_refr->occlusion_stats.frame_culled_px = 0;
+#endif
+
     lv_refr_join_area();
     refr_sync_areas();
+#if LV_REFR_SCROLL_BLIT
+    refr_scroll_blits();
+#endif
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
-    /*In double buffered direct mode save the updated areas.
+
+    uint32_t i;
+    uint32_t px_size = lv_color_format_get_size(disp_refr->color_format);
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        disp_refr->sync_stats.rendered_bytes += (uint64_t)lv_area_get_size(&disp_refr->inv_areas[i]) * px_size;
+    }
+
+    /*In double buffered direct mode save the updated tiles.
      *They will be used on the next call to synchronize the buffers.*/
-    if(lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
-        uint32_t i;
+    if(lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT &&
+       sync_tiles_prepare(disp_refr)) {
         for(i = 0; i < disp_refr->inv_p; i++) {
-            if(disp_refr->inv_area_joined[i])
-                continue;
-
-            lv_area_t * sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
-            *sync_area = disp_refr->inv_areas[i];
+            if(disp_refr->inv_area_joined[i]) continue;
+            sync_tiles_set_area(disp_refr, &disp_refr->inv_areas[i], true, false);
         }
     }
 
@@ -514,7 +592,7 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
 
     lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
-        lv_obj_redraw(layer, obj);
+        if(!refr_obj_cache_layer(layer, obj)) lv_obj_redraw(layer, obj);
     }
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /*If the layer opa is full then use the matrix transform*/
@@ -608,6 +686,138 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
     layer->recolor = layer_recolor;
 }
 
+void lv_refr_cache_layer_get_stats(lv_refr_cache_layer_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    *stats = cache_layer_stats;
+#else
+    lv_memzero(stats, sizeof(lv_refr_cache_layer_stats_t));
+#endif
+}
+
+void lv_refr_cache_layer_flush(void)
+{
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    lv_refr_cache_layer_t * cache;
+    while((cache = lv_ll_get_head(&cache_layer_ll)) != NULL) {
+        lv_refr_cache_layer_drop(cache->obj);
+    }
+#endif
+}
+
+void lv_refr_cache_layer_invalidate(const lv_obj_t * obj)
+{
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    if(cache_layer_stats.entry_cnt == 0) return;
+
+    /*The parents' bitmaps contain this widget too*/
+    while(obj) {
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_LAYER)) {
+            lv_refr_cache_layer_t * cache = cache_layer_find(obj);
+            if(cache) cache->valid = 0;
+        }
+        obj = obj->parent;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void lv_refr_cache_layer_drop(lv_obj_t * obj)
+{
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    lv_refr_cache_layer_t * cache = cache_layer_find(obj);
+    if(cache == NULL) return;
+
+    cache_layer_free_buf(cache);
+    lv_ll_remove(&cache_layer_ll, cache);
+    lv_free(cache);
+    cache_layer_stats.entry_cnt--;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+bool lv_refr_scroll_blit(lv_obj_t * obj, int32_t dx, int32_t dy)
+{
+#if LV_REFR_SCROLL_BLIT
+    if(dx == 0 && dy == 0) return false;
+
+    lv_area_t visible_area;
+    lv_area_t blit_area;
+    if(!scroll_blit_get_area(obj, &visible_area, &blit_area)) return false;
+    if(LV_ABS(dx) >= lv_area_get_width(&blit_area) || LV_ABS(dy) >= lv_area_get_height(&blit_area)) return false;
+
+    lv_area_t static_areas[SCROLL_BLIT_STATIC_MAX];
+    uint32_t static_cnt = 0;
+    if(!scroll_blit_collect_static(obj, &blit_area, static_areas, &static_cnt)) return false;
+
+    /*Continue the last blit if the same area is scrolled again*/
+    lv_display_t * disp = lv_obj_get_display(obj);
+    lv_display_scroll_blit_t * blit = NULL;
+    if(disp->scroll_blit_cnt > 0 &&
+       lv_area_is_equal(&disp->scroll_blits[disp->scroll_blit_cnt - 1].area, &blit_area)) {
+        blit = &disp->scroll_blits[disp->scroll_blit_cnt - 1];
+    }
+    else {
+        if(disp->scroll_blit_cnt >= LV_DISPLAY_SCROLL_BLIT_CNT) return false;
+        blit = &disp->scroll_blits[disp->scroll_blit_cnt];
+        blit->area = blit_area;
+        blit->dx = 0;
+        blit->dy = 0;
+        disp->scroll_blit_cnt++;
+    }
+    blit->dx += dx;
+    blit->dy += dy;
+
+    lv_refr_cache_layer_invalidate(obj);
+
+    /*The outdated pixels waiting for redraw are moved too*/
+    uint32_t inv_cnt = disp->inv_p;
+    uint32_t i;
+    for(i = 0; i < inv_cnt; i++) {
+        scroll_blit_inv_moved(disp, &disp->inv_areas[i], &blit_area, dx, dy);
+    }
+
+    /*The widgets drawn over the area stay in place, so redraw them and the pixels moved from below them*/
+    for(i = 0; i < static_cnt; i++) {
+        lv_inv_area(disp, &static_areas[i]);
+        scroll_blit_inv_moved(disp, &static_areas[i], &blit_area, dx, dy);
+    }
+
+    /*The newly exposed strips*/
+    lv_area_t a;
+    if(dy != 0) {
+        a = blit_area;
+        if(dy > 0) a.y2 = a.y1 + dy - 1;
+        else a.y1 = a.y2 + dy + 1;
+        lv_inv_area(disp, &a);
+    }
+    if(dx != 0) {
+        a = blit_area;
+        if(dx > 0) a.x2 = a.x1 + dx - 1;
+        else a.x1 = a.x2 + dx + 1;
+        lv_inv_area(disp, &a);
+    }
+
+    /*The edges of the widget which are not moved (border, rounded corners)*/
+    lv_area_t edges[4];
+    int8_t edge_cnt = lv_area_diff(edges, &visible_area, &blit_area);
+    int8_t e;
+    for(e = 0; e < edge_cnt; e++) {
+        lv_inv_area(disp, &edges[e]);
+    }
+
+    return true;
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(dx);
+    LV_UNUSED(dy);
+    return false;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -662,8 +872,18 @@ static void refr_sync_areas(void)
     /*Do not sync if not double buffered*/
     if(!lv_display_is_double_buffered(disp_refr)) return;
 
-    /*Do not sync if no sync areas*/
-    if(lv_ll_is_empty(&disp_refr->sync_areas)) return;
+    /*Do not sync if there are no tiles from the last refresh or the resolution has changed since then*/
+    if(disp_refr->sync_tiles == NULL) return;
+    if(!sync_tiles_prepare(disp_refr)) return;
+
+    int32_t cols = disp_refr->sync_tile_cols;
+    int32_t rows = disp_refr->sync_tile_rows;
+    int32_t words = (cols + 31) / 32;
+    int32_t w;
+    for(w = 0; w < words * rows; w++) {
+        if(disp_refr->sync_tiles[w]) break;
+    }
+    if(w == words * rows) return;
 
     LV_PROFILER_REFR_BEGIN;
     /*With double buffered direct mode synchronize the rendered areas to the other buffer*/
@@ -690,69 +910,163 @@ static void refr_sync_areas(void)
         on_screen = disp_refr->buf_2;
     }
 
+    /*The tiles fully covered by the areas to redraw will be overwritten anyway.
+     *If scrolled pixels are moved first, all the tiles are needed as the source.*/
+    uint32_t i;
+    bool skip_covered = true;
+#if LV_REFR_SCROLL_BLIT
+    if(disp_refr->scroll_blit_cnt) skip_covered = false;
+#endif
+    for(i = 0; skip_covered && i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        sync_tiles_set_area(disp_refr, &disp_refr->inv_areas[i], false, true);
+    }
+
     uint32_t hor_res = lv_display_get_horizontal_resolution(disp_refr);
     uint32_t ver_res = lv_display_get_vertical_resolution(disp_refr);
+    lv_area_t disp_area = {0, 0, (int32_t)hor_res - 1, (int32_t)ver_res - 1};
+    uint32_t px_size = lv_color_format_get_size(disp_refr->color_format);
+
+    /*Copy the remaining tiles. Adjacent tiles of a row are copied together
+     *and the same run of tiles in the next rows is merged into the same rectangle.*/
+    int32_t row;
+    for(row = 0; row < rows; row++) {
+        uint32_t * row_bits = disp_refr->sync_tiles + row * words;
+        int32_t col = 0;
+        while(col < cols) {
+            if(row_bits[col / 32] == 0) {
+                col = (col / 32 + 1) * 32;
+                continue;
+            }
+            if(!sync_tiles_range_is_set(row_bits, col, col)) {
+                col++;
+                continue;
+            }
 
-    /*Iterate through invalidated areas to see if sync area should be copied*/
-    uint16_t i;
-    int8_t j;
-    lv_area_t res[4] = {0};
-    int8_t res_c;
-    lv_area_t * sync_area, * new_area, * next_area;
-    for(i = 0; i < disp_refr->inv_p; i++) {
-        /*Skip joined areas*/
-        if(disp_refr->inv_area_joined[i]) continue;
+            int32_t col_end = col;
+            while(col_end + 1 < cols && sync_tiles_range_is_set(row_bits, col_end + 1, col_end + 1)) col_end++;
 
-        /*Iterate over sync areas*/
-        sync_area = lv_ll_get_head(&disp_refr->sync_areas);
-        while(sync_area != NULL) {
-            /*Get next sync area*/
-            next_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area);
-
-            /*Remove intersect of redraw area from sync area and get remaining areas*/
-            res_c = lv_area_diff(res, sync_area, &disp_refr->inv_areas[i]);
-
-            /*New sub areas created after removing intersect*/
-            if(res_c != -1) {
-                /*Replace old sync area with new areas*/
-                for(j = 0; j < res_c; j++) {
-                    new_area = lv_ll_ins_prev(&disp_refr->sync_areas, sync_area);
-                    *new_area = res[j];
-                }
-                lv_ll_remove(&disp_refr->sync_areas, sync_area);
-                lv_free(sync_area);
+            int32_t row_end = row;
+            while(row_end + 1 < rows &&
+                  sync_tiles_range_is_set(disp_refr->sync_tiles + (row_end + 1) * words, col, col_end)) {
+                row_end++;
             }
 
-            /*Move on to next sync area*/
-            sync_area = next_area;
-        }
-    }
+            lv_area_t sync_area;
+            sync_area.x1 = col * LV_DISPLAY_SYNC_TILE_SIZE;
+            sync_area.y1 = row * LV_DISPLAY_SYNC_TILE_SIZE;
+            sync_area.x2 = (col_end + 1) * LV_DISPLAY_SYNC_TILE_SIZE - 1;
+            sync_area.y2 = (row_end + 1) * LV_DISPLAY_SYNC_TILE_SIZE - 1;
+            sync_tiles_set_area(disp_refr, &sync_area, false, false);
+            col = col_end + 1;
 
-    lv_area_t disp_area = {0, 0, (int32_t)hor_res - 1, (int32_t)ver_res - 1};
-    /*Copy sync areas (if any remaining)*/
-    for(sync_area = lv_ll_get_head(&disp_refr->sync_areas); sync_area != NULL;
-        sync_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area)) {
-        /**
-         * @todo Resize SDL window will trigger crash because of sync_area is larger than disp_area
-         */
-        if(!lv_area_intersect(sync_area, sync_area, &disp_area)) {
-            continue;
-        }
+            if(!lv_area_intersect(&sync_area, &sync_area, &disp_area)) continue;
+
+            uint32_t copy_size = lv_area_get_size(&sync_area) * px_size;
 #if LV_DRAW_TRANSFORM_USE_MATRIX
-        if(lv_display_get_matrix_rotation(disp_refr)) {
-            lv_display_rotate_area(disp_refr, sync_area);
-        }
+            if(lv_display_get_matrix_rotation(disp_refr)) {
+                lv_display_rotate_area(disp_refr, &sync_area);
+            }
 #endif
-        lv_draw_buf_copy(off_screen, sync_area, on_screen, sync_area);
-        if(off_screen2 != on_screen)
-            lv_draw_buf_copy(off_screen2, sync_area, on_screen, sync_area);
+            lv_draw_buf_copy(off_screen, &sync_area, on_screen, &sync_area);
+            disp_refr->sync_stats.sync_copied_bytes += copy_size;
+            disp_refr->sync_stats.sync_copy_cnt++;
+            if(off_screen2 != on_screen) {
+                lv_draw_buf_copy(off_screen2, &sync_area, on_screen, &sync_area);
+                disp_refr->sync_stats.sync_copied_bytes += copy_size;
+                disp_refr->sync_stats.sync_copy_cnt++;
+            }
+        }
     }
 
-    /*Clear sync areas*/
-    lv_ll_clear(&disp_refr->sync_areas);
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Allocate the sync tile bitmap of a display for its current resolution.
+ * The tiles are cleared if the resolution has changed.
+ * @param disp      pointer to a display
+ * @return          true: the bitmap is ready to use
+ */
+static bool sync_tiles_prepare(lv_display_t * disp)
+{
+    int32_t cols = (lv_display_get_horizontal_resolution(disp) + LV_DISPLAY_SYNC_TILE_SIZE - 1) /
+                   LV_DISPLAY_SYNC_TILE_SIZE;
+    int32_t rows = (lv_display_get_vertical_resolution(disp) + LV_DISPLAY_SYNC_TILE_SIZE - 1) /
+                   LV_DISPLAY_SYNC_TILE_SIZE;
+
+    if(disp->sync_tiles && disp->sync_tile_cols == cols && disp->sync_tile_rows == rows) return true;
+
+    /*The whole screen is redrawn on resolution change, so the old tiles can be dropped*/
+    lv_free(disp->sync_tiles);
+    disp->sync_tile_cols = 0;
+    disp->sync_tile_rows = 0;
+    disp->sync_tiles = lv_malloc_zeroed(((cols + 31) / 32) * rows * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(disp->sync_tiles);
+    if(disp->sync_tiles == NULL) return false;
+
+    disp->sync_tile_cols = (uint16_t)cols;
+    disp->sync_tile_rows = (uint16_t)rows;
+    return true;
+}
+
+/**
+ * Set or clear the sync tiles of an area
+ * @param disp          pointer to a display
+ * @param area          the area in display coordinates
+ * @param en            true: set the tiles; false: clear them
+ * @param covered_only  true: skip the tiles which are only partially covered by `area`
+ */
+static void sync_tiles_set_area(lv_display_t * disp, const lv_area_t * area, bool en, bool covered_only)
+{
+    int32_t cols = disp->sync_tile_cols;
+    int32_t rows = disp->sync_tile_rows;
+    int32_t words = (cols + 31) / 32;
+    int32_t x1 = LV_MAX(area->x1, 0);
+    int32_t y1 = LV_MAX(area->y1, 0);
+    int32_t x2 = area->x2;
+    int32_t y2 = area->y2;
+
+    int32_t col_start = x1 / LV_DISPLAY_SYNC_TILE_SIZE;
+    int32_t row_start = y1 / LV_DISPLAY_SYNC_TILE_SIZE;
+    int32_t col_end = x2 / LV_DISPLAY_SYNC_TILE_SIZE;
+    int32_t row_end = y2 / LV_DISPLAY_SYNC_TILE_SIZE;
+
+    if(covered_only) {
+        /*The tiles on the right and bottom edge of the display are smaller than the others*/
+        int32_t hor_res = lv_display_get_horizontal_resolution(disp);
+        int32_t ver_res = lv_display_get_vertical_resolution(disp);
+        if(x1 % LV_DISPLAY_SYNC_TILE_SIZE) col_start++;
+        if(y1 % LV_DISPLAY_SYNC_TILE_SIZE) row_start++;
+        if(x2 < hor_res - 1 && (x2 + 1) % LV_DISPLAY_SYNC_TILE_SIZE) col_end--;
+        if(y2 < ver_res - 1 && (y2 + 1) % LV_DISPLAY_SYNC_TILE_SIZE) row_end--;
+    }
+
+    col_end = LV_MIN(col_end, cols - 1);
+    row_end = LV_MIN(row_end, rows - 1);
+
+    int32_t row;
+    for(row = row_start; row <= row_end; row++) {
+        uint32_t * row_bits = disp->sync_tiles + row * words;
+        int32_t col;
+        for(col = col_start; col <= col_end; col++) {
+            uint32_t mask = (uint32_t)1 << (col % 32);
+            if(en) row_bits[col / 32] |= mask;
+            else row_bits[col / 32] &= ~mask;
+        }
+    }
+}
+
+static bool sync_tiles_range_is_set(const uint32_t * row_bits, int32_t col_start, int32_t col_end)
+{
+    int32_t col;
+    for(col = col_start; col <= col_end; col++) {
+        if((row_bits[col / 32] & ((uint32_t)1 << (col % 32))) == 0) return false;
+    }
+
+    return true;
+}
+
 /**
  * Refresh the joined areas
  */
@@ -1195,6 +1509,690 @@ static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area)
     else return true;
 }
 
+/**
+ * Draw the children of a widget from the oldest to the youngest.
+ * With `LV_REFR_OCCLUSION_CULLING` the children covered by opaque younger siblings are skipped
+ * or drawn only where they are not covered.
+ * @param layer     the layer to draw to
+ * @param obj       pointer to the parent widget
+ */
+static void redraw_children(lv_layer_t * layer, lv_obj_t * obj)
+{
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+
+#if LV_REFR_OCCLUSION_CULLING
+    occluder_t occluders[OCCLUDER_MAX];
+    uint32_t occluder_cnt = occluders_collect(layer, obj, occluders);
+    if(occluder_cnt) {
+        const lv_area_t clip_area_ori = layer->_clip_area;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(occlusion_clip_child(layer, child, i, occluders, occluder_cnt)) {
+                lv_obj_refr(layer, child);
+            }
+            layer->_clip_area = clip_area_ori;
+        }
+        return;
+    }
+#endif
+
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        lv_obj_refr(layer, child);
+    }
+}
+
+#if LV_REFR_OCCLUSION_CULLING
+
+/**
+ * Find the largest areas on the current clip area which are fully covered by a child
+ * @param layer         the layer to draw to
+ * @param obj           pointer to the parent widget
+ * @param occluders     store the found areas here. Should be an `OCCLUDER_MAX` long array
+ * @return              number of areas found
+ */
+static uint32_t occluders_collect(lv_layer_t * layer, lv_obj_t * obj, occluder_t * occluders)
+{
+    /*The children are not opaque on a transparent or transformed layer*/
+    if(layer->opa < LV_OPA_MAX) return 0;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity(&layer->matrix)) return 0;
+#endif
+
+    uint32_t occluder_cnt = 0;
+    int32_t child_cnt = lv_obj_get_child_count(obj);
+    int32_t i;
+    /*The oldest child can't cover anything*/
+    for(i = child_cnt - 1; i > 0; i--) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+        if(lv_obj_get_layer_type(child) != LV_LAYER_TYPE_NONE) continue;
+        if(lv_obj_get_style_opa(child, LV_PART_MAIN) < LV_OPA_MAX) continue;
+        /*Quick filter for the most common transparent widgets before the cover check*/
+        if(lv_obj_get_style_bg_opa(child, LV_PART_MAIN) < LV_OPA_MAX) continue;
+
+        /*Leave out the rounded corners along the shorter side*/
+        lv_area_t area = child->coords;
+        int32_t w = lv_area_get_width(&area);
+        int32_t h = lv_area_get_height(&area);
+        int32_t r = lv_obj_get_style_radius(child, LV_PART_MAIN);
+        r = LV_MIN(r, LV_MIN(w, h) / 2);
+        if(w >= h) {
+            area.x1 += r;
+            area.x2 -= r;
+        }
+        else {
+            area.y1 += r;
+            area.y2 -= r;
+        }
+
+        if(!lv_area_intersect(&area, &area, &layer->_clip_area)) continue;
+
+        /*Replace the smallest one if there is no more space*/
+        uint32_t size = lv_area_get_size(&area);
+        uint32_t slot = occluder_cnt;
+        if(occluder_cnt == OCCLUDER_MAX) {
+            uint32_t k;
+            slot = 0;
+            for(k = 1; k < OCCLUDER_MAX; k++) {
+                if(lv_area_get_size(&occluders[k].area) < lv_area_get_size(&occluders[slot].area)) slot = k;
+            }
+            if(size <= lv_area_get_size(&occluders[slot].area)) continue;
+        }
+
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = &area;
+        lv_obj_send_event(child, LV_EVENT_COVER_CHECK, &info);
+        if(info.res != LV_COVER_RES_COVER) continue;
+
+        occluders[slot].area = area;
+        occluders[slot].child_id = i;
+        if(slot == occluder_cnt) occluder_cnt++;
+    }
+
+    return occluder_cnt;
+}
+
+/**
+ * Reduce the clip area of the layer to the part of a child which is not covered by
+ * its opaque younger siblings.
+ * @param layer         the layer to draw to. Its clip area is modified.
+ * @param child         pointer to a child widget
+ * @param child_id      index of the child in its parent
+ * @param occluders     the opaque areas of the children
+ * @param occluder_cnt  number of elements in `occluders`
+ * @return              true: the child should be drawn; false: it's fully covered
+ */
+static bool occlusion_clip_child(lv_layer_t * layer, lv_obj_t * child, uint32_t child_id,
+                                 const occluder_t * occluders, uint32_t occluder_cnt)
+{
+    /*Transformed widgets can be drawn outside of their area*/
+    if(lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) return true;
+
+    lv_area_t draw_area;
+    lv_obj_get_coords(child, &draw_area);
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(child);
+    lv_area_increase(&draw_area, ext_draw_size, ext_draw_size);
+    if(!lv_area_intersect(&draw_area, &draw_area, &layer->_clip_area)) return true;
+
+    const uint32_t size_ori = lv_area_get_size(&draw_area);
+    uint32_t k;
+    for(k = 0; k < occluder_cnt; k++) {
+        /*Only the younger siblings are drawn on top of the child*/
+        if(occluders[k].child_id <= child_id) continue;
+
+        const lv_area_t * occ = &occluders[k].area;
+        if(lv_area_is_in(&draw_area, occ, 0)) {
+            if(disp_refr) {
+                disp_refr->occlusion_stats.culled_cnt++;
+                disp_refr->occlusion_stats.culled_px += size_ori;
+                disp_refr->occlusion_stats.frame_culled_px += size_ori;
+            }
+            return false;
+        }
+
+        /*Cut off the covered part if the occluder spans the full width or height*/
+        if(occ->x1 <= draw_area.x1 && occ->x2 >= draw_area.x2) {
+            if(occ->y1 <= draw_area.y1 && occ->y2 >= draw_area.y1) draw_area.y1 = occ->y2 + 1;
+            else if(occ->y1 <= draw_area.y2 && occ->y2 >= draw_area.y2) draw_area.y2 = occ->y1 - 1;
+        }
+        else if(occ->y1 <= draw_area.y1 && occ->y2 >= draw_area.y2) {
+            if(occ->x1 <= draw_area.x1 && occ->x2 >= draw_area.x1) draw_area.x1 = occ->x2 + 1;
+            else if(occ->x1 <= draw_area.x2 && occ->x2 >= draw_area.x2) draw_area.x2 = occ->x1 - 1;
+        }
+    }
+
+    uint32_t size = lv_area_get_size(&draw_area);
+    if(size != size_ori) {
+        if(disp_refr) {
+            disp_refr->occlusion_stats.clipped_cnt++;
+            disp_refr->occlusion_stats.culled_px += size_ori - size;
+            disp_refr->occlusion_stats.frame_culled_px += size_ori - size;
+        }
+        layer->_clip_area = draw_area;
+    }
+
+    return true;
+}
+
+#endif /*LV_REFR_OCCLUSION_CULLING*/
+
+#if LV_REFR_SCROLL_BLIT
+
+/**
+ * Move the pixels of the scrolled areas in the draw buffer and send them to the display.
+ * The areas which couldn't be moved were invalidated when scrolling.
+ */
+static void refr_scroll_blits(void)
+{
+    if(disp_refr->scroll_blit_cnt == 0) return;
+    LV_PROFILER_REFR_BEGIN;
+
+    /*Don't move the pixels while they are being sent to the display*/
+    wait_for_flushing(disp_refr);
+
+    lv_draw_buf_t * buf = disp_refr->buf_act;
+    uint32_t px_size = lv_color_format_get_size(disp_refr->color_format);
+    bool sync_tiles = lv_display_is_double_buffered(disp_refr) && sync_tiles_prepare(disp_refr);
+
+    uint32_t i;
+    for(i = 0; i < disp_refr->scroll_blit_cnt; i++) {
+        lv_display_scroll_blit_t * blit = &disp_refr->scroll_blits[i];
+
+        /*The pixels moved out of the area are dropped*/
+        lv_area_t dest = blit->area;
+        lv_area_move(&dest, blit->dx, blit->dy);
+        if(!lv_area_intersect(&dest, &dest, &blit->area)) continue;
+
+        /*Nothing to move if the area is fully redrawn anyway*/
+        uint32_t j;
+        for(j = 0; j < disp_refr->inv_p; j++) {
+            if(disp_refr->inv_area_joined[j]) continue;
+            if(lv_area_is_in(&dest, &disp_refr->inv_areas[j], 0)) break;
+        }
+        if(j < disp_refr->inv_p) continue;
+
+        int32_t w = lv_area_get_width(&dest);
+        int32_t h = lv_area_get_height(&dest);
+        int32_t y;
+        for(y = 0; y < h; y++) {
+            /*Start from the bottom when moving down to not overwrite the source lines*/
+            int32_t row = blit->dy > 0 ? dest.y1 + h - 1 - y : dest.y1 + y;
+            uint8_t * dest_p = lv_draw_buf_goto_xy(buf, dest.x1, row);
+            uint8_t * src_p = lv_draw_buf_goto_xy(buf, dest.x1 - blit->dx, row - blit->dy);
+            lv_memmove(dest_p, src_p, w * px_size);
+        }
+
+        disp_refr->sync_stats.scroll_blit_bytes += (uint64_t)w * h * px_size;
+        disp_refr->sync_stats.scroll_blit_cnt++;
+        if(sync_tiles) sync_tiles_set_area(disp_refr, &dest, true, false);
+
+        if(disp_refr->flush_cb) {
+            wait_for_flushing(disp_refr);
+            disp_refr->flushing = 1;
+            disp_refr->flushing_last = 0;
+            call_flush_cb(disp_refr, &dest, buf->data);
+        }
+    }
+
+    disp_refr->scroll_blit_cnt = 0;
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Get the area of a scrolled widget whose pixels can be moved with its children
+ * @param obj           pointer to the scrolled widget
+ * @param visible_area  store the visible area of the widget here
+ * @param blit_area     store the area to move here
+ * @return              false: the pixels of the widget can't be moved
+ */
+static bool scroll_blit_get_area(lv_obj_t * obj, lv_area_t * visible_area, lv_area_t * blit_area)
+{
+    lv_display_t * disp = lv_obj_get_display(obj);
+    if(disp == NULL || disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) return false;
+    if(lv_display_get_rotation(disp) != LV_DISPLAY_ROTATION_0) return false;
+    if(lv_color_format_get_bpp(disp->color_format) < 8) return false;
+    if(!lv_display_is_invalidation_enabled(disp)) return false;
+    if(disp->prev_scr || lv_obj_get_screen(obj) != disp->act_scr) return false;
+
+    /*Only the plain background of the base widget moves together with the children*/
+    if(!scroll_blit_class_is_plain(obj)) return false;
+    if(lv_obj_has_flag_any(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE | LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) return false;
+    if(scroll_blit_has_draw_event(obj, LV_EVENT_DRAW_MAIN_BEGIN)) return false;
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) != LV_OPA_COVER) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_grad(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_blur_radius(obj, LV_PART_MAIN) > 0) return false;
+    if(lv_obj_get_style_transform_width(obj, LV_PART_MAIN) != 0) return false;
+    if(lv_obj_get_style_transform_height(obj, LV_PART_MAIN) != 0) return false;
+    if(lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) != LV_OPA_COVER) return false;
+
+    /*The parents shouldn't draw over or instead of the children in their own way*/
+    lv_obj_t * parent = obj;
+    while(parent) {
+        if(lv_obj_get_layer_type(parent) != LV_LAYER_TYPE_NONE) return false;
+        if(!scroll_blit_class_is_plain(parent)) return false;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    *visible_area = obj->coords;
+    if(!lv_obj_area_is_visible(obj, visible_area)) return false;
+
+    /*Keep the border and the rounded corners in place*/
+    int32_t w = lv_obj_get_width(obj);
+    int32_t h = lv_obj_get_height(obj);
+    int32_t radius = LV_MIN(lv_obj_get_style_radius(obj, LV_PART_MAIN), LV_MIN(w, h) / 2);
+    int32_t inset = LV_MAX(lv_obj_get_style_border_width(obj, LV_PART_MAIN), radius);
+    *blit_area = obj->coords;
+    lv_area_increase(blit_area, -inset, -inset);
+
+    return lv_area_intersect(blit_area, blit_area, visible_area);
+}
+
+/**
+ * Check if a widget is drawn only by the base widget class
+ * @param obj   pointer to a widget
+ * @return      true: none of the widget's classes has its own event handler
+ */
+static bool scroll_blit_class_is_plain(const lv_obj_t * obj)
+{
+    const lv_obj_class_t * class_p = obj->class_p;
+    while(class_p && class_p != &lv_obj_class) {
+        if(class_p->event_cb) return false;
+        class_p = class_p->base_class;
+    }
+
+    return true;
+}
+
+/**
+ * Check if a widget has a user event callback which can draw on the widget
+ * @param obj           pointer to a widget
+ * @param first_code    the first draw event to consider
+ * @return              true: the widget can be drawn by a callback
+ */
+static bool scroll_blit_has_draw_event(lv_obj_t * obj, lv_event_code_t first_code)
+{
+    uint32_t cnt = lv_obj_get_event_count(obj);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_event_dsc_t * dsc = lv_obj_get_event_dsc(obj, i);
+        uint32_t code = dsc->filter & ~LV_EVENT_PREPROCESS;
+        if(code == LV_EVENT_ALL) return true;
+        if(code >= (uint32_t)first_code && code <= LV_EVENT_DRAW_TASK_ADDED) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Collect the areas which are drawn over a scrolled widget but don't move with its children:
+ * the scrollbars, the floating children, the younger siblings of the widget and its parents
+ * and the widgets on the top and system layers.
+ * @param obj           pointer to the scrolled widget
+ * @param blit_area     the area to move
+ * @param areas         store the areas here
+ * @param cnt           store the number of areas here
+ * @return              false: there are too many areas or they can't be determined
+ */
+static bool scroll_blit_collect_static(lv_obj_t * obj, const lv_area_t * blit_area, lv_area_t * areas,
+                                       uint32_t * cnt)
+{
+    /*The scrollbars of the scrolled widget are redrawn along the whole side*/
+    lv_area_t hor_area;
+    lv_area_t ver_area;
+    lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+    if(lv_area_get_size(&hor_area) > 0) {
+        hor_area.x1 = obj->coords.x1;
+        hor_area.x2 = obj->coords.x2;
+        if(!scroll_blit_add_area(&hor_area, blit_area, areas, cnt)) return false;
+    }
+    if(lv_area_get_size(&ver_area) > 0) {
+        ver_area.y1 = obj->coords.y1;
+        ver_area.y2 = obj->coords.y2;
+        if(!scroll_blit_add_area(&ver_area, blit_area, areas, cnt)) return false;
+    }
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(!lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING)) continue;
+        if(!scroll_blit_add_obj(child, blit_area, areas, cnt)) return false;
+    }
+
+    lv_obj_t * child = obj;
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(parent) {
+        if(lv_obj_get_style_border_post(parent, LV_PART_MAIN)) return false;
+        if(scroll_blit_has_draw_event(parent, LV_EVENT_DRAW_POST_BEGIN)) return false;
+
+        lv_obj_get_scrollbar_area(parent, &hor_area, &ver_area);
+        if(!scroll_blit_add_area(&hor_area, blit_area, areas, cnt)) return false;
+        if(!scroll_blit_add_area(&ver_area, blit_area, areas, cnt)) return false;
+
+        child_cnt = lv_obj_get_child_count(parent);
+        for(i = (uint32_t)lv_obj_get_index(child) + 1; i < child_cnt; i++) {
+            if(!scroll_blit_add_obj(parent->spec_attr->children[i], blit_area, areas, cnt)) return false;
+        }
+
+        child = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    lv_display_t * disp = lv_obj_get_display(obj);
+    lv_obj_t * layers[2] = {disp->top_layer, disp->sys_layer};
+    uint32_t l;
+    for(l = 0; l < 2; l++) {
+        if(layers[l] == NULL) continue;
+        if(lv_obj_get_style_bg_opa(layers[l], LV_PART_MAIN) > LV_OPA_MIN) return false;
+        child_cnt = lv_obj_get_child_count(layers[l]);
+        for(i = 0; i < child_cnt; i++) {
+            if(!scroll_blit_add_obj(layers[l]->spec_attr->children[i], blit_area, areas, cnt)) return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Add the drawn area of a widget to the areas which don't move with a scrolled widget
+ * @param obj           pointer to a widget drawn over the scrolled widget
+ * @param blit_area     the area to move
+ * @param areas         the collected areas
+ * @param cnt           number of the collected areas
+ * @return              false: there are too many areas or the area can't be determined
+ */
+static bool scroll_blit_add_obj(lv_obj_t * obj, const lv_area_t * blit_area, lv_area_t * areas, uint32_t * cnt)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return true;
+
+    /*The children can be drawn anywhere*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    lv_area_t area = obj->coords;
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&area, ext_size, ext_size);
+    lv_obj_get_transformed_area(obj, &area, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+
+    return scroll_blit_add_area(&area, blit_area, areas, cnt);
+}
+
+/**
+ * Add an area which doesn't move with a scrolled widget
+ * @param area          the area to add. Only its part on `blit_area` is saved.
+ * @param blit_area     the area to move
+ * @param areas         the collected areas
+ * @param cnt           number of the collected areas
+ * @return              false: there are too many areas
+ */
+static bool scroll_blit_add_area(const lv_area_t * area, const lv_area_t * blit_area, lv_area_t * areas,
+                                 uint32_t * cnt)
+{
+    lv_area_t a;
+    if(!lv_area_intersect(&a, area, blit_area)) return true;
+
+    uint32_t i;
+    for(i = 0; i < *cnt; i++) {
+        if(lv_area_is_in(&a, &areas[i], 0)) return true;
+    }
+
+    if(*cnt >= SCROLL_BLIT_STATIC_MAX) return false;
+    areas[*cnt] = a;
+    (*cnt)++;
+    return true;
+}
+
+/**
+ * Invalidate the place of an area's pixels after they are moved
+ * @param disp          pointer to a display
+ * @param area          the area whose pixels are moved
+ * @param blit_area     the area to move
+ * @param dx            horizontal offset
+ * @param dy            vertical offset
+ */
+static void scroll_blit_inv_moved(lv_display_t * disp, const lv_area_t * area, const lv_area_t * blit_area,
+                                  int32_t dx, int32_t dy)
+{
+    lv_area_t moved;
+    if(!lv_area_intersect(&moved, area, blit_area)) return;
+
+    lv_area_move(&moved, dx, dy);
+    if(lv_area_intersect(&moved, &moved, blit_area)) lv_inv_area(disp, &moved);
+}
+
+#endif /*LV_REFR_SCROLL_BLIT*/
+
+/**
+ * Draw a widget having `LV_OBJ_FLAG_CACHE_LAYER` from its cached bitmap.
+ * Render the bitmap first if it's missing or outdated.
+ * @param layer     the layer to draw to
+ * @param obj       pointer to a widget
+ * @return          true: the widget was drawn; false: the widget should be drawn directly
+ */
+static bool refr_obj_cache_layer(lv_layer_t * layer, lv_obj_t * obj)
+{
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_LAYER)) return false;
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    /*Draw transformed widgets directly to not lose quality by transforming the bitmap*/
+    if(!lv_matrix_is_identity(&layer->matrix)) return false;
+#endif
+
+    lv_area_t cache_area;
+    lv_obj_get_coords(obj, &cache_area);
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&cache_area, ext_draw_size, ext_draw_size);
+
+    /*Don't render the widgets which are not visible now*/
+    lv_area_t clipped_area;
+    if(!lv_area_intersect(&clipped_area, &layer->_clip_area, &cache_area)) return false;
+
+    LV_PROFILER_REFR_BEGIN;
+    uint32_t w = lv_area_get_width(&cache_area);
+    uint32_t h = lv_area_get_height(&cache_area);
+    lv_refr_cache_layer_t * cache = cache_layer_find(obj);
+    if(cache && cache->valid && cache->opa == layer->opa && lv_color32_eq(cache->recolor, layer->recolor) &&
+       cache->draw_buf->header.w == w && cache->draw_buf->header.h == h) {
+        cache_layer_stats.hit_cnt++;
+    }
+    else {
+        cache_layer_stats.miss_cnt++;
+
+        /*The draw tasks of this cycle might still use the bitmap so draw directly until the next cycle*/
+        if(cache && cache->frame_id == cache_layer_frame_id) {
+            LV_PROFILER_REFR_END;
+            return false;
+        }
+
+        /*Save memory and blending time if the widget fully covers its area*/
+        lv_color_format_t cf = LV_COLOR_FORMAT_ARGB8888;
+        if(layer->opa >= LV_OPA_MAX && !alpha_test_area_on_obj(obj, &cache_area)) {
+            lv_color_format_t disp_cf = lv_display_get_color_format(lv_obj_get_display(obj));
+            if(disp_cf == LV_COLOR_FORMAT_RGB565 || disp_cf == LV_COLOR_FORMAT_RGB888 ||
+               disp_cf == LV_COLOR_FORMAT_XRGB8888) {
+                cf = disp_cf;
+            }
+        }
+
+        if(cache && (cache->draw_buf->header.w != w || cache->draw_buf->header.h != h ||
+                     cache->draw_buf->header.cf != cf)) {
+            lv_refr_cache_layer_drop(obj);
+            cache = NULL;
+        }
+
+        if(cache == NULL) {
+            if(!cache_layer_make_room(lv_draw_buf_width_to_stride(w, cf) * h)) {
+                LV_PROFILER_REFR_END;
+                return false;
+            }
+
+            lv_draw_buf_t * draw_buf = lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
+            if(draw_buf == NULL) {
+                LV_LOG_WARN("Couldn't allocate the cache layer, drawing directly");
+                LV_PROFILER_REFR_END;
+                return false;
+            }
+
+            cache = lv_ll_ins_head(&cache_layer_ll);
+            LV_ASSERT_MALLOC(cache);
+            if(cache == NULL) {
+                lv_draw_buf_destroy(draw_buf);
+                LV_PROFILER_REFR_END;
+                return false;
+            }
+
+            lv_memzero(cache, sizeof(lv_refr_cache_layer_t));
+            cache->obj = obj;
+            cache->draw_buf = draw_buf;
+            cache_layer_stats.entry_cnt++;
+            cache_layer_stats.used_size += draw_buf->data_size;
+            cache_layer_stats.used_peak = LV_MAX(cache_layer_stats.used_peak, cache_layer_stats.used_size);
+        }
+
+        cache_layer_render(cache, layer, &cache_area);
+    }
+
+    /*Keep the list ordered by the last use*/
+    lv_refr_cache_layer_t * head = lv_ll_get_head(&cache_layer_ll);
+    if(head != cache) lv_ll_move_before(&cache_layer_ll, cache, head);
+    cache->frame_id = cache_layer_frame_id;
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.base.layer = layer;
+    img_dsc.src = cache->draw_buf;
+
+    /*The opacity is already applied on the bitmap*/
+    const lv_opa_t layer_opa_ori = layer->opa;
+    layer->opa = LV_OPA_COVER;
+    lv_draw_image(layer, &img_dsc, &cache_area);
+    layer->opa = layer_opa_ori;
+
+    LV_PROFILER_REFR_END;
+    return true;
+#else
+    LV_UNUSED(layer);
+    LV_UNUSED(obj);
+    return false;
+#endif
+}
+
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+
+/**
+ * Render a widget with its children to its cached bitmap and wait until it's ready.
+ * @param cache         pointer to the cache entry of the widget
+ * @param parent_layer  the layer where the bitmap will be drawn. Its opacity and recolor are used.
+ * @param cache_area    the absolute coordinates of the bitmap
+ */
+static void cache_layer_render(lv_refr_cache_layer_t * cache, lv_layer_t * parent_layer, const lv_area_t * cache_area)
+{
+    LV_PROFILER_REFR_BEGIN;
+
+    /*The old content might be cached by the image decoders*/
+    lv_image_cache_drop(cache->draw_buf);
+    lv_draw_buf_clear(cache->draw_buf, NULL);
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = cache->draw_buf;
+    layer.buf_area = *cache_area;
+    layer.color_format = cache->draw_buf->header.cf;
+    layer._clip_area = *cache_area;
+    layer.phy_clip_area = *cache_area;
+    layer.opa = parent_layer->opa;
+    layer.recolor = parent_layer->recolor;
+
+    /*Set it before rendering to not lose the invalidations made during rendering*/
+    cache->valid = 1;
+    cache->opa = parent_layer->opa;
+    cache->recolor = parent_layer->recolor;
+    cache->rendering = 1;
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_CREATED, &layer);
+
+    /*Dispatch only the tasks of the new layer like `lv_snapshot_take_to_draw_buf()`*/
+    lv_display_t * disp = lv_obj_get_display(cache->obj);
+    lv_display_t * disp_old = disp_refr;
+    lv_layer_t * layer_head_old = disp->layer_head;
+    disp->layer_head = &layer;
+    disp_refr = disp;
+
+    lv_obj_redraw(&layer, cache->obj);
+
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    disp->layer_head = layer_head_old;
+    disp_refr = disp_old;
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_DELETED, &layer);
+    cache->rendering = 0;
+
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Free the least recently used bitmaps until a new bitmap fits into `LV_OBJ_CACHE_LAYER_MAX_MEMORY`
+ * @param size      size of the new bitmap in bytes
+ * @return          true: there is enough memory for the new bitmap
+ */
+static bool cache_layer_make_room(uint32_t size)
+{
+    if(size > LV_OBJ_CACHE_LAYER_MAX_MEMORY) return false;
+
+    lv_refr_cache_layer_t * cache = lv_ll_get_tail(&cache_layer_ll);
+    while(cache && cache_layer_stats.used_size + size > LV_OBJ_CACHE_LAYER_MAX_MEMORY) {
+        lv_refr_cache_layer_t * cache_prev = lv_ll_get_prev(&cache_layer_ll, cache);
+        /*The bitmaps being rendered or drawn in this cycle are still in use*/
+        if(!cache->rendering && cache->frame_id != cache_layer_frame_id) {
+            lv_refr_cache_layer_drop(cache->obj);
+            cache_layer_stats.evict_cnt++;
+        }
+        cache = cache_prev;
+    }
+
+    return cache_layer_stats.used_size + size <= LV_OBJ_CACHE_LAYER_MAX_MEMORY;
+}
+
+/**
+ * Get the cache entry of a widget
+ * @param obj       pointer to a widget
+ * @return          the cache entry or NULL if the widget's bitmap is not cached
+ */
+static lv_refr_cache_layer_t * cache_layer_find(const lv_obj_t * obj)
+{
+    lv_refr_cache_layer_t * cache;
+    LV_LL_READ(&cache_layer_ll, cache) {
+        if(cache->obj == obj) return cache;
+    }
+
+    return NULL;
+}
+
+/**
+ * Free the bitmap of a cache entry
+ * @param cache     pointer to a cache entry
+ */
+static void cache_layer_free_buf(lv_refr_cache_layer_t * cache)
+{
+    if(cache->draw_buf == NULL) return;
+
+    lv_image_cache_drop(cache->draw_buf);
+    cache_layer_stats.used_size -= LV_MIN(cache_layer_stats.used_size, cache->draw_buf->data_size);
+    lv_draw_buf_destroy(cache->draw_buf);
+    cache->draw_buf = NULL;
+}
+
+#endif /*LV_OBJ_CACHE_LAYER_MAX_MEMORY*/
+
 #if LV_DRAW_TRANSFORM_USE_MATRIX
 
 static bool obj_get_matrix(lv_obj_t * obj, lv_matrix_t * matrix)
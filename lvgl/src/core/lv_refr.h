@@ -25,6 +25,16 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Statistics of the bitmaps cached for the widgets having `LV_OBJ_FLAG_CACHE_LAYER`*/
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of times a widget was drawn from its cached bitmap */
+    uint32_t miss_cnt;      /**< Number of times a widget's bitmap had to be (re)rendered */
+    uint32_t evict_cnt;     /**< Number of bitmaps freed to fit into `LV_OBJ_CACHE_LAYER_MAX_MEMORY` */
+    uint32_t entry_cnt;     /**< Number of the currently cached bitmaps */
+    uint32_t used_size;     /**< Bytes of the currently cached bitmaps */
+    uint32_t used_peak;     /**< Max. of `used_size` */
+} lv_refr_cache_layer_stats_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -63,6 +73,19 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj);
  */
 void lv_display_refr_timer(lv_timer_t * timer);
 
+/**
+ * Get the statistics of the bitmaps cached for the widgets having `LV_OBJ_FLAG_CACHE_LAYER`.
+ * All values are 0 if `LV_OBJ_CACHE_LAYER_MAX_MEMORY` is 0.
+ * @param stats     pointer to a structure to store the statistics
+ */
+void lv_refr_cache_layer_get_stats(lv_refr_cache_layer_stats_t * stats);
+
+/**
+ * Free all the bitmaps cached for the widgets having `LV_OBJ_FLAG_CACHE_LAYER`.
+ * They will be rendered again when they are redrawn.
+ */
+void lv_refr_cache_layer_flush(void);
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -24,6 +24,20 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+/** The cached bitmap of a widget having `LV_OBJ_FLAG_CACHE_LAYER`*/
+struct _lv_refr_cache_layer_t {
+    lv_obj_t * obj;                 /**< The widget whose bitmap is cached*/
+    lv_draw_buf_t * draw_buf;       /**< The rendered widget with its children*/
+    uint32_t frame_id;              /**< The last refresh cycle in which the bitmap was drawn*/
+    lv_color32_t recolor;           /**< The layer's recolor used for rendering*/
+    lv_opa_t opa;                   /**< The layer's opacity used for rendering*/
+    uint8_t valid : 1;              /**< 0: something has changed in the subtree since rendering*/
+    uint8_t rendering : 1;          /**< 1: the bitmap is being rendered now, it can't be evicted*/
+};
+#endif
+
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -74,6 +88,30 @@ lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
  */
 void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj);
 
+/**
+ * Mark the cached bitmaps of a widget and its parents as outdated
+ * as something has changed on the widget.
+ * @param obj   pointer to a widget
+ */
+void lv_refr_cache_layer_invalidate(const lv_obj_t * obj);
+
+/**
+ * Free the cached bitmap of a widget
+ * @param obj   pointer to a widget
+ */
+void lv_refr_cache_layer_drop(lv_obj_t * obj);
+
+/**
+ * Move the pixels of a scrolled widget in the draw buffer on the next refresh
+ * and invalidate only the areas which can't be moved.
+ * Works only with `LV_REFR_SCROLL_BLIT` in `LV_DISPLAY_RENDER_MODE_DIRECT`.
+ * @param obj   pointer to a widget whose children were scrolled
+ * @param dx    horizontal offset of the children
+ * @param dy    vertical offset of the children
+ * @return      true: the widget is invalidated; false: the widget needs to be invalidated fully
+ */
+bool lv_refr_scroll_blit(lv_obj_t * obj, int32_t dx, int32_t dy);
+
 /**********************
  *      MACROS
  **********************/
@@ -102,8 +102,6 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->inv_en_cnt = 1;
     disp->last_activity_time = lv_tick_get();
 
-    lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
-
     lv_display_t * disp_def_tmp = disp_def;
     disp_def                 = disp; /*Temporarily change the default screen to create the default screens on the
                                         new display*/
@@ -223,7 +221,8 @@ void lv_display_delete(lv_display_t * disp)
         lv_obj_delete(disp->screens[0]);
     }
 
-    lv_ll_clear(&disp->sync_areas);
+    lv_free(disp->sync_tiles);
+    disp->sync_tiles = NULL;
     lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
@@ -1280,6 +1279,46 @@ uint32_t lv_display_get_invalidated_draw_buf_size(lv_display_t * disp, uint32_t
     return buf_size;
 }
 
+void lv_display_get_sync_stats(lv_display_t * disp, lv_display_sync_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        lv_memzero(stats, sizeof(lv_display_sync_stats_t));
+        return;
+    }
+
+    *stats = disp->sync_stats;
+}
+
+void lv_display_reset_sync_stats(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_memzero(&disp->sync_stats, sizeof(lv_display_sync_stats_t));
+}
+
+void lv_display_get_occlusion_stats(lv_display_t * disp, lv_display_occlusion_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        lv_memzero(stats, sizeof(lv_display_occlusion_stats_t));
+        return;
+    }
+
+    *stats = disp->occlusion_stats;
+}
+
+void lv_display_reset_occlusion_stats(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    lv_memzero(&disp->occlusion_stats, sizeof(lv_display_occlusion_stats_t));
+}
+
 lv_obj_t * lv_screen_active(void)
 {
     return lv_display_get_screen_active(lv_display_get_default());
@@ -78,6 +78,26 @@ typedef enum {
     LV_SCREEN_LOAD_ANIM_OUT_BOTTOM,
 } lv_screen_load_anim_t;
 
+/** Counters of the pixel data written to the draw buffers of a display */
+typedef struct {
+    uint64_t rendered_bytes;        /**< Bytes of the redrawn areas */
+    uint64_t sync_copied_bytes;     /**< Bytes copied from the on-screen buffer to keep the buffers in sync
+                                     *   in double buffered `LV_DISPLAY_RENDER_MODE_DIRECT` */
+    uint32_t sync_copy_cnt;         /**< Number of rectangles copied for the sync */
+    uint64_t scroll_blit_bytes;     /**< Bytes moved in the draw buffer instead of redrawing the scrolled
+                                     *   areas with `LV_REFR_SCROLL_BLIT` */
+    uint32_t scroll_blit_cnt;       /**< Number of scrolled areas moved in the draw buffer */
+} lv_display_sync_stats_t;
+
+/** Counters of the drawing skipped by `LV_REFR_OCCLUSION_CULLING` on a display */
+typedef struct {
+    uint32_t culled_cnt;            /**< Number of times a widget was skipped as opaque siblings covered it */
+    uint32_t clipped_cnt;           /**< Number of times the drawn area of a widget was reduced as opaque
+                                     *   siblings covered a part of it */
+    uint64_t culled_px;             /**< Pixels not drawn because of the skipped and reduced widgets */
+    uint32_t frame_culled_px;       /**< `culled_px` of the last refresh only */
+} lv_display_occlusion_stats_t;
+
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
@@ -681,6 +701,36 @@ uint32_t lv_display_get_draw_buf_size(lv_display_t * disp);
  */
 uint32_t lv_display_get_invalidated_draw_buf_size(lv_display_t * disp, uint32_t width, uint32_t height);
 
+/**
+ * Get how many bytes were rendered and how many were copied to synchronize the buffers
+ * in double buffered direct mode since the display was created or the counters were reset.
+ * The bytes moved instead of redrawing the scrolled areas are counted here too.
+ * @param disp      pointer to a display
+ * @param stats     store the counters here
+ */
+void lv_display_get_sync_stats(lv_display_t * disp, lv_display_sync_stats_t * stats);
+
+/**
+ * Reset the counters of `lv_display_get_sync_stats()`
+ * @param disp      pointer to a display
+ */
+void lv_display_reset_sync_stats(lv_display_t * disp);
+
+/**
+ * Get how many widgets and pixels were not drawn as they were covered by opaque siblings
+ * since the display was created or the counters were reset.
+ * All values are 0 if `LV_REFR_OCCLUSION_CULLING` is disabled.
+ * @param disp      pointer to a display
+ * @param stats     store the counters here
+ */
+void lv_display_get_occlusion_stats(lv_display_t * disp, lv_display_occlusion_stats_t * stats);
+
+/**
+ * Reset the counters of `lv_display_get_occlusion_stats()`
+ * @param disp      pointer to a display
+ */
+void lv_display_reset_occlusion_stats(lv_display_t * disp);
+
 /**********************
  *      MACROS
  **********************/
@@ -33,10 +33,25 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
 #endif
 
+#ifndef LV_DISPLAY_SYNC_TILE_SIZE
+#define LV_DISPLAY_SYNC_TILE_SIZE 16 /**< Width and height of the tiles to track the areas to sync in direct mode */
+#endif
+
+#ifndef LV_DISPLAY_SCROLL_BLIT_CNT
+#define LV_DISPLAY_SCROLL_BLIT_CNT 4 /**< Number of scrolled areas to move in the draw buffer on the next refresh */
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/** A scrolled area whose pixels are moved in the draw buffer instead of redrawing them */
+typedef struct {
+    lv_area_t area;     /**< Move the pixels inside this area. The pixels moved out of it are dropped. */
+    int32_t dx;         /**< Horizontal offset of the pixels */
+    int32_t dy;         /**< Vertical offset of the pixels */
+} lv_display_scroll_blit_t;
+
 struct _lv_display_t {
 #if LV_USE_EXT_DATA
     lv_ext_data_t ext_data;
@@ -113,8 +128,19 @@ struct _lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
-    /** Double buffer sync areas (redrawn during last refresh) */
-    lv_ll_t sync_areas;
+    /** Double buffer sync: 1 bit for each tile redrawn during the last refresh.
+     *  The size of the tiles is `LV_DISPLAY_SYNC_TILE_SIZE`. */
+    uint32_t * sync_tiles;
+    uint16_t sync_tile_cols;
+    uint16_t sync_tile_rows;
+    lv_display_sync_stats_t sync_stats;
+    lv_display_occlusion_stats_t occlusion_stats;
+
+#if LV_REFR_SCROLL_BLIT
+    /** Scrolled areas to move in the draw buffer before the next refresh */
+    lv_display_scroll_blit_t scroll_blits[LV_DISPLAY_SCROLL_BLIT_CNT];
+    uint32_t scroll_blit_cnt;
+#endif
 
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
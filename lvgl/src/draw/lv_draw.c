@@ -64,6 +64,7 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+    lv_draw_buf_pool_init();
 }
 
 void lv_draw_deinit(void)
@@ -71,6 +72,7 @@ void lv_draw_deinit(void)
 #if LV_USE_OS
     lv_thread_sync_delete(&_draw_info.sync);
 #endif
+    lv_draw_buf_pool_deinit();
 
     lv_draw_unit_t * u = _draw_info.unit_head;
     while(u) {
@@ -499,7 +501,7 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     }
 #endif
 
-    layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+    layer->draw_buf = lv_draw_buf_pool_acquire(w, h, layer->color_format, 0);
 
     if(layer->draw_buf == NULL) {
         LV_LOG_WARN("Allocating layer buffer failed. Try later");
@@ -697,7 +699,7 @@ static void cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
                 LV_LOG_WARN("More layers were freed than allocated");
             }
             LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB", get_layer_size_kb(_draw_info.used_memory_for_layers));
-            lv_draw_buf_destroy(layer_drawn->draw_buf);
+            lv_draw_buf_pool_release(layer_drawn->draw_buf);
             layer_drawn->draw_buf = NULL;
         }
 
@@ -6,15 +6,23 @@
 /*********************
  *      INCLUDES
  *********************/
+#include "../misc/lv_area_private.h"
 #include "lv_draw_private.h"
 #include "lv_draw_blur.h"
 #include "../misc/lv_types.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/lv_math.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+/*Split only larger blurs as each stripe has some overhead*/
+#define BLUR_SPLIT_MIN_SIZE     (64 * 64)
+
+/*The stripes start at a common multiple of the pixel skipping of the SW blur (1, 2 or 3)*/
+#define BLUR_STRIPE_ALIGN       6
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -23,6 +31,11 @@
  *  STATIC PROTOTYPES
  **********************/
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+static void add_stripe_tasks(lv_layer_t * layer, const lv_draw_blur_dsc_t * dsc, const lv_area_t * coords,
+                             const lv_area_t * blur_area, lv_draw_blur_pass_t pass);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -52,6 +65,20 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_blur(lv_layer_t * layer, const lv_draw_blur_d
 
     LV_PROFILER_DRAW_BEGIN;
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+    /*The columns and rows are blurred independently, so let all SW draw threads
+     *blur a stripe of them. The row stripes wait for the column stripes as they overlap.*/
+    lv_area_t blur_area;
+    if(dsc->pass == LV_DRAW_BLUR_PASS_ALL &&
+       lv_area_intersect(&blur_area, coords, &layer->_clip_area) &&
+       lv_area_get_size(&blur_area) >= BLUR_SPLIT_MIN_SIZE) {
+        add_stripe_tasks(layer, dsc, coords, &blur_area, LV_DRAW_BLUR_PASS_COLUMNS);
+        add_stripe_tasks(layer, dsc, coords, &blur_area, LV_DRAW_BLUR_PASS_ROWS);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     lv_draw_task_t * t = lv_draw_add_task(layer, coords, LV_DRAW_TASK_TYPE_BLUR);
 
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
@@ -63,3 +90,47 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_blur(lv_layer_t * layer, const lv_draw_blur_d
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+/**
+ * Add a blur draw task for each stripe of the blurred area.
+ * @param layer         pointer to a layer
+ * @param dsc           the original blur descriptor
+ * @param coords        coordinates of the whole blurred area
+ * @param blur_area     `coords` clipped to the layer's clip area
+ * @param pass          LV_DRAW_BLUR_PASS_COLUMNS: vertical stripes, LV_DRAW_BLUR_PASS_ROWS: horizontal stripes
+ */
+static void add_stripe_tasks(lv_layer_t * layer, const lv_draw_blur_dsc_t * dsc, const lv_area_t * coords,
+                             const lv_area_t * blur_area, lv_draw_blur_pass_t pass)
+{
+    bool columns = pass == LV_DRAW_BLUR_PASS_COLUMNS;
+    int32_t start = columns ? blur_area->x1 : blur_area->y1;
+    int32_t end = columns ? blur_area->x2 : blur_area->y2;
+    int32_t ofs = columns ? layer->buf_area.x1 : layer->buf_area.y1;
+    int32_t stripe_len = (end - start + LV_DRAW_SW_DRAW_UNIT_CNT) / LV_DRAW_SW_DRAW_UNIT_CNT;
+
+    while(start <= end) {
+        /*Align the stripes to the layer's buffer as the SW blur aligns the skipped pixels to it*/
+        int32_t next = start + stripe_len - ofs;
+        next = ofs + ((next + BLUR_STRIPE_ALIGN - 1) / BLUR_STRIPE_ALIGN) * BLUR_STRIPE_ALIGN;
+
+        lv_area_t stripe = *blur_area;
+        if(columns) {
+            stripe.x1 = start;
+            stripe.x2 = LV_MIN(next - 1, end);
+        }
+        else {
+            stripe.y1 = start;
+            stripe.y2 = LV_MIN(next - 1, end);
+        }
+
+        lv_draw_task_t * t = lv_draw_add_task(layer, coords, LV_DRAW_TASK_TYPE_BLUR);
+        lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
+        ((lv_draw_blur_dsc_t *)t->draw_dsc)->pass = pass;
+        t->_real_area = stripe;
+        lv_draw_finalize_task_creation(layer, t);
+
+        start = next;
+    }
+}
+#endif
@@ -26,6 +26,12 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef enum {
+    LV_DRAW_BLUR_PASS_ALL = 0,      /**< Blur the columns and then the rows */
+    LV_DRAW_BLUR_PASS_COLUMNS,      /**< Blur only the columns */
+    LV_DRAW_BLUR_PASS_ROWS,         /**< Blur only the rows */
+} lv_draw_blur_pass_t;
+
 typedef struct {
     lv_draw_dsc_base_t base;
 
@@ -44,6 +50,12 @@ typedef struct {
      */
     lv_blur_quality_t quality;
 
+    /**
+     * Used internally when the blur is split into stripes to render them in parallel.
+     * Only the stripe in the draw task's `_real_area` is blurred in the given direction.
+     */
+    lv_draw_blur_pass_t pass;
+
 } lv_draw_blur_dsc_t;
 
 /**********************
@@ -12,6 +12,7 @@
 #include "../core/lv_global.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_area_private.h"
+#include "../misc/lv_ll.h"
 #include "convert/lv_draw_buf_convert.h"
 
 /*********************
@@ -20,6 +21,8 @@
 #define default_handlers LV_GLOBAL_DEFAULT()->draw_buf_handlers
 #define font_draw_buf_handlers LV_GLOBAL_DEFAULT()->font_draw_buf_handlers
 #define image_cache_draw_buf_handlers LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers
+#define pool_ll LV_GLOBAL_DEFAULT()->draw_buf_pool_ll
+#define pool_stats LV_GLOBAL_DEFAULT()->draw_buf_pool_stats
 
 /**********************
  *      TYPEDEFS
@@ -39,6 +42,9 @@ static void draw_buf_free(const lv_draw_buf_handlers_t * handler, void * buf);
 static uint32_t width_to_stride(uint32_t w, lv_color_format_t color_format);
 static uint32_t _calculate_draw_buf_size(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride);
 static void draw_buf_get_full_area(const lv_draw_buf_t * draw_buf, lv_area_t * full_area);
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    static void pool_shrink(uint32_t max_size);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -546,6 +552,112 @@ void lv_image_buf_free(lv_image_dsc_t * dsc)
     }
 }
 
+void lv_draw_buf_pool_init(void)
+{
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    lv_ll_init(&pool_ll, sizeof(lv_draw_buf_t *));
+    lv_memzero(&pool_stats, sizeof(pool_stats));
+#endif
+}
+
+void lv_draw_buf_pool_deinit(void)
+{
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    pool_shrink(0);
+#endif
+}
+
+lv_draw_buf_t * lv_draw_buf_pool_acquire(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride)
+{
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    if(stride == 0) stride = lv_draw_buf_width_to_stride(w, cf);
+
+    /*The most recently released buffers are at the head*/
+    lv_draw_buf_t ** node;
+    LV_LL_READ(&pool_ll, node) {
+        lv_draw_buf_t * draw_buf = *node;
+        if(draw_buf->header.w == w && draw_buf->header.h == h &&
+           draw_buf->header.cf == cf && draw_buf->header.stride == stride) {
+            lv_ll_remove(&pool_ll, node);
+            lv_free(node);
+
+            draw_buf->header.flags = LV_IMAGE_FLAGS_MODIFIABLE | LV_IMAGE_FLAGS_ALLOCATED;
+            pool_stats.hit_cnt++;
+            pool_stats.pooled_size -= draw_buf->data_size;
+            pool_stats.used_size += draw_buf->data_size;
+            pool_stats.used_peak = LV_MAX(pool_stats.used_peak, pool_stats.used_size);
+            return draw_buf;
+        }
+    }
+
+    pool_stats.miss_cnt++;
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(w, h, cf, stride);
+    if(draw_buf == NULL && pool_stats.pooled_size > 0) {
+        /*The buffers kept in the pool might be the reason of running out of memory*/
+        pool_shrink(0);
+        draw_buf = lv_draw_buf_create(w, h, cf, stride);
+    }
+
+    if(draw_buf) {
+        pool_stats.used_size += draw_buf->data_size;
+        pool_stats.used_peak = LV_MAX(pool_stats.used_peak, pool_stats.used_size);
+    }
+    return draw_buf;
+#else
+    return lv_draw_buf_create(w, h, cf, stride);
+#endif
+}
+
+void lv_draw_buf_pool_release(lv_draw_buf_t * draw_buf)
+{
+    LV_ASSERT_NULL(draw_buf);
+    if(draw_buf == NULL) return;
+
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    pool_stats.used_size -= LV_MIN(pool_stats.used_size, draw_buf->data_size);
+
+    /*Keep only the buffers allocated by LVGL which fit into the pool*/
+    if(draw_buf->handlers != &default_handlers ||
+       !lv_draw_buf_has_flag(draw_buf, LV_IMAGE_FLAGS_ALLOCATED) ||
+       draw_buf->data_size > LV_DRAW_LAYER_BUF_POOL_SIZE) {
+        lv_draw_buf_destroy(draw_buf);
+        return;
+    }
+
+    pool_shrink(LV_DRAW_LAYER_BUF_POOL_SIZE - draw_buf->data_size);
+
+    lv_draw_buf_t ** node = lv_ll_ins_head(&pool_ll);
+    LV_ASSERT_MALLOC(node);
+    if(node == NULL) {
+        lv_draw_buf_destroy(draw_buf);
+        return;
+    }
+
+    *node = draw_buf;
+    pool_stats.pooled_size += draw_buf->data_size;
+    pool_stats.pooled_peak = LV_MAX(pool_stats.pooled_peak, pool_stats.pooled_size);
+#else
+    lv_draw_buf_destroy(draw_buf);
+#endif
+}
+
+void lv_draw_buf_pool_get_stats(lv_draw_buf_pool_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    *stats = pool_stats;
+#else
+    lv_memzero(stats, sizeof(lv_draw_buf_pool_stats_t));
+#endif
+}
+
+void lv_draw_buf_pool_flush(void)
+{
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    pool_shrink(0);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -681,3 +793,24 @@ static void draw_buf_get_full_area(const lv_draw_buf_t * draw_buf, lv_area_t * f
     const lv_image_header_t * header = &draw_buf->header;
     lv_area_set(full_area, 0, 0, header->w - 1, header->h - 1);
 }
+
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+/**
+ * Destroy the least recently released buffers until the pool fits into `max_size`
+ * @param max_size  the size limit in bytes
+ */
+static void pool_shrink(uint32_t max_size)
+{
+    while(pool_stats.pooled_size > max_size) {
+        lv_draw_buf_t ** node = lv_ll_get_tail(&pool_ll);
+        if(node == NULL) break;
+
+        lv_draw_buf_t * draw_buf = *node;
+        lv_ll_remove(&pool_ll, node);
+        lv_free(node);
+
+        pool_stats.pooled_size -= draw_buf->data_size;
+        lv_draw_buf_destroy(draw_buf);
+    }
+}
+#endif
@@ -96,6 +96,16 @@ struct _lv_draw_buf_t {
     const lv_draw_buf_handlers_t * handlers; /**< draw buffer alloc/free ops. */
 };
 
+/** Statistics of reusing layer buffers. See `LV_DRAW_LAYER_BUF_POOL_SIZE`. */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of layer buffers reused from the pool */
+    uint32_t miss_cnt;      /**< Number of layer buffers allocated as there was no matching buffer in the pool */
+    uint32_t pooled_size;   /**< Bytes of the free buffers kept in the pool */
+    uint32_t pooled_peak;   /**< Max. of `pooled_size` */
+    uint32_t used_size;     /**< Bytes of the layer buffers in use */
+    uint32_t used_peak;     /**< Max. of `used_size` */
+} lv_draw_buf_pool_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -314,6 +324,18 @@ lv_result_t lv_draw_buf_adjust_stride(lv_draw_buf_t * src, uint32_t stride);
  */
 lv_result_t lv_draw_buf_premultiply(lv_draw_buf_t * draw_buf);
 
+/**
+ * Get the statistics of reusing layer buffers.
+ * All values are 0 if `LV_DRAW_LAYER_BUF_POOL_SIZE` is 0.
+ * @param stats     store the statistics here
+ */
+void lv_draw_buf_pool_get_stats(lv_draw_buf_pool_stats_t * stats);
+
+/**
+ * Free all the layer buffers kept for reuse.
+ */
+void lv_draw_buf_pool_flush(void);
+
 
 /**
  * Check if a draw buffer has a given flag.
@@ -43,6 +43,35 @@ struct _lv_draw_buf_handlers_t {
  */
 void lv_draw_buf_init_handlers(void);
 
+/**
+ * Initialize the pool of reusable layer buffers
+ */
+void lv_draw_buf_pool_init(void);
+
+/**
+ * Free the buffers in the pool of reusable layer buffers
+ */
+void lv_draw_buf_pool_deinit(void);
+
+/**
+ * Get a draw buffer for a layer. A previously released buffer with the same
+ * width, height, stride and color format is reused if available, else a new one is created.
+ * The content of the buffer is undefined.
+ * @param w         the buffer width in pixels
+ * @param h         the buffer height in pixels
+ * @param cf        the color format
+ * @param stride    the stride in bytes or 0 to calculate it from the width
+ * @return          the draw buffer or NULL on failure
+ */
+lv_draw_buf_t * lv_draw_buf_pool_acquire(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride);
+
+/**
+ * Give back a draw buffer got from `lv_draw_buf_pool_acquire()`.
+ * It's kept for reuse or destroyed if the pool is full.
+ * @param draw_buf  the draw buffer
+ */
+void lv_draw_buf_pool_release(lv_draw_buf_t * draw_buf);
+
 /**********************
  *      MACROS
  **********************/
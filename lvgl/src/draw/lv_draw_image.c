@@ -22,6 +22,9 @@
  *      DEFINES
  *********************/
 
+/*Split only larger rotated or tiled images as each band opens the image again*/
+#define IMAGE_SPLIT_MIN_SIZE    (64 * 64)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,6 +37,12 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
                                 lv_image_decoder_dsc_t * decoder_dsc, lv_area_t * relative_decoded_area,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
                                 lv_draw_image_core_cb draw_core_cb);
+static bool is_transformed(const lv_draw_image_dsc_t * dsc);
+static void decoder_args_init(lv_image_decoder_args_t * args, const lv_draw_image_dsc_t * dsc);
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+static bool add_band_tasks(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * image_coords);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -135,6 +144,12 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
 
     /*Typical case, draw the image as bitmap*/
     if(!(new_image_dsc.header.flags & LV_IMAGE_FLAGS_CUSTOM_DRAW)) {
+#if LV_USE_DRAW_SW && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+        if(add_band_tasks(layer, &new_image_dsc, image_coords)) {
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+#endif
         lv_draw_task_t * t = lv_draw_add_task(layer, image_coords, LV_DRAW_TASK_TYPE_IMAGE);
         lv_memcpy(t->draw_dsc, &new_image_dsc, sizeof(lv_draw_image_dsc_t));
 
@@ -241,8 +256,16 @@ void lv_draw_image_normal_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         return;
     }
 
+#if LV_IMAGE_DECODER_ASYNC
+    /*Leave the area empty until the image is decoded in the background*/
+    if(!lv_image_decoder_async_is_ready(draw_dsc->src, draw_dsc->base.obj)) return;
+#endif
+
+    lv_image_decoder_args_t args;
+    decoder_args_init(&args, draw_dsc);
+
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, &args);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -261,8 +284,15 @@ void lv_draw_image_tiled_helper(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         return;
     }
 
+#if LV_IMAGE_DECODER_ASYNC
+    if(!lv_image_decoder_async_is_ready(draw_dsc->src, draw_dsc->base.obj)) return;
+#endif
+
+    lv_image_decoder_args_t args;
+    decoder_args_init(&args, draw_dsc);
+
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, &args);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -343,6 +373,69 @@ void lv_image_buf_get_transformed_area(lv_area_t * res, int32_t w, int32_t h, in
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_DRAW_UNIT_CNT > 1
+/**
+ * Split a large rotated or tiled image into horizontal bands to let the SW draw threads
+ * transform or decompress them in parallel. The bands are independent as their `_real_area`s don't overlap.
+ * @param layer         pointer to a layer
+ * @param dsc           the image descriptor with the header already set
+ * @param image_coords  the coordinates of the image
+ * @return              true: the band draw tasks are added; false: the image should be drawn as one task
+ */
+static bool add_band_tasks(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * image_coords)
+{
+    /*Only rotated images are split. The source step of scaled images depends on the height of the
+     *drawn area, so the bands would be sampled a little differently than the whole image.
+     *Not transformed tiled images are split too to decompress their tiles in parallel.*/
+    bool tiled = (dsc->header.flags & LV_IMAGE_FLAGS_TILED) && !is_transformed(dsc);
+    if(dsc->rotation == 0 && !tiled) return false;
+    if(dsc->skew_x || dsc->skew_y) return false;
+
+    lv_area_t real_area;
+    lv_image_buf_get_transformed_area(&real_area, lv_area_get_width(image_coords), lv_area_get_height(image_coords),
+                                      dsc->rotation, dsc->scale_x, dsc->scale_y, &dsc->pivot);
+    lv_area_move(&real_area, image_coords->x1, image_coords->y1);
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &real_area, &layer->_clip_area)) return false;
+    if(lv_area_get_size(&draw_area) < IMAGE_SPLIT_MIN_SIZE) return false;
+
+    int32_t band_h = (lv_area_get_height(&draw_area) + LV_DRAW_SW_DRAW_UNIT_CNT - 1) / LV_DRAW_SW_DRAW_UNIT_CNT;
+    int32_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y += band_h) {
+        lv_draw_task_t * t = lv_draw_add_task(layer, image_coords, LV_DRAW_TASK_TYPE_IMAGE);
+        lv_memcpy(t->draw_dsc, dsc, sizeof(lv_draw_image_dsc_t));
+
+        t->clip_area.y1 = y;
+        t->clip_area.y2 = LV_MIN(y + band_h - 1, draw_area.y2);
+        t->_real_area = draw_area;
+        t->_real_area.y1 = t->clip_area.y1;
+        t->_real_area.y2 = t->clip_area.y2;
+
+        lv_draw_finalize_task_creation(layer, t);
+    }
+
+    return true;
+}
+#endif
+
+static bool is_transformed(const lv_draw_image_dsc_t * dsc)
+{
+    return dsc->rotation || dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE ||
+           dsc->skew_x || dsc->skew_y;
+}
+
+/**
+ * Tiled images are decompressed only where they are drawn,
+ * except if they are transformed, as then all of their pixels might be needed.
+ */
+static void decoder_args_init(lv_image_decoder_args_t * args, const lv_draw_image_dsc_t * dsc)
+{
+    lv_memzero(args, sizeof(lv_image_decoder_args_t));
+    args->stride_align = LV_DRAW_BUF_STRIDE_ALIGN != 1;
+    args->partial_tiles = !is_transformed(dsc);
+}
+
 static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc,
                                 lv_image_decoder_dsc_t * decoder_dsc, lv_area_t * relative_decoded_area,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
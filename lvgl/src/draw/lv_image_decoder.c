@@ -13,6 +13,7 @@
 #include "../misc/lv_profiler.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../core/lv_obj.h"
 
 /*********************
  *      DEFINES
@@ -30,10 +31,25 @@
     #define img_decoder_open_lock_p NULL
 #endif
 
+#if LV_IMAGE_DECODER_ASYNC
+    #if LV_USE_OS == LV_OS_NONE
+        #error "LV_IMAGE_DECODER_ASYNC requires LV_USE_OS"
+    #endif
+    #define img_decoder_async_p &(LV_GLOBAL_DEFAULT()->img_decoder_async)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_IMAGE_DECODER_ASYNC
+typedef struct {
+    const void * src;           /*A copy of the path for files*/
+    lv_image_src_t src_type;
+    lv_obj_t * obj;             /*Invalidate it when the image is decoded*/
+} async_req_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -50,6 +66,16 @@ static lv_image_decoder_t * image_decoder_get_info(lv_image_decoder_dsc_t * dsc,
 
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 
+#if LV_IMAGE_DECODER_ASYNC
+static void async_init(void);
+static void async_deinit(void);
+static void async_thread_cb(void * user_data);
+static void async_timer_cb(lv_timer_t * t);
+static async_req_t * async_find(lv_ll_t * ll, const void * src, lv_image_src_t src_type, lv_obj_t * obj);
+static async_req_t * async_add(lv_ll_t * ll, const void * src, lv_image_src_t src_type, lv_obj_t * obj);
+static void async_req_delete(lv_ll_t * ll, async_req_t * req);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -75,6 +101,10 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
 
     lv_mutex_init(img_decoder_info_lock_p);
     lv_mutex_init(img_decoder_open_lock_p);
+
+#if LV_IMAGE_DECODER_ASYNC
+    async_init();
+#endif
 }
 
 /**
@@ -82,6 +112,14 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
  */
 void lv_image_decoder_deinit(void)
 {
+#if LV_IMAGE_DECODER_ASYNC
+    async_deinit();
+#endif
+
+#if LV_USE_IMAGE_DISK_CACHE
+    lv_image_disk_cache_set_path(NULL);
+#endif
+
     lv_cache_destroy(img_cache_p, NULL);
     lv_cache_destroy(img_header_cache_p, NULL);
 
@@ -119,23 +157,32 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->src = src;
     dsc->src_type = lv_image_src_get_type(src);
 
-    lv_mutex_lock(img_decoder_open_lock_p);
-
+    bool use_cache = false;
     if(lv_image_cache_is_enabled()) {
         dsc->cache = img_cache_p;
         /*Try cache first, unless we are told to ignore cache.*/
-        if(!(args && args->no_cache)) {
-            /*
-            * Check the cache first
-            * If the image is found in the cache, just return it.*/
-            if(try_cache(dsc) == LV_RESULT_OK) {
-                lv_mutex_unlock(img_decoder_open_lock_p);
-                LV_PROFILER_DECODER_END;
-                return LV_RESULT_OK;
-            }
+        use_cache = !(args && args->no_cache);
+        /*
+        * Check the cache first
+        * If the image is found in the cache, just return it.
+        * The cache has its own lock, so cached images are not blocked by an other thread decoding an image.*/
+        if(use_cache && try_cache(dsc) == LV_RESULT_OK) {
+            LV_PROFILER_DECODER_END;
+            return LV_RESULT_OK;
         }
     }
 
+    lv_mutex_lock(img_decoder_open_lock_p);
+
+#if LV_USE_OS != LV_OS_NONE
+    /*An other thread might have decoded the image while this one was waiting for the lock*/
+    if(use_cache && try_cache(dsc) == LV_RESULT_OK) {
+        lv_mutex_unlock(img_decoder_open_lock_p);
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_OK;
+    }
+#endif
+
     /*Find the decoder that can open the image source, and get the header info in the same time.*/
     dsc->decoder = image_decoder_get_info(dsc, &dsc->header);
     if(dsc->decoder == NULL) {
@@ -151,16 +198,30 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
         .no_cache = false,
         .use_indexed = false,
         .flush_cache = false,
+        .partial_tiles = false,
     };
 
+    lv_result_t res = LV_RESULT_INVALID;
+#if LV_USE_IMAGE_DISK_CACHE
+    /*Use the image decoded earlier if it's stored on the disk*/
+    uint32_t disk_cache_key = 0;
+    if(use_cache) res = lv_image_disk_cache_load(dsc, &disk_cache_key);
+#endif
+
     /*
      * We assume that if a decoder can get the info, it can open the image.
      * If decoder open failed, free the source and return error.
      * If decoder open succeed, add the image to cache if enabled.
      * */
-    LV_PROFILER_DECODER_BEGIN_TAG(dsc->decoder->name);
-    lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
-    LV_PROFILER_DECODER_END_TAG(dsc->decoder->name);
+    if(res != LV_RESULT_OK) {
+        LV_PROFILER_DECODER_BEGIN_TAG(dsc->decoder->name);
+        res = dsc->decoder->open_cb(dsc->decoder, dsc);
+        LV_PROFILER_DECODER_END_TAG(dsc->decoder->name);
+
+#if LV_USE_IMAGE_DISK_CACHE
+        if(res == LV_RESULT_OK && disk_cache_key != 0) lv_image_disk_cache_store(dsc, disk_cache_key);
+#endif
+    }
 
     if(res == LV_RESULT_OK && dsc->decoded != NULL) {
         LV_ASSERT_MSG(dsc->decoded->unaligned_data && dsc->decoded->handlers, "Invalid draw buffer");
@@ -183,6 +244,69 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     return res;
 }
 
+lv_result_t lv_image_prefetch(const void * src)
+{
+    if(src == NULL || !lv_image_cache_is_enabled()) return LV_RESULT_INVALID;
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type != LV_IMAGE_SRC_FILE && src_type != LV_IMAGE_SRC_VARIABLE) return LV_RESULT_INVALID;
+
+#if LV_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_t * async = img_decoder_async_p;
+    lv_result_t res = LV_RESULT_OK;
+    lv_mutex_lock(&async->lock);
+    if(async_find(&async->req_ll, src, src_type, NULL) == NULL) {
+        if(async_add(&async->req_ll, src, src_type, NULL) == NULL) res = LV_RESULT_INVALID;
+    }
+    lv_mutex_unlock(&async->lock);
+
+    if(res == LV_RESULT_OK) lv_thread_sync_signal(&async->sync);
+    return res;
+#else
+    /*The decoders add the image to the cache when it's opened*/
+    lv_image_decoder_dsc_t dsc;
+    lv_result_t res = lv_image_decoder_open(&dsc, src, NULL);
+    if(res != LV_RESULT_OK) return res;
+
+    bool cached = dsc.cache_entry != NULL;
+    lv_image_decoder_close(&dsc);
+    return cached ? LV_RESULT_OK : LV_RESULT_INVALID;
+#endif
+}
+
+#if LV_IMAGE_DECODER_ASYNC
+bool lv_image_decoder_async_is_ready(const void * src, lv_obj_t * obj)
+{
+    /*Without a widget there is nothing to invalidate when the image is decoded.
+     *Only files are decoded in the background as variables are usually quick to open.*/
+    if(obj == NULL || !lv_image_cache_is_enabled()) return true;
+    if(lv_image_src_get_type(src) != LV_IMAGE_SRC_FILE) return true;
+
+    lv_image_cache_data_t search_key;
+    search_key.src_type = LV_IMAGE_SRC_FILE;
+    search_key.src = src;
+    lv_cache_entry_t * entry = lv_cache_acquire(img_cache_p, &search_key, NULL);
+    if(entry) {
+        lv_cache_release(img_cache_p, entry, NULL);
+        return true;
+    }
+
+    lv_image_decoder_async_t * async = img_decoder_async_p;
+    lv_mutex_lock(&async->lock);
+    bool ready = async_find(&async->sync_ll, src, LV_IMAGE_SRC_FILE, NULL) != NULL;
+    bool queued = false;
+    if(!ready && async_find(&async->req_ll, src, LV_IMAGE_SRC_FILE, obj) == NULL) {
+        /*Decode it now if it can't be queued*/
+        if(async_add(&async->req_ll, src, LV_IMAGE_SRC_FILE, obj)) queued = true;
+        else ready = true;
+    }
+    lv_mutex_unlock(&async->lock);
+
+    if(queued) lv_thread_sync_signal(&async->sync);
+    return ready;
+}
+#endif
+
 lv_result_t lv_image_decoder_get_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
                                       lv_area_t * decoded_area)
 {
@@ -494,3 +618,142 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     LV_PROFILER_DECODER_END;
     return LV_RESULT_INVALID;
 }
+
+#if LV_IMAGE_DECODER_ASYNC
+
+static void async_init(void)
+{
+    lv_image_decoder_async_t * async = img_decoder_async_p;
+    lv_memzero(async, sizeof(lv_image_decoder_async_t));
+    lv_ll_init(&async->req_ll, sizeof(async_req_t));
+    lv_ll_init(&async->done_ll, sizeof(lv_obj_t *));
+    lv_ll_init(&async->sync_ll, sizeof(async_req_t));
+    lv_mutex_init(&async->lock);
+    lv_thread_sync_init(&async->sync);
+
+    async->timer = lv_timer_create(async_timer_cb, LV_DEF_REFR_PERIOD, async);
+
+    /*The draw threads decode the images with the same stack size without this thread*/
+    lv_thread_init(&async->thread, "img_decoder", LV_THREAD_PRIO_LOW, async_thread_cb, LV_DRAW_THREAD_STACK_SIZE,
+                   async);
+}
+
+static void async_deinit(void)
+{
+    lv_image_decoder_async_t * async = img_decoder_async_p;
+
+    lv_mutex_lock(&async->lock);
+    async->exit = true;
+    lv_mutex_unlock(&async->lock);
+    lv_thread_sync_signal(&async->sync);
+    lv_thread_delete(&async->thread);
+
+    lv_thread_sync_delete(&async->sync);
+    lv_mutex_delete(&async->lock);
+    lv_timer_delete(async->timer);
+
+    async_req_t * req;
+    while((req = lv_ll_get_head(&async->req_ll)) != NULL) async_req_delete(&async->req_ll, req);
+    while((req = lv_ll_get_head(&async->sync_ll)) != NULL) async_req_delete(&async->sync_ll, req);
+    lv_ll_clear(&async->done_ll);
+}
+
+static void async_thread_cb(void * user_data)
+{
+    lv_image_decoder_async_t * async = user_data;
+
+    while(1) {
+        lv_mutex_lock(&async->lock);
+        bool exit = async->exit;
+        /*The request stays in the list while it's decoded, so it's not queued again*/
+        async_req_t * req = lv_ll_get_head(&async->req_ll);
+        lv_mutex_unlock(&async->lock);
+
+        if(exit) break;
+        if(req == NULL) {
+            lv_thread_sync_wait(&async->sync);
+            continue;
+        }
+
+        /*The decoders add the image to the cache when it's opened*/
+        bool cached = false;
+        lv_image_decoder_dsc_t dsc;
+        if(lv_image_decoder_open(&dsc, req->src, NULL) == LV_RESULT_OK) {
+            cached = dsc.cache_entry != NULL;
+            lv_image_decoder_close(&dsc);
+        }
+
+        lv_mutex_lock(&async->lock);
+        if(req->obj) {
+            lv_obj_t ** obj_p = lv_ll_ins_tail(&async->done_ll);
+            LV_ASSERT_MALLOC(obj_p);
+            if(obj_p) *obj_p = req->obj;
+        }
+
+        /*If the image can't be cached (e.g. it's too large or invalid) decoding it in the background
+         *doesn't help, so let the rendering open it*/
+        if(cached || async_find(&async->sync_ll, req->src, req->src_type, NULL)) {
+            async_req_delete(&async->req_ll, req);
+        }
+        else {
+            req->obj = NULL;
+            lv_ll_chg_list(&async->req_ll, &async->sync_ll, req, false);
+        }
+        lv_mutex_unlock(&async->lock);
+    }
+}
+
+static void async_timer_cb(lv_timer_t * t)
+{
+    lv_image_decoder_async_t * async = lv_timer_get_user_data(t);
+
+    lv_mutex_lock(&async->lock);
+    lv_obj_t ** obj_p;
+    while((obj_p = lv_ll_get_head(&async->done_ll)) != NULL) {
+        lv_obj_t * obj = *obj_p;
+        lv_ll_remove(&async->done_ll, obj_p);
+        lv_free(obj_p);
+
+        /*The widget might have been deleted since it was drawn*/
+        if(lv_obj_is_valid(obj)) lv_obj_invalidate(obj);
+    }
+    lv_mutex_unlock(&async->lock);
+}
+
+static async_req_t * async_find(lv_ll_t * ll, const void * src, lv_image_src_t src_type, lv_obj_t * obj)
+{
+    async_req_t * req;
+    LV_LL_READ(ll, req) {
+        if(req->src_type != src_type || req->obj != obj) continue;
+        if(src_type == LV_IMAGE_SRC_FILE ? lv_strcmp(req->src, src) == 0 : req->src == src) return req;
+    }
+
+    return NULL;
+}
+
+static async_req_t * async_add(lv_ll_t * ll, const void * src, lv_image_src_t src_type, lv_obj_t * obj)
+{
+    async_req_t * req = lv_ll_ins_tail(ll);
+    LV_ASSERT_MALLOC(req);
+    if(req == NULL) return NULL;
+
+    req->src_type = src_type;
+    req->obj = obj;
+    req->src = src_type == LV_IMAGE_SRC_FILE ? lv_strdup(src) : src;
+    if(req->src == NULL) {
+        lv_ll_remove(ll, req);
+        lv_free(req);
+        return NULL;
+    }
+
+    return req;
+}
+
+static void async_req_delete(lv_ll_t * ll, async_req_t * req)
+{
+    if(req->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)req->src);
+    lv_ll_remove(ll, req);
+    lv_free(req);
+}
+
+#endif /*LV_IMAGE_DECODER_ASYNC*/
@@ -179,6 +179,15 @@ void lv_image_decoder_set_get_area_cb(lv_image_decoder_t * decoder, lv_image_dec
  */
 void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decoder_close_f_t close_cb);
 
+/**
+ * Decode an image into the image cache in advance, e.g. before its screen is loaded.
+ * With `LV_IMAGE_DECODER_ASYNC` the image is decoded in the background, else it's decoded now.
+ * @param src   the image source: pointer to an `lv_image_dsc_t` or a path to a file
+ * @return      LV_RESULT_OK: the image is cached or queued for decoding;
+ *              LV_RESULT_INVALID: the image cache is disabled or the image couldn't be decoded
+ */
+lv_result_t lv_image_prefetch(const void * src);
+
 lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data);
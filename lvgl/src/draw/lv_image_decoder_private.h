@@ -15,6 +15,8 @@ extern "C" {
  *********************/
 #include "lv_image_decoder.h"
 #include "../misc/cache/lv_cache.h"
+#include "../misc/lv_ll.h"
+#include "../osal/lv_os_private.h"
 
 /*********************
  *      DEFINES
@@ -39,6 +41,7 @@ struct _lv_image_decoder_args_t {
     bool no_cache;          /**< When set, decoded image won't be put to cache, and decoder open will also ignore cache. */
     bool use_indexed;       /**< Decoded indexed image as is. Convert to ARGB8888 if false. */
     bool flush_cache;       /**< Whether to flush the data cache after decoding */
+    bool partial_tiles;     /**< Let tiled images be decoded tile by tile via `get_area_cb` instead of as a whole */
 };
 
 struct _lv_image_decoder_t {
@@ -116,6 +119,28 @@ struct _lv_image_decoder_dsc_t {
     void * user_data;
 };
 
+#if LV_IMAGE_DECODER_ASYNC
+typedef struct {
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_mutex_t lock;            /**< Protects the lists below */
+    lv_ll_t req_ll;             /**< Images waiting to be decoded. The head is being decoded. */
+    lv_ll_t done_ll;            /**< Decoded images whose widgets are still to be invalidated */
+    lv_ll_t sync_ll;            /**< Images which can't be cached, so they are decoded while rendering */
+    lv_timer_t * timer;         /**< Invalidates the widgets of the decoded images */
+    bool exit;
+} lv_image_decoder_async_t;
+#endif
+
+#if LV_USE_IMAGE_DISK_CACHE
+typedef struct {
+    char * path;                /**< Directory of the stored images, NULL if disabled */
+    uint32_t size;              /**< Total size of the stored images */
+    uint32_t hit_cnt;
+    uint32_t store_cnt;
+} lv_image_disk_cache_t;
+#endif
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -133,6 +158,36 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
  */
 void lv_image_decoder_deinit(void);
 
+#if LV_IMAGE_DECODER_ASYNC
+/**
+ * Check if an image can be drawn without decoding it while rendering.
+ * If not, the image is queued for the background decoding and `obj` will be invalidated
+ * when it's ready.
+ * @param src   the image source
+ * @param obj   the widget drawing the image, or NULL
+ * @return      true: the image can be opened now; false: skip drawing it this time
+ */
+bool lv_image_decoder_async_is_ready(const void * src, lv_obj_t * obj);
+#endif
+
+#if LV_USE_IMAGE_DISK_CACHE
+/**
+ * Load the decoded image stored on the disk earlier and add it to the image cache.
+ * `dsc` needs to have its decoder, header and args set.
+ * @param dsc   the decoder descriptor. `decoded` and `cache_entry` are set on success.
+ * @param key   store the key of the image here, or 0 if the image can't be stored
+ * @return      LV_RESULT_OK: the image was loaded; LV_RESULT_INVALID: it needs to be decoded
+ */
+lv_result_t lv_image_disk_cache_load(lv_image_decoder_dsc_t * dsc, uint32_t * key);
+
+/**
+ * Store an image decoded to the image cache on the disk.
+ * @param dsc   the decoder descriptor of the opened image
+ * @param key   the key returned by `lv_image_disk_cache_load()`
+ */
+void lv_image_disk_cache_store(lv_image_decoder_dsc_t * dsc, uint32_t key);
+#endif
+
 /**********************
  *      MACROS
  **********************/
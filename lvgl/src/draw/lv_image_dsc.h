@@ -47,6 +47,13 @@ typedef enum _lvimage_flags_t {
      */
     LV_IMAGE_FLAGS_COMPRESSED       = 0x0008,
 
+    /**
+     * The compressed image data is split to independently compressed tiles
+     * (see `LV_IMAGE_COMPRESS_LZ4_TILED`). The decoder can decompress only the tiles
+     * of the drawn area via `get_area_cb`.
+     */
+    LV_IMAGE_FLAGS_TILED            = 0x0080,
+
     /*Below flags are applicable only for draw buffer header.*/
 
     /**
@@ -82,6 +89,7 @@ typedef enum {
     LV_IMAGE_COMPRESS_NONE = 0,
     LV_IMAGE_COMPRESS_RLE,      /**< LVGL custom RLE compression */
     LV_IMAGE_COMPRESS_LZ4,
+    LV_IMAGE_COMPRESS_LZ4_TILED,    /**< LZ4 compressed tiles with an offset table */
 } lv_image_compress_t;
 
 #if LV_BIG_ENDIAN_SYSTEM
@@ -15,6 +15,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_global.h"
 #include "../../misc/lv_area_private.h"
+#include "lv_draw_sw_grad.h"
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
     #if LV_USE_THORVG_EXTERNAL
@@ -77,7 +78,9 @@ void lv_draw_sw_init(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+    lv_draw_sw_box_shadow_cache_init();
 #endif
+    lv_draw_sw_grad_cache_init();
 
     lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
     draw_sw_unit->base_unit.dispatch_cb = dispatch;
@@ -120,7 +123,9 @@ void lv_draw_sw_deinit(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
+    lv_draw_sw_box_shadow_cache_deinit();
 #endif
+    lv_draw_sw_grad_cache_deinit();
 }
 
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
@@ -408,7 +413,7 @@ static void execute_drawing(lv_draw_task_t * t)
             lv_draw_sw_arc(t, t->draw_dsc, &t->area);
             break;
         case LV_DRAW_TASK_TYPE_LINE:
-            lv_draw_line_iterate(t, t->draw_dsc, lv_draw_sw_line);
+            lv_draw_sw_polyline(t, t->draw_dsc);
             break;
         case LV_DRAW_TASK_TYPE_BLUR:
             lv_draw_sw_blur(t, t->draw_dsc, &t->area);
@@ -108,6 +108,14 @@ void lv_draw_sw_arc(lv_draw_task_t * t, const lv_draw_arc_dsc_t * dsc, const lv_
  */
 void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Draw all segments of a line with `points` in one pass with SW render.
+ * The joints are rounded and blended only once. Other lines are drawn by `lv_draw_sw_line`.
+ * @param t             pointer to a draw task
+ * @param dsc           the draw descriptor
+ */
+void lv_draw_sw_polyline(lv_draw_task_t * t, lv_draw_line_dsc_t * dsc);
+
 /**
  * Blend a layer with SW render
  * @param t             pointer to a draw task
@@ -25,22 +25,39 @@
 #define BLUR_INTENSITY_MAX (1 << 12)
 #define BLUR_INTENSITY_HALF ((1 << 12) / 2)
 
+/*Max number of columns blurred together*/
+#define BLUR_LANE_MAX       32
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Describes `lane_cnt` lines of pixels which are blurred together.
+ * E.g. adjacent columns are blurred row by row to read the memory continuously.
+ */
+typedef struct {
+    int32_t lane_cnt;       /**< Number of lines to blur */
+    int32_t lane_step;      /**< Distance of the lines' first pixels in bytes */
+    int32_t px_cnt;         /**< Number of pixels to blur on each line */
+    int32_t px_step;        /**< Distance of two pixels on a line in bytes. Negative to go backward */
+    uint32_t sample_len;    /**< Number of pixels to average to initialize the filter */
+    uint32_t intensity;
+    bool swapped;           /**< The pixels are RGB565_SWAPPED */
+} blur_lanes_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
-static void blur_1_bytes_init(uint32_t * sum, uint8_t * buf, uint32_t sample_len, int32_t stride);
-static inline uint8_t blur_1_bytes(uint32_t * sum, uint8_t px, uint32_t intensity);
+static void blur_lanes(uint8_t * buf, const blur_lanes_t * lanes, uint32_t px_size);
+static void blur_lanes_1_byte(uint8_t * buf, const blur_lanes_t * lanes);
+static void blur_lanes_2_bytes(uint8_t * buf, const blur_lanes_t * lanes);
+static void blur_lanes_3_bytes(uint8_t * buf, const blur_lanes_t * lanes);
 
-static void blur_2_bytes_init(uint32_t * sum, lv_color16_t * buf, uint32_t sample_len, int32_t stride, bool swapped);
+static inline uint8_t blur_1_bytes(uint32_t * sum, uint8_t px, uint32_t intensity);
 static inline uint16_t blur_2_bytes(uint32_t * sum, uint16_t px, uint32_t intensity, bool swapped);
-
-static void blur_3_bytes_init(uint32_t * sum, volatile uint8_t * buf, uint32_t sample_len, int32_t stride);
-static inline void blur_3_bytes(uint32_t * sum, volatile uint8_t * buf, uint32_t intensity);
+static inline void blur_3_bytes(uint32_t * sum, uint8_t * buf, uint32_t intensity);
 
 static int32_t get_rounded_edge_point(int32_t p_start, int32_t p_end, int32_t p, int32_t r);
 
@@ -64,7 +81,10 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
     int32_t layer_x_ofs = t->target_layer->buf_area.x1;
     int32_t layer_y_ofs = t->target_layer->buf_area.y1;
     lv_area_t clipped_coords;
-    if(!lv_area_intersect(&clipped_coords, coords, &t->clip_area)) return;
+    if(!lv_area_intersect(&clipped_coords, coords, &t->clip_area)) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
     lv_area_move(&clipped_coords, -layer_x_ofs, -layer_y_ofs);
 
     uint32_t blur_radius = dsc->blur_radius;
@@ -91,8 +111,10 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
     clipped_coords.x2 = ((clipped_coords.x2 - (skip_cnt - 1)) / skip_cnt) * skip_cnt;
     clipped_coords.y1 = ((clipped_coords.y1 + (skip_cnt - 1)) / skip_cnt) * skip_cnt;
     clipped_coords.y2 = ((clipped_coords.y2 - (skip_cnt - 1)) / skip_cnt) * skip_cnt;
-    if(lv_area_get_width(&clipped_coords) < 0) return;
-    if(lv_area_get_height(&clipped_coords) < 0) return;
+    if(lv_area_get_width(&clipped_coords) < 0 || lv_area_get_height(&clipped_coords) < 0) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
 
     blur_radius = blur_radius / skip_cnt;
 
@@ -109,254 +131,125 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
     int32_t short_side = LV_MIN(w, h);
     if(radius > short_side >> 1) radius = short_side >> 1;
 
-    uint32_t px_size = lv_color_format_get_size(t->target_layer->draw_buf->header.cf);
-    int32_t stride_byte = t->target_layer->draw_buf->header.stride;
-    int32_t stride_px = stride_byte / px_size;
-    int32_t next_px_ofs_byte = px_size * skip_cnt;
-    bool swapped = t->target_layer->draw_buf->header.cf == LV_COLOR_FORMAT_RGB565_SWAPPED;
+    lv_draw_buf_t * draw_buf = t->target_layer->draw_buf;
+    uint32_t px_size = lv_color_format_get_size(draw_buf->header.cf);
+    int32_t stride_byte = draw_buf->header.stride;
+
+    blur_lanes_t lanes;
+    lanes.intensity = intensity;
+    lanes.swapped = draw_buf->header.cf == LV_COLOR_FORMAT_RGB565_SWAPPED;
+
+    /*If the blur is split into stripes blur only the columns or rows of this task's stripe*/
+    lv_area_t stripe = clipped_coords;
+    if(dsc->pass != LV_DRAW_BLUR_PASS_ALL) {
+        lv_area_t real_area = t->_real_area;
+        lv_area_move(&real_area, -layer_x_ofs, -layer_y_ofs);
+        if(dsc->pass == LV_DRAW_BLUR_PASS_COLUMNS) {
+            stripe.x1 = LV_MAX(stripe.x1, ((real_area.x1 + (skip_cnt - 1)) / skip_cnt) * skip_cnt);
+            stripe.x2 = LV_MIN(stripe.x2, real_area.x2);
+        }
+        else {
+            stripe.y1 = LV_MAX(stripe.y1, ((real_area.y1 + (skip_cnt - 1)) / skip_cnt) * skip_cnt);
+            stripe.y2 = LV_MIN(stripe.y2, real_area.y2);
+        }
+    }
 
-    uint32_t sum[3];
     int32_t y;
     int32_t x;
 
-    /*Blur each column top to bottom and bottom to top.*/
-    for(x = clipped_coords.x1; x <= clipped_coords.x2; x += skip_cnt) {
-        int32_t cir_y = get_rounded_edge_point(coords->x1, coords->x2, layer_x_ofs + x, radius);
-        int32_t y_start = LV_CLAMP(clipped_coords.y1, coords->y1 - layer_y_ofs + cir_y, clipped_coords.y2);
-        int32_t y_end = LV_CLAMP(clipped_coords.y1, coords->y2  - layer_y_ofs - cir_y, clipped_coords.y2);
-
-        /*Make sure that the width and height is a multiple of skip_cnt so that back and forth blurring
-         *surely affects the same pixels */
-        y_start = (y_start / skip_cnt) * skip_cnt;
-        y_end = (y_end / skip_cnt) * skip_cnt;
-        if(y_start > y_end) continue;
-
-        uint32_t sample_len_limited = LV_MIN((y_end - y_start) / skip_cnt + 1, sample_len);
-
-        if(px_size == 1) {
-            /*Compiler optimization might mishandle it, so add volatile*/
-            uint8_t * buf_column_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_start);
-            blur_1_bytes_init(sum, buf_column_start, sample_len_limited, stride_byte * skip_cnt);
-
-            uint8_t buf_prev = buf_column_start[0] + 1; /*Make sure that it's not equal in the first round*/
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                if(buf_prev != *buf_column_start) {
-                    *buf_column_start = blur_1_bytes(sum, *buf_column_start, intensity);
-                    buf_prev = *buf_column_start;
+    /*Blur each column top to bottom and bottom to top.
+     *Columns with the same vertical range are blurred together row by row
+     *which is much more cache friendly than walking the columns one by one.*/
+    if(dsc->pass != LV_DRAW_BLUR_PASS_ROWS) {
+        x = stripe.x1;
+        while(x <= stripe.x2) {
+            int32_t cir_y = get_rounded_edge_point(coords->x1, coords->x2, layer_x_ofs + x, radius);
+            int32_t y_start = LV_CLAMP(clipped_coords.y1, coords->y1 - layer_y_ofs + cir_y, clipped_coords.y2);
+            int32_t y_end = LV_CLAMP(clipped_coords.y1, coords->y2  - layer_y_ofs - cir_y, clipped_coords.y2);
+
+            /*The columns outside of the rounded corners have the same range*/
+            lanes.lane_cnt = 1;
+            if(cir_y == 0) {
+                while(lanes.lane_cnt < BLUR_LANE_MAX) {
+                    int32_t x_next = x + lanes.lane_cnt * skip_cnt;
+                    if(x_next > stripe.x2) break;
+                    if(get_rounded_edge_point(coords->x1, coords->x2, layer_x_ofs + x_next, radius) != 0) break;
+                    lanes.lane_cnt++;
                 }
-                buf_column_start += stride_byte * skip_cnt;
             }
 
-            uint8_t * buf_column_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_end);
-            blur_1_bytes_init(sum, buf_column_end, sample_len_limited, -stride_byte * skip_cnt);
-            buf_prev = buf_column_end[0] + 1; /*Make sure that it's not equal in the first round*/
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                if(buf_prev != *buf_column_end) {
-                    *buf_column_end = blur_1_bytes(sum, *buf_column_end, intensity);
-                    buf_prev = *buf_column_end;
-                }
-                buf_column_end -= stride_byte * skip_cnt;
-            }
-        }
-        else if(px_size == 2) {
-            uint16_t * buf16_column_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_start);
-            blur_2_bytes_init(sum, (lv_color16_t *)buf16_column_start, sample_len_limited, stride_px * skip_cnt, swapped);
-            uint16_t buf16_prev = buf16_column_start[0] + 1; /*Make sure that it's not equal in the first round*/
-
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                if(buf16_prev != *buf16_column_start) {
-                    *buf16_column_start = blur_2_bytes(sum, *buf16_column_start, intensity, swapped);
-                    buf16_prev = *buf16_column_start;
-                }
-                buf16_column_start += stride_px * skip_cnt;
-            }
+            /*Make sure that the width and height is a multiple of skip_cnt so that back and forth blurring
+             *surely affects the same pixels */
+            y_start = (y_start / skip_cnt) * skip_cnt;
+            y_end = (y_end / skip_cnt) * skip_cnt;
+            if(y_start <= y_end) {
+                lanes.lane_step = px_size * skip_cnt;
+                lanes.px_cnt = (y_end - y_start) / skip_cnt + 1;
+                lanes.sample_len = LV_MIN(lanes.px_cnt, sample_len);
 
-            uint16_t * buf16_column_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_end);
-            blur_2_bytes_init(sum, (lv_color16_t *)buf16_column_end, sample_len_limited, -stride_px * skip_cnt, swapped);
-            buf16_prev = buf16_column_end[0] + 1; /*Make sure that it's not equal in the first round*/
+                lanes.px_step = stride_byte * skip_cnt;
+                blur_lanes(lv_draw_buf_goto_xy(draw_buf, x, y_start), &lanes, px_size);
 
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                if(buf16_prev != *buf16_column_end) {
-                    *buf16_column_end = blur_2_bytes(sum, *buf16_column_end, intensity, swapped);
-                    buf16_prev = *buf16_column_end;
-                }
-                buf16_column_end -= stride_px * skip_cnt;
-            }
-        }
-        else if(px_size >= 3) {
-            /*Compiler optimization might mishandle it, so add volatile*/
-            volatile uint8_t * buf_column_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_start);
-            blur_3_bytes_init(sum, buf_column_start, sample_len_limited, stride_byte * skip_cnt);
-
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                blur_3_bytes(sum, buf_column_start, intensity);
-                buf_column_start += stride_byte * skip_cnt;
+                lanes.px_step = -stride_byte * skip_cnt;
+                blur_lanes(lv_draw_buf_goto_xy(draw_buf, x, y_end), &lanes, px_size);
             }
 
-            volatile uint8_t * buf_column_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x, y_end);
-            blur_3_bytes_init(sum, buf_column_end, sample_len_limited, -stride_byte * skip_cnt);
-            for(y = y_start; y <= y_end; y += skip_cnt) {
-                blur_3_bytes(sum, buf_column_end, intensity);
-                buf_column_end -= stride_byte * skip_cnt;
-            }
+            x += lanes.lane_cnt * skip_cnt;
         }
     }
 
     /*Blur each line from left to right and right to left.
      *Also fill the gap in each line because of skipped pixels*/
-    for(y = clipped_coords.y1; y <= clipped_coords.y2; y += skip_cnt) {
-        int32_t cir_x = get_rounded_edge_point(coords->y1, coords->y2, layer_y_ofs + y, radius);
-        int32_t x_start = LV_CLAMP(clipped_coords.x1, coords->x1  - layer_x_ofs + cir_x, clipped_coords.x2);
-        int32_t x_end = LV_CLAMP(clipped_coords.x1, coords->x2  - layer_x_ofs - cir_x, clipped_coords.x2);
-
-        /*Make sure that the width and height is a multiple of skip_cnt so that back and forth blurring
-         *surely affects the same pixels */
-        x_start = (x_start / skip_cnt) * skip_cnt;
-        x_end = (x_end / skip_cnt) * skip_cnt;
-
-        if(x_start > x_end) continue;
-        uint32_t line_len_byte = (x_end - x_start + skip_cnt) * px_size;
-        uint32_t sample_len_limited = LV_MIN((x_end - x_start) / skip_cnt + 1, sample_len);
-
-
-        if(px_size == 1) {
-            /*Compiler optimization might mishandle it, so add volatile*/
-            uint8_t * buf_line_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
-
-            blur_1_bytes_init(sum, buf_line_start, sample_len_limited, px_size * skip_cnt);
-
-            uint8_t buf_prev = buf_line_start[0] + 1; /*Make sure that it's not equal in the first round*/
-            for(x = x_start + skip_cnt; x <= x_end; x += skip_cnt) {
-                if(buf_prev != *buf_line_start) {
-                    *buf_line_start = blur_1_bytes(sum, *buf_line_start, intensity);
-                    buf_prev = *buf_line_start;
-                }
-                buf_line_start += next_px_ofs_byte;
-            }
-
-            uint8_t * buf_line_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_end, y);
-            blur_1_bytes_init(sum, buf_line_end, sample_len_limited, -(int32_t)px_size * skip_cnt);
-            buf_prev = buf_line_end[0] + 1; /*Make sure that it's not equal in the first round*/
-
+    if(dsc->pass != LV_DRAW_BLUR_PASS_COLUMNS) {
+        /*The skipped pixels are filled by repeating the color channels of the blurred pixels*/
+        uint32_t gap_px_size = LV_MIN(px_size, 3);
+        lanes.lane_cnt = 1;
+        lanes.lane_step = 0;
+
+        for(y = stripe.y1; y <= stripe.y2; y += skip_cnt) {
+            int32_t cir_x = get_rounded_edge_point(coords->y1, coords->y2, layer_y_ofs + y, radius);
+            int32_t x_start = LV_CLAMP(clipped_coords.x1, coords->x1  - layer_x_ofs + cir_x, clipped_coords.x2);
+            int32_t x_end = LV_CLAMP(clipped_coords.x1, coords->x2  - layer_x_ofs - cir_x, clipped_coords.x2);
+
+            /*Make sure that the width and height is a multiple of skip_cnt so that back and forth blurring
+             *surely affects the same pixels */
+            x_start = (x_start / skip_cnt) * skip_cnt;
+            x_end = (x_end / skip_cnt) * skip_cnt;
+            if(x_start > x_end) continue;
+
+            int32_t px_cnt = (x_end - x_start) / skip_cnt + 1;
+            uint8_t * buf_line_start = lv_draw_buf_goto_xy(draw_buf, x_start, y);
+            uint8_t * buf_line_end = lv_draw_buf_goto_xy(draw_buf, x_end, y);
+            lanes.sample_len = LV_MIN(px_cnt, sample_len);
+
+            /*Except on RGB565 the last pixel is blurred only backward*/
+            lanes.px_cnt = px_size == 2 ? px_cnt : px_cnt - 1;
+            lanes.px_step = px_size * skip_cnt;
+            blur_lanes(buf_line_start, &lanes, px_size);
+
+            lanes.px_cnt = px_cnt;
+            lanes.px_step = -(int32_t)px_size * skip_cnt;
+            blur_lanes(buf_line_end, &lanes, px_size);
+
+            if(skip_cnt == 1) continue;
+
+            /*Fill the gaps in the line by just repeating the pixels (simple upscale)*/
+            uint8_t * buf_px = buf_line_start;
             for(x = x_start; x <= x_end; x += skip_cnt) {
-                if(buf_prev != *buf_line_end) {
-                    *buf_line_end = blur_1_bytes(sum, *buf_line_end, intensity);
-                    buf_prev = *buf_line_end;
-                }
-
-                /*This is the final pixel, fill the gaps in the line by just repeating the pixel (simple upscale)*/
-                if(skip_cnt == 2) {
-                    buf_line_end[1] = buf_line_end[0];
-                }
-                else if(skip_cnt == 3) {
-                    buf_line_end[1] = buf_line_end[0];
-                    buf_line_end[2] = buf_line_end[0];
+                int32_t i;
+                for(i = 1; i < skip_cnt; i++) {
+                    lv_memcpy(buf_px + i * px_size, buf_px, gap_px_size);
                 }
-
-                /*Fill the empty lines by duplicating a the finished filled lines to the gaps*/
-                if(skip_cnt > 1 && x + skip_cnt > x_end) {
-                    uint8_t * buf_copy_from = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
-                    lv_memcpy(buf_copy_from + stride_byte, buf_copy_from, line_len_byte);
-                    if(skip_cnt == 3) {
-                        lv_memcpy(buf_copy_from + stride_byte * 2, buf_copy_from, line_len_byte);
-                    }
-                }
-
-                buf_line_end -= next_px_ofs_byte;
+                buf_px += px_size * skip_cnt;
             }
 
-        }
-        else if(px_size == 2) {
-            uint16_t * buf16_line_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
-            blur_2_bytes_init(sum, (lv_color16_t *)buf16_line_start, sample_len_limited,  skip_cnt, swapped);
-
-            uint16_t buf16_prev = buf16_line_start[0] + 1; /*Make sure that it's not equal in the first round*/
-            for(x = x_start; x <= x_end; x += skip_cnt) {
-
-                if(buf16_prev != *buf16_line_start) {
-                    *buf16_line_start = blur_2_bytes(sum, *buf16_line_start, intensity, swapped);
-                    buf16_prev = *buf16_line_start;
-                }
-                buf16_line_start += skip_cnt;
-            }
-
-            uint16_t * buf16_line_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_end, y);
-            blur_2_bytes_init(sum, (lv_color16_t *)buf16_line_end, sample_len_limited, - skip_cnt, swapped);
-            buf16_prev = buf16_line_end[0] + 1; /*Make sure that it's not equal in the first round*/
-
-            for(x = x_start; x <= x_end; x += skip_cnt) {
-                if(buf16_prev != *buf16_line_end) {
-                    *buf16_line_end = blur_2_bytes(sum, *buf16_line_end, intensity, swapped);
-                    buf16_prev = *buf16_line_end;
-                }
-
-                /*This is the final pixel, fill the gaps in the line by just repeating the pixel (simple upscale)*/
-                if(skip_cnt == 2) {
-                    /*Fill the empty lines by duplicating a the finished filled lines to the gaps*/
-                    buf16_line_end[1] = buf16_line_end[0];
-                }
-                else if(skip_cnt == 3) {
-                    /*Fill the empty lines by duplicating a the finished filled lines to the gaps*/
-                    buf16_line_end[1] = buf16_line_end[0];
-                    buf16_line_end[2] = buf16_line_end[0];
-                }
-
-                /*Fill the empty lines by duplicating a the finished filled lines to the gaps*/
-                if(skip_cnt > 1 && x + skip_cnt > x_end) {
-                    uint8_t * buf_copy_from = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
-                    lv_memcpy(buf_copy_from + stride_byte, buf_copy_from, line_len_byte);
-                    if(skip_cnt == 3) {
-                        lv_memcpy(buf_copy_from + stride_byte * 2, buf_copy_from, line_len_byte);
-                    }
-                }
-
-                buf16_line_end -= skip_cnt;
+            /*Fill the empty lines by duplicating a the finished filled lines to the gaps*/
+            uint32_t line_len_byte = (x_end - x_start + skip_cnt) * px_size;
+            lv_memcpy(buf_line_start + stride_byte, buf_line_start, line_len_byte);
+            if(skip_cnt == 3) {
+                lv_memcpy(buf_line_start + stride_byte * 2, buf_line_start, line_len_byte);
             }
         }
-        else if(px_size >= 3) {
-            /*Compiler optimization might mishandle it, so add volatile*/
-            volatile uint8_t * buf_line_start = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
-
-            blur_3_bytes_init(sum, buf_line_start, sample_len_limited, px_size * skip_cnt);
-            for(x = x_start + skip_cnt; x <= x_end; x += skip_cnt) {
-                blur_3_bytes(sum, buf_line_start, intensity);
-                buf_line_start += next_px_ofs_byte;
-            }
-
-            volatile uint8_t * buf_line_end = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_end, y);
-            blur_3_bytes_init(sum, buf_line_end, sample_len_limited, -(int32_t)px_size * skip_cnt);
-
-            for(x = x_start; x <= x_end; x += skip_cnt) {
-                blur_3_bytes(sum, buf_line_end, intensity);
-
-                /*This is the final pixel, fill the gaps in the line by just repeating the pixel (simple upscale)*/
-                if(skip_cnt == 2) {
-                    buf_line_end[px_size + 0] = buf_line_end[0];
-                    buf_line_end[px_size + 1] = buf_line_end[1];
-                    buf_line_end[px_size + 2] = buf_line_end[2];
-                }
-                else if(skip_cnt == 3) {
-                    buf_line_end[px_size + 0] = buf_line_end[0];
-                    buf_line_end[px_size + 1] = buf_line_end[1];
-                    buf_line_end[px_size + 2] = buf_line_end[2];
-                    buf_line_end[px_size * 2 + 0] = buf_line_end[0];
-                    buf_line_end[px_size * 2 + 1] = buf_line_end[1];
-                    buf_line_end[px_size * 2 + 2] = buf_line_end[2];
-                }
-
-                /*Fill the empty lines by duplicating a the finished filled lines to the gaps*/
-                if(skip_cnt > 1 && x + skip_cnt > x_end) {
-                    uint8_t * buf_copy_from = lv_draw_buf_goto_xy(t->target_layer->draw_buf, x_start, y);
-                    lv_memcpy(buf_copy_from + stride_byte, buf_copy_from, line_len_byte);
-                    if(skip_cnt == 3) {
-                        lv_memcpy(buf_copy_from + stride_byte * 2, buf_copy_from, line_len_byte);
-                    }
-                }
-
-                buf_line_end -= next_px_ofs_byte;
-            }
-
-        }
     }
 
     LV_PROFILER_DRAW_END;
@@ -366,60 +259,140 @@ void lv_draw_sw_blur(lv_draw_task_t * t, const lv_draw_blur_dsc_t * dsc, const l
  *   STATIC FUNCTIONS
  **********************/
 
-static void blur_1_bytes_init(uint32_t * sum, uint8_t * buf, uint32_t sample_len, int32_t stride)
+static void blur_lanes(uint8_t * buf, const blur_lanes_t * lanes, uint32_t px_size)
 {
-    uint32_t s;
+    if(px_size == 1) blur_lanes_1_byte(buf, lanes);
+    else if(px_size == 2) blur_lanes_2_bytes(buf, lanes);
+    else if(px_size >= 3) blur_lanes_3_bytes(buf, lanes);
+}
 
-    sum[0] = 0;
+static void blur_lanes_1_byte(uint8_t * buf, const blur_lanes_t * lanes)
+{
+    uint32_t sum[BLUR_LANE_MAX];
+    uint8_t prev[BLUR_LANE_MAX];
+    int32_t lane_cnt = lanes->lane_cnt;
+    int32_t lane_step = lanes->lane_step;
+    uint32_t intensity = lanes->intensity;
+    uint8_t * px = buf;
+    int32_t l;
+    int32_t i;
+
+    for(l = 0; l < lane_cnt; l++) sum[l] = 0;
+
+    for(i = 0; i < (int32_t)lanes->sample_len; i++) {
+        for(l = 0; l < lane_cnt; l++) {
+            sum[l] += px[l * lane_step];
+        }
+        px += lanes->px_step;
+    }
+
+    for(l = 0; l < lane_cnt; l++) {
+        sum[l] = (sum[l] << BLUR_INTENSITY_BITS) / lanes->sample_len;
+        prev[l] = buf[l * lane_step] + 1; /*Make sure that it's not equal in the first round*/
+    }
 
-    for(s = 0; s < sample_len; s++) {
-        sum[0] += buf[0];
-        buf += stride;
+    px = buf;
+    for(i = 0; i < lanes->px_cnt; i++) {
+        for(l = 0; l < lane_cnt; l++) {
+            uint8_t * p = &px[l * lane_step];
+            if(prev[l] != *p) {
+                *p = blur_1_bytes(&sum[l], *p, intensity);
+                prev[l] = *p;
+            }
+        }
+        px += lanes->px_step;
     }
-    sum[0] = (sum[0] << BLUR_INTENSITY_BITS) / sample_len;
 }
 
-static void blur_3_bytes_init(uint32_t * sum, volatile uint8_t * buf, uint32_t sample_len, int32_t stride)
+static void blur_lanes_2_bytes(uint8_t * buf, const blur_lanes_t * lanes)
 {
-    uint32_t s;
+    uint32_t sum[BLUR_LANE_MAX][3];
+    uint16_t prev[BLUR_LANE_MAX];
+    int32_t lane_cnt = lanes->lane_cnt;
+    int32_t lane_step = lanes->lane_step;
+    uint32_t intensity = lanes->intensity;
+    bool swapped = lanes->swapped;
+    uint8_t * px = buf;
+    int32_t l;
+    int32_t i;
+
+    for(l = 0; l < lane_cnt; l++) {
+        sum[l][0] = 0;
+        sum[l][1] = 0;
+        sum[l][2] = 0;
+    }
 
-    sum[0] = 0;
-    sum[1] = 0;
-    sum[2] = 0;
+    for(i = 0; i < (int32_t)lanes->sample_len; i++) {
+        for(l = 0; l < lane_cnt; l++) {
+            uint16_t v = *(uint16_t *)&px[l * lane_step];
+            if(swapped) v = (v >> 8) | (v << 8);
+            sum[l][0] += v >> 11;
+            sum[l][1] += (v >> 5) & 0x3F;
+            sum[l][2] += v & 0x1F;
+        }
+        px += lanes->px_step;
+    }
 
-    for(s = 0; s < sample_len; s++) {
-        sum[0] += buf[0];
-        sum[1] += buf[1];
-        sum[2] += buf[2];
-        buf += stride;
+    for(l = 0; l < lane_cnt; l++) {
+        sum[l][0] = (sum[l][0] << BLUR_INTENSITY_BITS) / lanes->sample_len;
+        sum[l][1] = (sum[l][1] << BLUR_INTENSITY_BITS) / lanes->sample_len;
+        sum[l][2] = (sum[l][2] << BLUR_INTENSITY_BITS) / lanes->sample_len;
+        prev[l] = *(uint16_t *)&buf[l * lane_step] + 1; /*Make sure that it's not equal in the first round*/
+    }
+
+    px = buf;
+    for(i = 0; i < lanes->px_cnt; i++) {
+        for(l = 0; l < lane_cnt; l++) {
+            uint16_t * p = (uint16_t *)&px[l * lane_step];
+            if(prev[l] != *p) {
+                *p = blur_2_bytes(sum[l], *p, intensity, swapped);
+                prev[l] = *p;
+            }
+        }
+        px += lanes->px_step;
     }
-    sum[0] = (sum[0] << BLUR_INTENSITY_BITS) / sample_len;
-    sum[1] = (sum[1] << BLUR_INTENSITY_BITS) / sample_len;
-    sum[2] = (sum[2] << BLUR_INTENSITY_BITS) / sample_len;
 }
 
-static void blur_2_bytes_init(uint32_t * sum, lv_color16_t * buf, uint32_t sample_len, int32_t stride, bool swapped)
+static void blur_lanes_3_bytes(uint8_t * buf, const blur_lanes_t * lanes)
 {
-    uint32_t s;
-
-    sum[0] = 0;
-    sum[1] = 0;
-    sum[2] = 0;
-    for(s = 0; s < sample_len; s++) {
-        uint16_t v = *(uint16_t *)buf;
-        if(swapped) v = (v >> 8) | (v << 8);
-        lv_color16_t * c = (lv_color16_t *)&v;
-        sum[0] += c->red;
-        sum[1] += c->green;
-        sum[2] += c->blue;
-        buf += stride;
+    uint32_t sum[BLUR_LANE_MAX][3];
+    int32_t lane_cnt = lanes->lane_cnt;
+    int32_t lane_step = lanes->lane_step;
+    uint32_t intensity = lanes->intensity;
+    uint8_t * px = buf;
+    int32_t l;
+    int32_t i;
+
+    for(l = 0; l < lane_cnt; l++) {
+        sum[l][0] = 0;
+        sum[l][1] = 0;
+        sum[l][2] = 0;
     }
 
-    sum[0] = (sum[0] << BLUR_INTENSITY_BITS) / sample_len;
-    sum[1] = (sum[1] << BLUR_INTENSITY_BITS) / sample_len;
-    sum[2] = (sum[2] << BLUR_INTENSITY_BITS) / sample_len;
-}
+    for(i = 0; i < (int32_t)lanes->sample_len; i++) {
+        for(l = 0; l < lane_cnt; l++) {
+            const uint8_t * p = &px[l * lane_step];
+            sum[l][0] += p[0];
+            sum[l][1] += p[1];
+            sum[l][2] += p[2];
+        }
+        px += lanes->px_step;
+    }
 
+    for(l = 0; l < lane_cnt; l++) {
+        sum[l][0] = (sum[l][0] << BLUR_INTENSITY_BITS) / lanes->sample_len;
+        sum[l][1] = (sum[l][1] << BLUR_INTENSITY_BITS) / lanes->sample_len;
+        sum[l][2] = (sum[l][2] << BLUR_INTENSITY_BITS) / lanes->sample_len;
+    }
+
+    px = buf;
+    for(i = 0; i < lanes->px_cnt; i++) {
+        for(l = 0; l < lane_cnt; l++) {
+            blur_3_bytes(sum[l], &px[l * lane_step], intensity);
+        }
+        px += lanes->px_step;
+    }
+}
 
 static inline uint8_t blur_1_bytes(uint32_t * sum, uint8_t px, uint32_t intensity)
 {
@@ -465,9 +438,7 @@ static inline uint16_t blur_2_bytes(uint32_t * sum, uint16_t px, uint32_t intens
     return res;
 }
 
-
-
-static inline void blur_3_bytes(uint32_t * sum, volatile uint8_t * buf, uint32_t intensity)
+static inline void blur_3_bytes(uint32_t * sum, uint8_t * buf, uint32_t intensity)
 {
     uint32_t intensity_inv = BLUR_INTENSITY_MAX - intensity;
 
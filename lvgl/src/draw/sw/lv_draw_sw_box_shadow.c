@@ -21,6 +21,9 @@
 #include "../../misc/lv_assert.h"
 #include "../../stdlib/lv_string.h"
 #include "../lv_draw_mask.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_private.h"
+#include "lv_draw_sw_private.h"
 
 /*********************
  *      DEFINES
@@ -36,12 +39,30 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+typedef struct {
+    lv_cache_slot_size_t slot;      /*Must be the first*/
+    int32_t corner_size;
+    int32_t r;
+    int32_t w;                      /*Width of the core area, limited to the size affecting the corner*/
+    int32_t h;                      /*Height of the core area, limited to the size affecting the corner*/
+    lv_opa_t * buf;                 /*The right corner followed by the mirrored (left) corner*/
+} shadow_cache_data_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    static lv_cache_entry_t * shadow_cache_acquire(const lv_area_t * core_area, int32_t sw, int32_t r);
+    static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                          const shadow_cache_data_t * rhs);
+    static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data);
+    static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +76,31 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t
  *   GLOBAL FUNCTIONS
  **********************/
 
+void lv_draw_sw_box_shadow_cache_init(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache != NULL) return;
+
+    shadow_cache = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(shadow_cache_data_t), LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) shadow_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) shadow_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) shadow_cache_free_cb,
+    });
+    lv_cache_set_name(shadow_cache, "SW_SHADOW");
+#endif
+}
+
+void lv_draw_sw_box_shadow_cache_deinit(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(shadow_cache == NULL) return;
+
+    lv_cache_destroy(shadow_cache, NULL);
+    shadow_cache = NULL;
+#endif
+}
+
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
@@ -97,34 +143,28 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
+    lv_opa_t * sh_buf = NULL;
+    lv_opa_t * sh_buf_mirrored = NULL;
+    lv_cache_entry_t * sh_entry = NULL;
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        LV_ASSERT_MALLOC(sh_buf);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
+    /*The cached corners are shared with the other draw tasks, so they are used without copying and modifying*/
+    if(corner_size <= LV_DRAW_SW_SHADOW_CACHE_SIZE) {
+        sh_entry = shadow_cache_acquire(&core_area, dsc->width, r_sh);
+        if(sh_entry) {
+            shadow_cache_data_t * data = lv_cache_entry_get_data(sh_entry);
+            sh_buf = data->buf;
+            sh_buf_mirrored = data->buf + corner_size * corner_size;
+        }
     }
-    else {
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
+    if(sh_buf == NULL) {
         /*A larger buffer is required for calculation*/
         sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
         LV_ASSERT_MALLOC(sh_buf);
         shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
     }
-#else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    LV_ASSERT_MALLOC(sh_buf);
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
     bool simple = dsc->bg_cover;
@@ -382,21 +422,26 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
         }
     }
 
-    /*Mirror the shadow corner buffer horizontally*/
-    sh_buf_tmp = sh_buf ;
-    for(y = 0; y < corner_size; y++) {
-        int32_t x;
-        lv_opa_t * start = sh_buf_tmp;
-        lv_opa_t * end = sh_buf_tmp + corner_size - 1;
-        for(x = 0; x < corner_size / 2; x++) {
-            lv_opa_t tmp = *start;
-            *start = *end;
-            *end = tmp;
-
-            start++;
-            end--;
+    /*Mirror the shadow corner buffer horizontally. The cached corners have a mirrored copy.*/
+    if(sh_buf_mirrored) {
+        sh_buf = sh_buf_mirrored;
+    }
+    else {
+        sh_buf_tmp = sh_buf;
+        for(y = 0; y < corner_size; y++) {
+            int32_t x;
+            lv_opa_t * start = sh_buf_tmp;
+            lv_opa_t * end = sh_buf_tmp + corner_size - 1;
+            for(x = 0; x < corner_size / 2; x++) {
+                lv_opa_t tmp = *start;
+                *start = *end;
+                *end = tmp;
+
+                start++;
+                end--;
+            }
+            sh_buf_tmp += corner_size;
         }
-        sh_buf_tmp += corner_size;
     }
 
     /*Left side*/
@@ -555,7 +600,13 @@ void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t *
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    if(sh_entry) lv_cache_release(shadow_cache, sh_entry, NULL);
+    else lv_free(sh_buf);
+#else
+    LV_UNUSED(sh_entry);
     lv_free(sh_buf);
+#endif
     lv_free(mask_buf);
 }
 
@@ -730,6 +781,81 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
     lv_free(sh_ups_blur_buf);
 }
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+/**
+ * Get a shadow corner from the cache or calculate it and add it to the cache.
+ * @param core_area     the area to blur
+ * @param sw            the width of the shadow
+ * @param r             the radius of the shadow
+ * @return              the cache entry or NULL if the corner couldn't be cached
+ */
+static lv_cache_entry_t * shadow_cache_acquire(const lv_area_t * core_area, int32_t sw, int32_t r)
+{
+    if(shadow_cache == NULL) return NULL;
+
+    int32_t corner_size = sw + r;
+    shadow_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.slot.size = corner_size * corner_size * 2;
+    search_key.corner_size = corner_size;
+    search_key.r = r;
+    /*The other side of larger areas doesn't affect the corner*/
+    search_key.w = LV_MIN(lv_area_get_width(core_area), corner_size * 2);
+    search_key.h = LV_MIN(lv_area_get_height(core_area), corner_size * 2);
+
+    if(search_key.slot.size > LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY) return NULL;
+
+    return lv_cache_acquire_or_create(shadow_cache, &search_key, NULL);
+}
+
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_data_t * lhs,
+                                                      const shadow_cache_data_t * rhs)
+{
+    if(lhs->corner_size != rhs->corner_size) return lhs->corner_size > rhs->corner_size ? 1 : -1;
+    if(lhs->r != rhs->r) return lhs->r > rhs->r ? 1 : -1;
+    if(lhs->w != rhs->w) return lhs->w > rhs->w ? 1 : -1;
+    if(lhs->h != rhs->h) return lhs->h > rhs->h ? 1 : -1;
+    return 0;
+}
+
+static bool shadow_cache_create_cb(shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    int32_t corner_size = data->corner_size;
+    /*The calculation needs 16 bit per pixel, which is the size of the corner and its mirrored version*/
+    data->buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(data->buf);
+    if(data->buf == NULL) return false;
+
+    lv_area_t core_area;
+    lv_area_set(&core_area, 0, 0, data->w - 1, data->h - 1);
+    shadow_draw_corner_buf(&core_area, (uint16_t *)data->buf, corner_size - data->r, data->r);
+
+    lv_opa_t * src = data->buf;
+    lv_opa_t * dest = data->buf + corner_size * corner_size;
+    int32_t y;
+    for(y = 0; y < corner_size; y++) {
+        int32_t x;
+        for(x = 0; x < corner_size; x++) {
+            dest[x] = src[corner_size - 1 - x];
+        }
+        src += corner_size;
+        dest += corner_size;
+    }
+
+    return true;
+}
+
+static void shadow_cache_free_cb(shadow_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->buf);
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_box_shadow(lv_draw_task_t * t, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
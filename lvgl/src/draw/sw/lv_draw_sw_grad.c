@@ -12,6 +12,10 @@
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os_private.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_private.h"
+#include "../../core/lv_global.h"
+#include "../../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -19,6 +23,10 @@
 #define GRAD_CM(r,g,b) lv_color_make(r,g,b)
 #define GRAD_CONV(t, x) t = x
 
+#define grad_cache_p        LV_GLOBAL_DEFAULT()->sw_grad_cache
+#define grad_cache_hit_cnt  LV_GLOBAL_DEFAULT()->sw_grad_cache_hit_cnt
+#define grad_cache_miss_cnt LV_GLOBAL_DEFAULT()->sw_grad_cache_miss_cnt
+
 #undef ALIGN
 #if defined(LV_ARCH_64)
     #define ALIGN(X)    (((X) + 7) & ~7)
@@ -30,6 +38,19 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+
+/*The color maps depend only on the stops and the number of elements*/
+typedef struct {
+    lv_cache_slot_size_t slot;      /*Must be the first*/
+    uint32_t size;
+    uint32_t stops_count;
+    lv_grad_stop_t stops[LV_GRADIENT_MAX_STOPS];
+    lv_draw_sw_grad_calc_t * grad;
+} grad_cache_data_t;
+
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 typedef struct {
@@ -72,8 +93,16 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-typedef lv_result_t (*op_cache_t)(lv_draw_sw_grad_calc_t * c, void * ctx);
-static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static size_t get_item_size(int32_t size);
+static lv_draw_sw_grad_calc_t * allocate_item(int32_t size);
+static lv_draw_sw_grad_calc_t * get_map(const lv_grad_dsc_t * g, int32_t size);
+static void fill_map(const lv_grad_dsc_t * g, lv_draw_sw_grad_calc_t * item);
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+    static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs);
+    static bool grad_cache_create_cb(grad_cache_data_t * data, const lv_grad_dsc_t * g);
+    static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data);
+#endif
 
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
@@ -89,26 +118,14 @@ static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+static size_t get_item_size(int32_t size)
 {
-    int32_t size;
-    switch(g->dir) {
-        case LV_GRAD_DIR_HOR:
-        case LV_GRAD_DIR_LINEAR:
-        case LV_GRAD_DIR_RADIAL:
-        case LV_GRAD_DIR_CONICAL:
-            size = w;
-            break;
-        case LV_GRAD_DIR_VER:
-            size = h;
-            break;
-        default:
-            size = 64;
-    }
+    return ALIGN(sizeof(lv_draw_sw_grad_calc_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+}
 
-    size_t req_size = ALIGN(sizeof(lv_draw_sw_grad_calc_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(
-                                                                                                           lv_opa_t));
-    lv_draw_sw_grad_calc_t * item  = lv_malloc(req_size);
+static lv_draw_sw_grad_calc_t * allocate_item(int32_t size)
+{
+    lv_draw_sw_grad_calc_t * item  = lv_malloc(get_item_size(size));
     LV_ASSERT_MALLOC(item);
     if(item == NULL) return NULL;
 
@@ -116,9 +133,83 @@ static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w
     item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
     item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
     item->size = size;
+    item->cache_entry = NULL;
     return item;
 }
 
+static void fill_map(const lv_grad_dsc_t * g, lv_draw_sw_grad_calc_t * item)
+{
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_draw_sw_grad_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+}
+
+/**
+ * Get the color map of a gradient from the cache or calculate it.
+ * The maps got from the cache are shared, so they must not be modified.
+ */
+static lv_draw_sw_grad_calc_t * get_map(const lv_grad_dsc_t * g, int32_t size)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+    size_t item_size = get_item_size(size);
+    if(grad_cache_p && item_size <= LV_DRAW_SW_GRADIENT_CACHE_SIZE) {
+        grad_cache_data_t search_key;
+        lv_memzero(&search_key, sizeof(search_key));
+        search_key.slot.size = item_size;
+        search_key.size = size;
+        search_key.stops_count = g->stops_count;
+        lv_memcpy(search_key.stops, g->stops, g->stops_count * sizeof(lv_grad_stop_t));
+
+        uint32_t miss_cnt = grad_cache_miss_cnt;
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(grad_cache_p, &search_key, (void *)g);
+        if(entry) {
+            if(miss_cnt == grad_cache_miss_cnt) grad_cache_hit_cnt++;
+            grad_cache_data_t * data = lv_cache_entry_get_data(entry);
+            return data->grad;
+        }
+    }
+#endif
+
+    lv_draw_sw_grad_calc_t * item = allocate_item(size);
+    if(item == NULL) return NULL;
+
+    fill_map(g, item);
+    return item;
+}
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+
+static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs)
+{
+    if(lhs->size != rhs->size) return lhs->size > rhs->size ? 1 : -1;
+    if(lhs->stops_count != rhs->stops_count) return lhs->stops_count > rhs->stops_count ? 1 : -1;
+
+    int32_t cmp_res = lv_memcmp(lhs->stops, rhs->stops, lhs->stops_count * sizeof(lv_grad_stop_t));
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static bool grad_cache_create_cb(grad_cache_data_t * data, const lv_grad_dsc_t * g)
+{
+    data->grad = allocate_item(data->size);
+    if(data->grad == NULL) return false;
+
+    fill_map(g, data->grad);
+    data->grad->cache_entry = lv_cache_entry_get_entry(data, grad_cache_p->node_size);
+    grad_cache_miss_cnt++;
+    return true;
+}
+
+static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->grad);
+}
+
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
@@ -142,23 +233,79 @@ static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
  *     FUNCTIONS
  **********************/
 
+void lv_draw_sw_grad_cache_init(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+    if(grad_cache_p != NULL) return;
+
+    grad_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(grad_cache_data_t), LV_DRAW_SW_GRADIENT_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) grad_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) grad_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) grad_cache_free_cb,
+    });
+    lv_cache_set_name(grad_cache_p, "SW_GRADIENT");
+    grad_cache_hit_cnt = 0;
+    grad_cache_miss_cnt = 0;
+#endif
+}
+
+void lv_draw_sw_grad_cache_deinit(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+    if(grad_cache_p == NULL) return;
+
+    lv_cache_destroy(grad_cache_p, NULL);
+    grad_cache_p = NULL;
+#endif
+}
+
+void lv_draw_sw_grad_cache_get_stats(lv_draw_sw_grad_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    lv_memzero(stats, sizeof(lv_draw_sw_grad_cache_stats_t));
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+    if(grad_cache_p == NULL) return;
+
+    stats->hit_cnt = grad_cache_hit_cnt;
+    stats->miss_cnt = grad_cache_miss_cnt;
+    stats->size = lv_cache_get_size(grad_cache_p, NULL);
+    stats->max_size = lv_cache_get_max_size(grad_cache_p, NULL);
+#endif
+}
+
 lv_draw_sw_grad_calc_t * lv_draw_sw_grad_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 1: Search cache for the given key */
-    lv_draw_sw_grad_calc_t * item = allocate_item(g, w, h);
-    if(item == NULL) {
-        LV_LOG_WARN("Failed to allocate item for the gradient");
-        return item;
+    int32_t size;
+    switch(g->dir) {
+        case LV_GRAD_DIR_HOR:
+        case LV_GRAD_DIR_LINEAR:
+        case LV_GRAD_DIR_RADIAL:
+        case LV_GRAD_DIR_CONICAL:
+            size = w;
+            break;
+        case LV_GRAD_DIR_VER:
+            size = h;
+            break;
+        default:
+            size = 64;
     }
 
-    /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_draw_sw_grad_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+    /* The complex gradients use the maps only as line buffers
+     * (their color maps are created by the setup functions), so don't fill or share them */
+    if(g->dir >= LV_GRAD_DIR_LINEAR) {
+        lv_draw_sw_grad_calc_t * item = allocate_item(size);
+        if(item == NULL) LV_LOG_WARN("Failed to allocate item for the gradient");
+        return item;
     }
+#endif
+
+    lv_draw_sw_grad_calc_t * item = get_map(g, size);
+    if(item == NULL) LV_LOG_WARN("Failed to allocate item for the gradient");
     return item;
 }
 
@@ -217,6 +364,13 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_color_calculate(const lv_grad_dsc_t *
 
 void lv_draw_sw_grad_cleanup(lv_draw_sw_grad_calc_t * grad)
 {
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+    if(grad->cache_entry) {
+        lv_cache_release(grad_cache_p, grad->cache_entry, NULL);
+        return;
+    }
+#endif
+
     lv_free(grad);
 }
 
@@ -295,7 +449,7 @@ void lv_draw_sw_grad_radial_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     LV_ASSERT(r_end != 0);
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = get_map(dsc, 256);
 
     state->x0 = start.x;
     state->y0 = start.y;
@@ -464,7 +618,7 @@ void lv_draw_sw_grad_linear_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords)
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = get_map(dsc, 256);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -492,7 +646,7 @@ void lv_draw_sw_grad_linear_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_draw_sw_grad_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -539,7 +693,7 @@ void lv_draw_sw_grad_conical_setup(lv_grad_dsc_t * dsc, const lv_area_t * coords
     dsc->state = state;
 
     /* Create gradient color map */
-    state->cgrad = lv_draw_sw_grad_get(dsc, 256, 0);
+    state->cgrad = get_map(dsc, 256);
 
     /* Convert from percentage coordinates */
     int32_t wdt = lv_area_get_width(coords);
@@ -564,7 +718,7 @@ void lv_draw_sw_grad_conical_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_draw_sw_grad_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -30,8 +30,17 @@ typedef struct {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    lv_cache_entry_t * cache_entry;     /**< The entry in the gradient cache or NULL if not cached */
 } lv_draw_sw_grad_calc_t;
 
+/** Statistics of the gradient cache. See `LV_DRAW_SW_GRADIENT_CACHE_SIZE` */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of color maps reused from the cache */
+    uint32_t miss_cnt;      /**< Number of color maps calculated and added to the cache */
+    uint32_t size;          /**< Current size of the cached color maps in bytes */
+    uint32_t max_size;      /**< Maximum size of the cached color maps in bytes */
+} lv_draw_sw_grad_cache_stats_t;
+
 
 /**********************
  *      PROTOTYPES
@@ -49,7 +58,31 @@ typedef struct {
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_grad_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
                                                                  int32_t frac, lv_color_t * color_out, lv_opa_t * opa_out);
 
-/** Get a gradient cache from the given parameters */
+/**
+ * Create the cache of the gradient color maps
+ */
+void lv_draw_sw_grad_cache_init(void);
+
+/**
+ * Free the gradient color maps and delete their cache
+ */
+void lv_draw_sw_grad_cache_deinit(void);
+
+/**
+ * Get the statistics of the gradient cache. All values are 0 if the cache is disabled.
+ * @param stats     store the statistics here
+ */
+void lv_draw_sw_grad_cache_get_stats(lv_draw_sw_grad_cache_stats_t * stats);
+
+/**
+ * Get the color and opacity map of a gradient. Horizontal and vertical gradients are taken
+ * from the gradient cache if possible. For the other gradients the maps are only allocated
+ * to be used as line buffers.
+ * @param gradient  the gradient descriptor
+ * @param w         the width of the area to fill
+ * @param h         the height of the area to fill
+ * @return          the maps or NULL on error. Free it with `lv_draw_sw_grad_cleanup()`
+ */
 lv_draw_sw_grad_calc_t * lv_draw_sw_grad_get(const lv_grad_dsc_t * gradient, int32_t w, int32_t h);
 
 /**
@@ -23,10 +23,33 @@
  *      DEFINES
  *********************/
 
+/*The polylines are rasterized with 1/16 pixel precision*/
+#define SUBPX_SHIFT 4
+#define SUBPX       (1 << SUBPX_SHIFT)
+
+/*Precision of the segments' direction vectors*/
+#define DIR_SHIFT   12
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*A segment of a polyline with coordinates in subpixels*/
+typedef struct {
+    int32_t x1;
+    int32_t y1;
+    int32_t x2;
+    int32_t y2;
+    int32_t len;
+    int32_t ux;                 /*Unit direction vector in 1 << DIR_SHIFT units*/
+    int32_t uy;
+    int32_t row_first;          /*First and last row whose pixels can be covered*/
+    int32_t row_last;
+    int32_t next;               /*Index of the next segment with the same `row_first`, or -1*/
+    uint8_t butt_start : 1;     /*1: the start is the end of the line and has a butt cap; 0: round join or cap*/
+    uint8_t butt_end : 1;
+} polyline_seg_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -34,6 +57,12 @@
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_skew(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_hor(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_ver(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc);
+static inline bool point_is_none(const lv_point_precise_t * p);
+static int32_t collect_segments(const lv_draw_line_dsc_t * dsc, const lv_area_t * clip, int32_t r,
+                                polyline_seg_t * segs, int32_t * row_first_seg);
+static void get_row_span(const polyline_seg_t * s, int32_t y, int32_t ext, int32_t * xs, int32_t * xe);
+static inline lv_opa_t get_coverage(const polyline_seg_t * s, int32_t x, int32_t y, int32_t r);
+static inline int32_t get_dist(int32_t dx, int32_t dy, int32_t r);
 
 /**********************
  *  STATIC VARIABLES
@@ -99,6 +128,116 @@ void lv_draw_sw_line(lv_draw_task_t * t, const lv_draw_line_dsc_t * dsc)
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_sw_polyline(lv_draw_task_t * t, lv_draw_line_dsc_t * dsc)
+{
+    /*Dashes are drawn only by the segment based renderer*/
+    if(dsc->points == NULL || (dsc->dash_width && dsc->dash_gap)) {
+        lv_draw_line_iterate(t, dsc, lv_draw_sw_line);
+        return;
+    }
+
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+    if(dsc->point_cnt < 2) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    const lv_area_t * clip = &t->clip_area;
+    int32_t clip_w = lv_area_get_width(clip);
+    int32_t clip_h = lv_area_get_height(clip);
+
+    polyline_seg_t * segs = lv_malloc((dsc->point_cnt - 1) * sizeof(polyline_seg_t));
+    int32_t * active = lv_malloc((dsc->point_cnt - 1) * sizeof(int32_t));
+    int32_t * row_first_seg = lv_malloc(clip_h * sizeof(int32_t));
+    lv_opa_t * mask_buf = lv_malloc(clip_w);
+    if(segs == NULL || active == NULL || row_first_seg == NULL || mask_buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate the buffers to draw the polyline");
+        lv_free(segs);
+        lv_free(active);
+        lv_free(row_first_seg);
+        lv_free(mask_buf);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    lv_memset(row_first_seg, 0xff, clip_h * sizeof(int32_t));  /*-1: no segment starts in the row*/
+    lv_memzero(mask_buf, clip_w);
+
+    int32_t r = dsc->width * (SUBPX / 2);
+    int32_t seg_cnt = collect_segments(dsc, clip, r, segs, row_first_seg);
+
+    lv_area_t blend_area;
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &blend_area;
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+
+    /*Go through the rows once and merge the coverage of all segments crossing a row.
+     *As the coverages are merged with `max` the joints are not blended twice.*/
+    int32_t active_cnt = 0;
+    int32_t y;
+    for(y = clip->y1; y <= clip->y2 && seg_cnt > 0; y++) {
+        int32_t s_idx;
+        for(s_idx = row_first_seg[y - clip->y1]; s_idx >= 0; s_idx = segs[s_idx].next) {
+            active[active_cnt] = s_idx;
+            active_cnt++;
+        }
+        if(active_cnt == 0) continue;
+
+        int32_t x_min = LV_COORD_MAX;
+        int32_t x_max = LV_COORD_MIN;
+        int32_t i = 0;
+        while(i < active_cnt) {
+            const polyline_seg_t * s = &segs[active[i]];
+            if(s->row_last < y) {
+                active_cnt--;
+                active[i] = active[active_cnt];
+                continue;
+            }
+            i++;
+
+            int32_t xs;
+            int32_t xe;
+            get_row_span(s, y * SUBPX, r + SUBPX, &xs, &xe);
+            xs = LV_MAX(xs, clip->x1);
+            xe = LV_MIN(xe, clip->x2);
+            if(xs > xe) continue;
+
+            x_min = LV_MIN(x_min, xs);
+            x_max = LV_MAX(x_max, xe);
+
+            lv_opa_t * mask = &mask_buf[xs - clip->x1];
+            int32_t x;
+            for(x = xs; x <= xe; x++) {
+                lv_opa_t cov = get_coverage(s, x * SUBPX, y * SUBPX, r);
+                if(cov > *mask) *mask = cov;
+                mask++;
+            }
+        }
+
+        if(x_min > x_max) continue;
+
+        blend_area.x1 = x_min;
+        blend_area.x2 = x_max;
+        blend_area.y1 = y;
+        blend_area.y2 = y;
+        blend_dsc.mask_buf = &mask_buf[x_min - clip->x1];
+        blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(t, &blend_dsc);
+
+        lv_memzero(&mask_buf[x_min - clip->x1], x_max - x_min + 1);
+    }
+
+    lv_free(segs);
+    lv_free(active);
+    lv_free(row_first_seg);
+    lv_free(mask_buf);
+
+    LV_PROFILER_DRAW_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -407,4 +546,161 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_task_t * t, const lv_dr
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
 
+static inline bool point_is_none(const lv_point_precise_t * p)
+{
+    return p->x == LV_DRAW_LINE_POINT_NONE || p->y == LV_DRAW_LINE_POINT_NONE;
+}
+
+/**
+ * Convert the visible segments of a polyline to `polyline_seg_t` and add them
+ * to the linked list of the row where they start to affect the pixels.
+ * @return      number of segments
+ */
+static int32_t collect_segments(const lv_draw_line_dsc_t * dsc, const lv_area_t * clip, int32_t r,
+                                polyline_seg_t * segs, int32_t * row_first_seg)
+{
+    /*The middle of an even wide line is between two pixels, shift it to cover the same pixels as `lv_draw_sw_line`*/
+    int32_t ofs = (dsc->width & 1) ? 0 : -SUBPX / 2;
+    int32_t ext = r + SUBPX;
+    int32_t seg_cnt = 0;
+    int32_t i;
+    for(i = 0; i < dsc->point_cnt - 1; i++) {
+        const lv_point_precise_t * p1 = &dsc->points[i];
+        const lv_point_precise_t * p2 = &dsc->points[i + 1];
+        if(point_is_none(p1) || point_is_none(p2)) continue;
+
+        polyline_seg_t * s = &segs[seg_cnt];
+        s->x1 = (int32_t)(p1->x * SUBPX) + ofs;
+        s->y1 = (int32_t)(p1->y * SUBPX) + ofs;
+        s->x2 = (int32_t)(p2->x * SUBPX) + ofs;
+        s->y2 = (int32_t)(p2->y * SUBPX) + ofs;
+
+        int32_t x_first = (LV_MIN(s->x1, s->x2) - ext) >> SUBPX_SHIFT;
+        int32_t x_last = (LV_MAX(s->x1, s->x2) + ext + SUBPX - 1) >> SUBPX_SHIFT;
+        s->row_first = (LV_MIN(s->y1, s->y2) - ext) >> SUBPX_SHIFT;
+        s->row_last = (LV_MAX(s->y1, s->y2) + ext + SUBPX - 1) >> SUBPX_SHIFT;
+        if(x_first > clip->x2 || x_last < clip->x1 || s->row_first > clip->y2 || s->row_last < clip->y1) continue;
+
+        int32_t dx = s->x2 - s->x1;
+        int32_t dy = s->y2 - s->y1;
+        int64_t len_sqr = (int64_t)dx * dx + (int64_t)dy * dy;
+        int32_t len_shift = 0;
+        while(len_sqr > (int64_t)UINT32_MAX) {
+            len_sqr >>= 2;
+            len_shift++;
+        }
+        s->len = lv_sqrt32((uint32_t)len_sqr) << len_shift;
+
+        if(s->len > 0) {
+            s->ux = (int32_t)((int64_t)dx * (1 << DIR_SHIFT) / s->len);
+            s->uy = (int32_t)((int64_t)dy * (1 << DIR_SHIFT) / s->len);
+        }
+        else {
+            s->ux = 0;
+            s->uy = 0;
+        }
+
+        /*Use round joins between the segments and butt caps at the ends of the line unless rounding is requested.
+         *A zero length segment is always drawn as a dot.*/
+        bool first = i == 0 || point_is_none(&dsc->points[i - 1]);
+        bool last = i + 2 >= dsc->point_cnt || point_is_none(&dsc->points[i + 2]);
+        s->butt_start = first && !dsc->round_start && s->len > 0;
+        s->butt_end = last && !dsc->round_end && s->len > 0;
+
+        if(s->row_first < clip->y1) s->row_first = clip->y1;
+        s->next = row_first_seg[s->row_first - clip->y1];
+        row_first_seg[s->row_first - clip->y1] = seg_cnt;
+        seg_cnt++;
+    }
+
+    return seg_cnt;
+}
+
+/**
+ * Get the range of pixels in a row which might be covered by a segment
+ * @param s         the segment
+ * @param y         y coordinate of the row's pixel centers in subpixels
+ * @param ext       distance from the middle line where pixels can be covered in subpixels
+ * @param xs        store the first pixel here
+ * @param xe        store the last pixel here
+ */
+static void get_row_span(const polyline_seg_t * s, int32_t y, int32_t ext, int32_t * xs, int32_t * xe)
+{
+    int32_t x_min;
+    int32_t x_max;
+    int32_t dy = s->y2 - s->y1;
+    if(dy == 0) {
+        x_min = LV_MIN(s->x1, s->x2);
+        x_max = LV_MAX(s->x1, s->x2);
+    }
+    else {
+        /*Only the part of the middle line in the [y - ext, y + ext] band can affect the row*/
+        int32_t y_top = LV_MAX(LV_MIN(s->y1, s->y2), y - ext);
+        int32_t y_bottom = LV_MIN(LV_MAX(s->y1, s->y2), y + ext);
+        if(y_top > y_bottom) {
+            /*The row is affected only by the caps*/
+            y_top = y < LV_MIN(s->y1, s->y2) ? LV_MIN(s->y1, s->y2) : LV_MAX(s->y1, s->y2);
+            y_bottom = y_top;
+        }
+
+        int32_t dx = s->x2 - s->x1;
+        int32_t xa = s->x1 + (int32_t)((int64_t)(y_top - s->y1) * dx / dy);
+        int32_t xb = s->x1 + (int32_t)((int64_t)(y_bottom - s->y1) * dx / dy);
+        x_min = LV_MIN(xa, xb);
+        x_max = LV_MAX(xa, xb);
+    }
+
+    *xs = (x_min - ext) >> SUBPX_SHIFT;
+    *xe = (x_max + ext + SUBPX - 1) >> SUBPX_SHIFT;
+}
+
+/**
+ * Get how much a pixel is covered by the stroke of a segment
+ * @param s         the segment
+ * @param x         x coordinate of the pixel's center in subpixels
+ * @param y         y coordinate of the pixel's center in subpixels
+ * @param r         half of the line width in subpixels
+ * @return          the coverage
+ */
+static inline lv_opa_t get_coverage(const polyline_seg_t * s, int32_t x, int32_t y, int32_t r)
+{
+    int32_t rx = x - s->x1;
+    int32_t ry = y - s->y1;
+
+    /*Distance along the segment from the start and distance from the middle line*/
+    int32_t along = (int32_t)(((int64_t)rx * s->ux + (int64_t)ry * s->uy) >> DIR_SHIFT);
+    int32_t dist = (int32_t)(((int64_t)rx * s->uy - (int64_t)ry * s->ux) >> DIR_SHIFT);
+    if(dist < 0) dist = -dist;
+
+    int32_t cap = SUBPX;
+    if(along <= 0) {
+        if(s->butt_start) cap = along + SUBPX;
+        else dist = get_dist(rx, ry, r);
+    }
+    else if(along >= s->len) {
+        if(s->butt_end) cap = s->len - along + SUBPX;
+        else dist = get_dist(x - s->x2, y - s->y2, r);
+    }
+
+    int32_t cov = r + SUBPX / 2 - dist;
+    if(cov <= 0 || cap <= 0) return LV_OPA_TRANSP;
+    if(cov > SUBPX) cov = SUBPX;
+    if(cap < SUBPX) cov = cov * cap / SUBPX;
+    return cov >= SUBPX ? LV_OPA_COVER : (lv_opa_t)(cov * (256 / SUBPX));
+}
+
+/**
+ * Get the length of a vector if it's close enough to be inside the stroke
+ * @param dx        x component in subpixels
+ * @param dy        y component in subpixels
+ * @param r         half of the line width in subpixels
+ * @return          the length or a large value if it's surely outside
+ */
+static inline int32_t get_dist(int32_t dx, int32_t dy, int32_t r)
+{
+    int32_t limit = r + SUBPX;
+    if(LV_ABS(dx) > limit || LV_ABS(dy) > limit) return limit;
+    return lv_sqrt32((uint32_t)(dx * dx + dy * dy));
+}
+
 #endif /*LV_USE_DRAW_SW*/
@@ -50,18 +50,21 @@ struct _lv_draw_sw_unit_t {
 #endif
 };
 
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
-typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
-} lv_draw_sw_shadow_cache_t;
-#endif
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Create the cache of the shadow corners. See `LV_DRAW_SW_SHADOW_CACHE_SIZE`.
+ */
+void lv_draw_sw_box_shadow_cache_init(void);
+
+/**
+ * Free the cached shadow corners and delete their cache
+ */
+void lv_draw_sw_box_shadow_cache_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -320,10 +320,14 @@ static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h,
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
+    int32_t xs_step_sum = 0;
+    int32_t ys_step_sum = 0;
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        xs_ups = xs_ups_start + (xs_step_sum >> 8);
+        ys_ups = ys_ups_start + (ys_step_sum >> 8);
+        xs_step_sum += xs_step;
+        ys_step_sum += ys_step;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -420,10 +424,14 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
+    int32_t xs_step_sum = 0;
+    int32_t ys_step_sum = 0;
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        xs_ups = xs_ups_start + (xs_step_sum >> 8);
+        ys_ups = ys_ups_start + (ys_step_sum >> 8);
+        xs_step_sum += xs_step;
+        ys_step_sum += ys_step;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -530,10 +538,14 @@ static void transform_argb8888_premultiplied(const uint8_t * src, int32_t src_w,
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
+    int32_t xs_step_sum = 0;
+    int32_t ys_step_sum = 0;
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        xs_ups = xs_ups_start + (xs_step_sum >> 8);
+        ys_ups = ys_ups_start + (ys_step_sum >> 8);
+        xs_step_sum += xs_step;
+        ys_step_sum += ys_step;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -649,10 +661,14 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
     /*Must be signed type, because we would use negative array index calculated from stride*/
     int32_t alpha_stride = src_stride / 2; /*alpha map stride is always half of RGB map stride*/
 
+    int32_t xs_step_sum = 0;
+    int32_t ys_step_sum = 0;
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        xs_ups = xs_ups_start + (xs_step_sum >> 8);
+        ys_ups = ys_ups_start + (ys_step_sum >> 8);
+        xs_step_sum += xs_step;
+        ys_step_sum += ys_step;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -764,10 +780,14 @@ static void transform_rgb565a8_swapped(const uint8_t * src, int32_t src_w, int32
     /*Must be signed type, because we would use negative array index calculated from stride*/
     int32_t alpha_stride = src_stride / 2; /*alpha map stride is always half of RGB map stride*/
 
+    int32_t xs_step_sum = 0;
+    int32_t ys_step_sum = 0;
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        xs_ups = xs_ups_start + (xs_step_sum >> 8);
+        ys_ups = ys_ups_start + (ys_step_sum >> 8);
+        xs_step_sum += xs_step;
+        ys_step_sum += ys_step;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -875,10 +895,14 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
 
+    int32_t xs_step_sum = 0;
+    int32_t ys_step_sum = 0;
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        xs_ups = xs_ups_start + (xs_step_sum >> 8);
+        ys_ups = ys_ups_start + (ys_step_sum >> 8);
+        xs_step_sum += xs_step;
+        ys_step_sum += ys_step;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -954,10 +978,14 @@ static void transform_l8_to_al88(const uint8_t * src, int32_t src_w, int32_t src
     int32_t ys_ups_start = ys_ups;
     lv_color16a_t * dest_al88 = (lv_color16a_t *)dest_buf;
 
+    int32_t xs_step_sum = 0;
+    int32_t ys_step_sum = 0;
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        xs_ups = xs_ups_start + (xs_step_sum >> 8);
+        ys_ups = ys_ups_start + (ys_step_sum >> 8);
+        xs_step_sum += xs_step;
+        ys_step_sum += ys_step;
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
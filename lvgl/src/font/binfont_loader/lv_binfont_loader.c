@@ -63,7 +63,7 @@ typedef struct cmap_table_bin {
  *  STATIC PROTOTYPES
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
+static bool lvgl_load_font(lv_fs_file_t * fp, const uint8_t * map, lv_font_t * font);
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -104,7 +104,11 @@ lv_font_t * lv_binfont_create(const char * path)
     lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
     LV_ASSERT_MALLOC(font);
 
-    if(!lvgl_load_font(&file, font)) {
+    /*The glyph bitmaps can be used from the mapped file directly if the driver supports it*/
+    uint32_t map_size;
+    const uint8_t * map = lv_fs_mmap(&file, &map_size);
+
+    if(!lvgl_load_font(&file, map, font)) {
         LV_LOG_WARN("Error loading font file: %s", path);
         /*
         * When `lvgl_load_font` fails it can leak some pointers.
@@ -117,6 +121,12 @@ lv_font_t * lv_binfont_create(const char * path)
 
     lv_fs_close(&file);
 
+    /*Keep the mapping only if the glyph bitmaps are used from it*/
+    if(map) {
+        const uint8_t * glyph_bitmap = font ? ((lv_font_fmt_txt_dsc_t *)font->dsc)->glyph_bitmap : NULL;
+        if(glyph_bitmap < map || glyph_bitmap >= map + map_size) lv_fs_munmap(map);
+    }
+
     return font;
 }
 
@@ -164,7 +174,8 @@ void lv_binfont_destroy(lv_font_t * font)
         lv_free((void *)cmaps);
     }
 
-    lv_free((void *)dsc->glyph_bitmap);
+    /*The glyph bitmaps might be used from the mapped font file*/
+    if(lv_fs_munmap(dsc->glyph_bitmap) != LV_FS_RES_OK) lv_free((void *)dsc->glyph_bitmap);
     lv_free((void *)dsc->glyph_dsc);
     lv_free((void *)dsc);
     lv_free(font);
@@ -327,7 +338,7 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
     return success ? cmaps_length : -1;
 }
 
-static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
+static int32_t load_glyph(lv_fs_file_t * fp, const uint8_t * map, lv_font_fmt_txt_dsc_t * font_dsc,
                           uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
 {
     int32_t glyph_length = read_label(fp, start, "glyf");
@@ -406,6 +417,19 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         }
     }
 
+    /*If the glyph headers end on byte boundary, the bitmaps are in the mapped file as they are*/
+    int hdr_bits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+    lv_font_fmt_txt_glyph_dsc_t max_index_dsc;
+    max_index_dsc.bitmap_index = glyph_length;
+    if(map && hdr_bits % 8 == 0 && max_index_dsc.bitmap_index == (uint32_t)glyph_length) {
+        for(unsigned int i = 1; i < loca_count; ++i) {
+            glyph_dsc[i].bitmap_index = glyph_offset[i] + hdr_bits / 8;
+        }
+
+        font_dsc->glyph_bitmap = map + start;
+        return glyph_length;
+    }
+
     uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
     LV_ASSERT_MALLOC(glyph_bmp);
 
@@ -480,7 +504,7 @@ static void release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * glyph
  * `lv_binfont_destroy` will assume that all non-null pointers are allocated and
  * should be freed.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, const uint8_t * map, lv_font_t * font)
 {
     lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
                                        lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
@@ -563,7 +587,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+                               fp, map, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
 
     lv_free(glyph_offset);
 
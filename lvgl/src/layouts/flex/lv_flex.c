@@ -9,6 +9,7 @@
 #include "lv_flex.h"
 #include "../lv_layout.h"
 #include "../../core/lv_obj_private.h"
+#include "../../stdlib/lv_string.h"
 
 #if LV_USE_FLEX
 
@@ -17,6 +18,10 @@
  *      DEFINES
  *********************/
 #define layout_list_def LV_GLOBAL_DEFAULT()->layout_list
+#define layout_stats LV_GLOBAL_DEFAULT()->layout_stats
+
+#define ITEM_SKIP_FLAGS (LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)
+#define ITEM_FLAGS      (ITEM_SKIP_FLAGS | LV_OBJ_FLAG_FLEX_IN_NEW_TRACK)
 
 /**********************
  *      TYPEDEFS
@@ -30,6 +35,20 @@ typedef struct {
     uint8_t rev : 1;
 } flex_t;
 
+/** The measured size of a child*/
+typedef struct {
+    lv_obj_t * obj;
+    lv_obj_flag_t flags;    /*The `ITEM_FLAGS` of the child*/
+    int32_t main_size;      /*Size along the main axis with the margins*/
+    int32_t cross_size;     /*Size along the cross axis with the margins*/
+    int32_t main_margin;    /*Sum of the margins along the main axis*/
+    int32_t cross_margin;   /*Sum of the margins along the cross axis*/
+    int32_t min_size;       /*Min. main size of grow items*/
+    int32_t max_size;       /*Max. main size of grow items*/
+    uint8_t grow_value;
+    uint8_t changed : 1;    /*The size has changed since the last layout update*/
+} flex_item_t;
+
 typedef struct {
     lv_obj_t * item;
     int32_t min_size;
@@ -49,6 +68,31 @@ typedef struct {
     uint32_t grow_dsc_calc : 1;
 } track_t;
 
+#if LV_LAYOUT_INCREMENTAL
+/** Where a track was placed in the last layout update*/
+typedef struct {
+    int32_t first_item;
+    int32_t next_first_item;
+    int32_t cross_ofs;      /*Offset of the track from the start of the content area*/
+    int32_t cross_size;
+} flex_track_cache_t;
+
+/** The saved result of the last layout update of a container*/
+typedef struct {
+    flex_t f;
+    lv_flex_align_t track_cross_place;
+    int32_t track_gap;
+    int32_t item_gap;
+    int32_t max_main_size;
+    int32_t max_cross_size;
+    uint32_t item_cnt;
+    uint32_t track_cnt;
+    bool rtl;
+    flex_item_t * items;            /*`item_cnt` elements, stored after this struct*/
+    flex_track_cache_t * tracks;    /*`track_cnt` elements, stored after `items`*/
+} flex_cache_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -57,15 +101,23 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void flex_update(lv_obj_t * cont, void * user_data);
-static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id, int32_t max_main_size,
-                              int32_t item_gap, track_t * t);
+static void item_measure(lv_obj_t * item, const flex_t * f, flex_item_t * dsc);
+static int32_t find_track_end(lv_obj_t * cont, flex_t * f, flex_item_t * items, int32_t item_start_id,
+                              int32_t max_main_size, int32_t item_gap, track_t * t);
 static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, int32_t item_last_id, int32_t abs_x,
                            int32_t abs_y, int32_t max_main_size, int32_t item_gap, track_t * t);
 static void place_content(lv_flex_align_t place, int32_t max_size, int32_t content_size, int32_t item_cnt,
                           int32_t * start_pos, int32_t * gap);
 static lv_obj_t * get_next_item(lv_obj_t * cont, bool rev, int32_t * item_id);
-static int32_t lv_obj_get_width_with_margin(const lv_obj_t * obj);
-static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj);
+#if LV_LAYOUT_INCREMENTAL
+    static flex_cache_t * cache_get(lv_obj_t * cont, const flex_t * f, lv_flex_align_t track_cross_place,
+                                    int32_t track_gap, int32_t item_gap, int32_t max_main_size, int32_t max_cross_size, bool rtl,
+                                    int32_t * changed_cnt);
+    static flex_cache_t * cache_create(lv_obj_t * cont, const flex_t * f, lv_flex_align_t track_cross_place,
+                                       int32_t track_gap, int32_t item_gap, int32_t max_main_size, int32_t max_cross_size, bool rtl);
+    static bool track_is_changed(const flex_item_t * items, bool rev, int32_t item_first_id, int32_t item_last_id);
+    static void items_update_size(lv_obj_t * cont, const flex_t * f, flex_item_t * items);
+#endif
 
 static inline int32_t div_round_closest(int32_t dividend, int32_t divisor)
 {
@@ -133,6 +185,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
 {
     LV_LOG_INFO("update %p container", (void *)cont);
     LV_UNUSED(user_data);
+    LV_PROFILER_LAYOUT_BEGIN;
 
     flex_t f;
     lv_flex_flow_t flow = lv_obj_get_style_flex_flow(cont, LV_PART_MAIN);
@@ -156,10 +209,16 @@ static void flex_update(lv_obj_t * cont, void * user_data)
 
     lv_flex_align_t track_cross_place = f.track_place;
     int32_t * cross_pos = (f.row ? &abs_y : &abs_x);
+    int32_t cross_start = *cross_pos;
 
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
 
+    /*Can't wrap if the size is auto (i.e. the size depends on the children)*/
+    if(f.wrap && ((f.row && w_set == LV_SIZE_CONTENT) || (!f.row && h_set == LV_SIZE_CONTENT))) {
+        f.wrap = false;
+    }
+
     /*Content sized objects should squeeze the gap between the children, therefore any alignment will look like `START`*/
     if((f.row && h_set == LV_SIZE_CONTENT && cont->h_layout == 0) ||
        (!f.row && w_set == LV_SIZE_CONTENT && cont->w_layout == 0)) {
@@ -171,6 +230,34 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         else if(track_cross_place == LV_FLEX_ALIGN_END) track_cross_place = LV_FLEX_ALIGN_START;
     }
 
+    int32_t max_cross_size = (f.row ? lv_obj_get_content_height(cont) : lv_obj_get_content_width(cont));
+
+    /*Measure the children or reuse their sizes measured in the last update*/
+    flex_item_t * items = NULL;
+#if LV_LAYOUT_INCREMENTAL
+    int32_t changed_cnt = -1;
+    flex_cache_t * cache = cache_get(cont, &f, track_cross_place, track_gap, item_gap, max_main_size, max_cross_size,
+                                     rtl, &changed_cnt);
+    if(changed_cnt == 0) {
+        /*The children are already placed*/
+        layout_stats.skip_cnt++;
+        LV_PROFILER_LAYOUT_END;
+        return;
+    }
+
+    bool incremental = cache != NULL;
+    if(incremental) {
+        layout_stats.incremental_cnt++;
+    }
+    else {
+        layout_stats.full_cnt++;
+        cache = cache_create(cont, &f, track_cross_place, track_gap, item_gap, max_main_size, max_cross_size, rtl);
+    }
+
+    if(cache) items = cache->items;
+    uint32_t track_id = 0;
+#endif
+
     int32_t total_track_cross_size = 0;
     int32_t gap = 0;
     uint32_t track_cnt = 0;
@@ -183,7 +270,7 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
             /*Search the first item of the next row*/
             t.grow_dsc_calc = 0;
-            next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
+            next_track_first_item = find_track_end(cont, &f, items, track_first_item, max_main_size, item_gap, &t);
             total_track_cross_size += t.track_cross_size + track_gap;
             track_cnt++;
             track_first_item = next_track_first_item;
@@ -192,7 +279,6 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         if(track_cnt) total_track_cross_size -= track_gap;   /*No gap after the last track*/
 
         /*Place the tracks to get the start position*/
-        int32_t max_cross_size = (f.row ? lv_obj_get_content_height(cont) : lv_obj_get_content_width(cont));
         place_content(track_cross_place, max_cross_size, total_track_cross_size, track_cnt, cross_pos, &gap);
     }
 
@@ -206,12 +292,39 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         track_t t;
         t.grow_dsc_calc = 1;
         /*Search the first item of the next row*/
-        next_track_first_item = find_track_end(cont, &f, track_first_item, max_main_size, item_gap, &t);
+        next_track_first_item = find_track_end(cont, &f, items, track_first_item, max_main_size, item_gap, &t);
 
         if(rtl && !f.row) {
             *cross_pos -= t.track_cross_size;
         }
-        children_repos(cont, &f, track_first_item, next_track_first_item, abs_x, abs_y, max_main_size, item_gap, &t);
+
+        bool repos = true;
+#if LV_LAYOUT_INCREMENTAL
+        if(cache) {
+            /*Keep the track as it is if it's at the same place and none of its children has changed*/
+            flex_track_cache_t * track = &cache->tracks[track_id];
+            int32_t cross_ofs = *cross_pos - cross_start;
+            if(incremental && track_id < cache->track_cnt &&
+               track->first_item == track_first_item && track->next_first_item == next_track_first_item &&
+               track->cross_ofs == cross_ofs && track->cross_size == t.track_cross_size &&
+               !track_is_changed(items, f.rev, track_first_item, next_track_first_item)) {
+                repos = false;
+            }
+
+            track->first_item = track_first_item;
+            track->next_first_item = next_track_first_item;
+            track->cross_ofs = cross_ofs;
+            track->cross_size = t.track_cross_size;
+            track_id++;
+        }
+
+        if(repos) layout_stats.track_update_cnt++;
+        else layout_stats.track_reuse_cnt++;
+#endif
+
+        if(repos) {
+            children_repos(cont, &f, track_first_item, next_track_first_item, abs_x, abs_y, max_main_size, item_gap, &t);
+        }
         track_first_item = next_track_first_item;
         lv_free(t.grow_dsc);
         t.grow_dsc = NULL;
@@ -224,6 +337,15 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     }
     LV_ASSERT_MEM_INTEGRITY();
 
+#if LV_LAYOUT_INCREMENTAL
+    if(cache) {
+        cache->track_cnt = track_id;
+        /*The grow items might have been resized*/
+        items_update_size(cont, &f, items);
+    }
+#endif
+
+    /*`lv_obj_refr_size` doesn't notify the parent if the size of the container remains the same*/
     if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
         lv_obj_refr_size(cont);
     }
@@ -231,25 +353,45 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     lv_obj_send_event(cont, LV_EVENT_LAYOUT_CHANGED, NULL);
 
     LV_TRACE_LAYOUT("finished");
+    LV_PROFILER_LAYOUT_END;
 }
 
 /**
- * Find the last item of a track
+ * Measure a child of the container
  */
-static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id, int32_t max_main_size,
-                              int32_t item_gap, track_t * t)
+static void item_measure(lv_obj_t * item, const flex_t * f, flex_item_t * dsc)
 {
-    int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
-    int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
-
-    /*Can't wrap if the size is auto (i.e. the size depends on the children)*/
-    if(f->wrap && ((f->row && w_set == LV_SIZE_CONTENT) || (!f->row && h_set == LV_SIZE_CONTENT))) {
-        f->wrap = false;
+    lv_memzero(dsc, sizeof(flex_item_t));
+    dsc->obj = item;
+    dsc->flags = item->flags & ITEM_FLAGS;
+    if(dsc->flags & ITEM_SKIP_FLAGS) return;
+
+    int32_t margin_hor = lv_obj_get_style_margin_left(item, LV_PART_MAIN) +
+                         lv_obj_get_style_margin_right(item, LV_PART_MAIN);
+    int32_t margin_ver = lv_obj_get_style_margin_top(item, LV_PART_MAIN) +
+                         lv_obj_get_style_margin_bottom(item, LV_PART_MAIN);
+
+    dsc->main_margin = f->row ? margin_hor : margin_ver;
+    dsc->cross_margin = f->row ? margin_ver : margin_hor;
+    dsc->main_size = dsc->main_margin + (f->row ? lv_obj_get_width(item) : lv_obj_get_height(item));
+    dsc->cross_size = dsc->cross_margin + (f->row ? lv_obj_get_height(item) : lv_obj_get_width(item));
+
+    dsc->grow_value = lv_obj_get_style_flex_grow(item, LV_PART_MAIN);
+    if(dsc->grow_value) {
+        dsc->min_size = f->row ? lv_obj_calc_dynamic_width(item, LV_STYLE_MIN_WIDTH, NULL)
+                        : lv_obj_calc_dynamic_height(item, LV_STYLE_MIN_HEIGHT, NULL);
+        dsc->max_size = f->row ? lv_obj_calc_dynamic_width(item, LV_STYLE_MAX_WIDTH, NULL)
+                        : lv_obj_calc_dynamic_height(item, LV_STYLE_MAX_HEIGHT, NULL);
     }
-    int32_t(*get_main_size)(const lv_obj_t *) = (f->row ? lv_obj_get_width_with_margin : lv_obj_get_height_with_margin);
-    int32_t(*get_cross_size)(const lv_obj_t *) = (!f->row ? lv_obj_get_width_with_margin :
-                                                  lv_obj_get_height_with_margin);
+}
 
+/**
+ * Find the last item of a track
+ * @param items     the measured children or NULL to measure them now
+ */
+static int32_t find_track_end(lv_obj_t * cont, flex_t * f, flex_item_t * items, int32_t item_start_id,
+                              int32_t max_main_size, int32_t item_gap, track_t * t)
+{
     t->track_main_size = 0;
     t->track_fix_main_size = 0;
     t->grow_item_cnt = 0;
@@ -257,19 +399,26 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
     t->item_cnt = 0;
     t->grow_dsc = NULL;
 
+    int32_t child_cnt = (int32_t)cont->spec_attr->child_cnt;
     int32_t item_id = item_start_id;
     int32_t grow_min_size_sum = 0;
-    lv_obj_t * item = lv_obj_get_child(cont, item_id);
     bool first_item = true;
-    while(item) {
-        if(item_id != item_start_id && lv_obj_has_flag(item, LV_OBJ_FLAG_FLEX_IN_NEW_TRACK)) break;
-
-        if(!lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) {
-            uint8_t grow_value = lv_obj_get_style_flex_grow(item, LV_PART_MAIN);
-            if(grow_value) {
-                int32_t min_size = f->row ? lv_obj_calc_dynamic_width(item, LV_STYLE_MIN_WIDTH, NULL)
-                                   : lv_obj_calc_dynamic_height(item, LV_STYLE_MIN_HEIGHT, NULL);
-                int32_t req_size = min_size;
+    flex_item_t item_tmp;
+    const flex_item_t * item = NULL;
+    while(item_id >= 0 && item_id < child_cnt) {
+        if(items) {
+            item = &items[item_id];
+        }
+        else {
+            item_measure(cont->spec_attr->children[item_id], f, &item_tmp);
+            item = &item_tmp;
+        }
+
+        if(item_id != item_start_id && (item->flags & LV_OBJ_FLAG_FLEX_IN_NEW_TRACK)) break;
+
+        if(!(item->flags & ITEM_SKIP_FLAGS)) {
+            if(item->grow_value) {
+                int32_t req_size = item->min_size;
                 if(item_id != item_start_id)
                     req_size += item_gap; /*No gap before the first item*/
 
@@ -290,34 +439,28 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
                     if(new_dsc == NULL)
                         return item_id;
 
-                    int32_t max_size = f->row ? lv_obj_calc_dynamic_width(item, LV_STYLE_MAX_WIDTH, NULL)
-                                       : lv_obj_calc_dynamic_height(item, LV_STYLE_MAX_HEIGHT, NULL);
-
-                    new_dsc[t->grow_item_cnt - 1].item = item;
-                    new_dsc[t->grow_item_cnt - 1].min_size = min_size;
-                    new_dsc[t->grow_item_cnt - 1].max_size = max_size;
-                    new_dsc[t->grow_item_cnt - 1].grow_value = grow_value;
+                    new_dsc[t->grow_item_cnt - 1].item = item->obj;
+                    new_dsc[t->grow_item_cnt - 1].min_size = item->min_size;
+                    new_dsc[t->grow_item_cnt - 1].max_size = item->max_size;
+                    new_dsc[t->grow_item_cnt - 1].grow_value = item->grow_value;
                     new_dsc[t->grow_item_cnt - 1].clamped = 0;
 
                     t->grow_dsc = new_dsc;
                 }
             }
             else {
-                int32_t item_size = get_main_size(item);
-                int32_t req_size = item_size;
+                int32_t req_size = item->main_size;
                 if(!first_item) req_size += item_gap; /*No gap before the first item*/
                 if(f->wrap && t->track_fix_main_size + grow_min_size_sum + req_size > max_main_size) break;
                 t->track_fix_main_size += req_size;
             }
 
             first_item = false;
-            t->track_cross_size = LV_MAX(get_cross_size(item), t->track_cross_size);
+            t->track_cross_size = LV_MAX(item->cross_size, t->track_cross_size);
             t->item_cnt++;
         }
 
         item_id += f->rev ? -1 : +1;
-        if(item_id < 0) break;
-        item = lv_obj_get_child(cont, item_id);
     }
 
     /*If there is at least one "grow item" the track takes the full space*/
@@ -325,13 +468,10 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
 
     /*Have at least one item in a row*/
     if(item && item_id == item_start_id) {
-        item = cont->spec_attr->children[item_id];
-        get_next_item(cont, f->rev, &item_id);
-        if(item) {
-            t->track_cross_size = get_cross_size(item);
-            t->track_main_size = get_main_size(item);
-            t->item_cnt = 1;
-        }
+        item_id += f->rev ? -1 : +1;
+        t->track_cross_size = item->cross_size;
+        t->track_main_size = item->main_size;
+        t->item_cnt = 1;
     }
 
     return item_id;
@@ -551,18 +691,131 @@ static lv_obj_t * get_next_item(lv_obj_t * cont, bool rev, int32_t * item_id)
     }
 }
 
-static int32_t lv_obj_get_width_with_margin(const lv_obj_t * obj)
+#if LV_LAYOUT_INCREMENTAL
+
+/**
+ * Get the saved result of the last update if the container's settings and children are the same.
+ * The saved sizes of the children are updated.
+ * @param changed_cnt   store the number of children whose size has changed here
+ * @return              the saved data or NULL if everything needs to be recalculated
+ */
+static flex_cache_t * cache_get(lv_obj_t * cont, const flex_t * f, lv_flex_align_t track_cross_place,
+                                int32_t track_gap, int32_t item_gap, int32_t max_main_size, int32_t max_cross_size, bool rtl,
+                                int32_t * changed_cnt)
 {
-    return lv_obj_get_style_margin_left(obj, LV_PART_MAIN)
-           + lv_obj_get_width(obj)
-           + lv_obj_get_style_margin_right(obj, LV_PART_MAIN);
+    *changed_cnt = -1;
+
+    flex_cache_t * cache = lv_layout_cache_get(cont, LV_LAYOUT_FLEX);
+    if(cache == NULL) return NULL;
+
+    if(cache->f.row != f->row || cache->f.wrap != f->wrap || cache->f.rev != f->rev ||
+       cache->f.main_place != f->main_place || cache->f.cross_place != f->cross_place ||
+       cache->f.track_place != f->track_place || cache->track_cross_place != track_cross_place ||
+       cache->track_gap != track_gap || cache->item_gap != item_gap || cache->rtl != rtl ||
+       cache->max_main_size != max_main_size || cache->max_cross_size != max_cross_size ||
+       cache->item_cnt != cont->spec_attr->child_cnt) {
+        return NULL;
+    }
+
+    /*The styles haven't changed, so only the sizes of the same children need to be checked*/
+    int32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < cache->item_cnt; i++) {
+        lv_obj_t * obj = cont->spec_attr->children[i];
+        flex_item_t * item = &cache->items[i];
+        if(item->obj != obj || item->flags != (obj->flags & ITEM_FLAGS)) return NULL;
+        if(item->flags & ITEM_SKIP_FLAGS) continue;
+
+        int32_t main_size = item->main_margin + (f->row ? lv_obj_get_width(obj) : lv_obj_get_height(obj));
+        int32_t cross_size = item->cross_margin + (f->row ? lv_obj_get_height(obj) : lv_obj_get_width(obj));
+        int32_t min_size = item->min_size;
+        int32_t max_size = item->max_size;
+        if(item->grow_value) {
+            /*They might depend on the size of the children*/
+            min_size = f->row ? lv_obj_calc_dynamic_width(obj, LV_STYLE_MIN_WIDTH, NULL)
+                       : lv_obj_calc_dynamic_height(obj, LV_STYLE_MIN_HEIGHT, NULL);
+            max_size = f->row ? lv_obj_calc_dynamic_width(obj, LV_STYLE_MAX_WIDTH, NULL)
+                       : lv_obj_calc_dynamic_height(obj, LV_STYLE_MAX_HEIGHT, NULL);
+        }
+
+        if(main_size != item->main_size || cross_size != item->cross_size ||
+           min_size != item->min_size || max_size != item->max_size) {
+            item->main_size = main_size;
+            item->cross_size = cross_size;
+            item->min_size = min_size;
+            item->max_size = max_size;
+            item->changed = 1;
+            cnt++;
+        }
+    }
+
+    *changed_cnt = cnt;
+    return cache;
 }
 
-static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj)
+/**
+ * Allocate new data to save the result of the update and measure all the children
+ * @return      the new data or NULL on error
+ */
+static flex_cache_t * cache_create(lv_obj_t * cont, const flex_t * f, lv_flex_align_t track_cross_place,
+                                   int32_t track_gap, int32_t item_gap, int32_t max_main_size, int32_t max_cross_size, bool rtl)
+{
+    /*There can't be more tracks than children*/
+    uint32_t child_cnt = cont->spec_attr->child_cnt;
+    size_t size = sizeof(flex_cache_t) + child_cnt * (sizeof(flex_item_t) + sizeof(flex_track_cache_t));
+    flex_cache_t * cache = lv_layout_cache_alloc(cont, LV_LAYOUT_FLEX, size);
+    if(cache == NULL) return NULL;
+
+    cache->f = *f;
+    cache->track_cross_place = track_cross_place;
+    cache->track_gap = track_gap;
+    cache->item_gap = item_gap;
+    cache->max_main_size = max_main_size;
+    cache->max_cross_size = max_cross_size;
+    cache->rtl = rtl;
+    cache->item_cnt = child_cnt;
+    cache->track_cnt = 0;
+    cache->items = (flex_item_t *)(cache + 1);
+    cache->tracks = (flex_track_cache_t *)(cache->items + child_cnt);
+
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        item_measure(cont->spec_attr->children[i], f, &cache->items[i]);
+    }
+
+    return cache;
+}
+
+/**
+ * Tell if the size of any child has changed in a track
+ */
+static bool track_is_changed(const flex_item_t * items, bool rev, int32_t item_first_id, int32_t item_last_id)
 {
-    return lv_obj_get_style_margin_top(obj, LV_PART_MAIN)
-           + lv_obj_get_height(obj)
-           + lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
+    int32_t i;
+    for(i = item_first_id; i != item_last_id; i += rev ? -1 : +1) {
+        if(items[i].changed) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Save the final size of the children
+ */
+static void items_update_size(lv_obj_t * cont, const flex_t * f, flex_item_t * items)
+{
+    uint32_t i;
+    for(i = 0; i < cont->spec_attr->child_cnt; i++) {
+        flex_item_t * item = &items[i];
+        lv_obj_t * obj = item->obj;
+        item->changed = 0;
+        if(item->flags & ITEM_SKIP_FLAGS) continue;
+
+        item->main_size = item->main_margin + (f->row ? lv_obj_get_width(obj) : lv_obj_get_height(obj));
+        item->cross_size = item->cross_margin + (f->row ? lv_obj_get_height(obj) : lv_obj_get_width(obj));
+    }
 }
 
+#endif /*LV_LAYOUT_INCREMENTAL*/
+
 #endif /*LV_USE_FLEX*/
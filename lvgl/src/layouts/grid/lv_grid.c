@@ -18,6 +18,9 @@
  *      DEFINES
  *********************/
 #define layout_list_def LV_GLOBAL_DEFAULT()->layout_list
+#define layout_stats LV_GLOBAL_DEFAULT()->layout_stats
+
+#define ITEM_SKIP_FLAGS (LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)
 
 /**
  * Some helper defines
@@ -46,6 +49,32 @@ typedef struct {
     int32_t grid_h;
 } lv_grid_calc_t;
 
+/** The cell and the measured size of a child*/
+typedef struct {
+    lv_obj_t * obj;
+    lv_obj_flag_t flags;    /*The `ITEM_SKIP_FLAGS` of the child*/
+    uint32_t col_pos;
+    uint32_t col_span;
+    uint32_t row_pos;
+    uint32_t row_span;
+    int32_t w;
+    int32_t h;
+    uint8_t changed : 1;    /*The size has changed since the last layout update*/
+} grid_item_t;
+
+#if LV_LAYOUT_INCREMENTAL
+/** The saved result of the last layout update of a container*/
+typedef struct {
+    lv_grid_calc_t calc;    /*The arrays are stored after `items`*/
+    int32_t cont_w;
+    int32_t cont_h;
+    uint32_t item_cnt;
+    uint8_t w_layout : 1;
+    uint8_t h_layout : 1;
+    grid_item_t * items;    /*`item_cnt` elements, stored after this struct*/
+} grid_cache_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -54,15 +83,21 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void grid_update(lv_obj_t * cont, void * user_data);
-static lv_result_t calc(lv_obj_t * obj, lv_grid_calc_t * calc);
+static lv_result_t calc(lv_obj_t * obj, lv_grid_calc_t * calc, const grid_item_t * items);
 static void calc_free(lv_grid_calc_t * calc);
-static lv_result_t calc_cols(lv_obj_t * cont, lv_grid_calc_t * c);
-static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c);
+static lv_result_t calc_cols(lv_obj_t * cont, lv_grid_calc_t * c, const grid_item_t * items);
+static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c, const grid_item_t * items);
+static int32_t calc_content_track_size(lv_obj_t * cont, const grid_item_t * items, uint32_t track, bool col);
 static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint);
 static int32_t grid_align(int32_t cont_size, bool auto_size, lv_grid_align_t align, int32_t gap,
                           uint32_t track_num,
                           int32_t * size_array, int32_t * pos_array, bool reverse);
 static uint32_t count_tracks(const int32_t * templ);
+#if LV_LAYOUT_INCREMENTAL
+    static bool grid_update_incremental(lv_obj_t * cont, item_repos_hint_t * hint);
+    static void cache_create(lv_obj_t * cont, const lv_grid_calc_t * c);
+    static void item_measure(lv_obj_t * item, grid_item_t * dsc);
+#endif
 
 static inline const int32_t * get_col_dsc(lv_obj_t * obj)
 {
@@ -188,10 +223,7 @@ static void grid_update(lv_obj_t * cont, void * user_data)
 {
     LV_LOG_INFO("update %p container", (void *)cont);
     LV_UNUSED(user_data);
-
-    lv_grid_calc_t c;
-    lv_result_t res = calc(cont, &c);
-    if(res != LV_RESULT_OK) return;
+    LV_PROFILER_LAYOUT_BEGIN;
 
     item_repos_hint_t hint;
     lv_memzero(&hint, sizeof(hint));
@@ -203,11 +235,32 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
     hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
 
+#if LV_LAYOUT_INCREMENTAL
+    /*Reposition only the changed children if possible*/
+    if(grid_update_incremental(cont, &hint)) {
+        LV_PROFILER_LAYOUT_END;
+        return;
+    }
+    layout_stats.full_cnt++;
+#endif
+
+    lv_grid_calc_t c;
+    lv_result_t res = calc(cont, &c, NULL);
+    if(res != LV_RESULT_OK) {
+        LV_PROFILER_LAYOUT_END;
+        return;
+    }
+
     uint32_t i;
     for(i = 0; i < cont->spec_attr->child_cnt; i++) {
         lv_obj_t * item = cont->spec_attr->children[i];
         item_repos(item, &c, &hint);
     }
+
+#if LV_LAYOUT_INCREMENTAL
+    layout_stats.track_update_cnt += c.col_num + c.row_num;
+    cache_create(cont, &c);
+#endif
     calc_free(&c);
 
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
@@ -219,26 +272,28 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     lv_obj_send_event(cont, LV_EVENT_LAYOUT_CHANGED, NULL);
 
     LV_TRACE_LAYOUT("finished");
+    LV_PROFILER_LAYOUT_END;
 }
 
 /**
  * Calculate the grid cells coordinates
  * @param cont an object that has a grid
  * @param calc store the calculated cells sizes here
+ * @param items the cells and sizes of the children or NULL to get them from the children
  * @note `lv_grid_calc_free(calc_out)` needs to be called when `calc_out` is not needed anymore
  */
-static lv_result_t calc(lv_obj_t * cont, lv_grid_calc_t * calc_out)
+static lv_result_t calc(lv_obj_t * cont, lv_grid_calc_t * calc_out, const grid_item_t * items)
 {
     if(lv_obj_get_child(cont, 0) == NULL) {
         lv_memzero(calc_out, sizeof(lv_grid_calc_t));
         return LV_RESULT_INVALID;
     }
 
-    if(calc_rows(cont, calc_out) == LV_RESULT_INVALID) {
+    if(calc_rows(cont, calc_out, items) == LV_RESULT_INVALID) {
         /* Warning is already logged inside `calc_rows` */
         return LV_RESULT_INVALID;
     }
-    if(calc_cols(cont, calc_out) == LV_RESULT_INVALID) {
+    if(calc_cols(cont, calc_out, items) == LV_RESULT_INVALID) {
         /* Warning is already logged inside `calc_cols` */
         return LV_RESULT_INVALID;
     }
@@ -276,7 +331,7 @@ static void calc_free(lv_grid_calc_t * calc)
     lv_free(calc->h);
 }
 
-static lv_result_t calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
+static lv_result_t calc_cols(lv_obj_t * cont, lv_grid_calc_t * c, const grid_item_t * items)
 {
 
     const int32_t * col_templ;
@@ -309,23 +364,8 @@ static lv_result_t calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
     /*Set sizes for CONTENT cells*/
     uint32_t i;
     for(i = 0; i < c->col_num; i++) {
-        int32_t size = LV_COORD_MIN;
         if(IS_CONTENT(col_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t col_span = get_col_span(item);
-                if(col_span != 1) continue;
-
-                uint32_t col_pos = get_col_pos(item);
-                if(col_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_width(item));
-            }
-            if(size >= 0) c->w[i] = size;
-            else c->w[i] = 0;
+            c->w[i] = calc_content_track_size(cont, items, i, true);
         }
     }
 
@@ -370,7 +410,7 @@ static lv_result_t calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
     return LV_RESULT_OK;
 }
 
-static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
+static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c, const grid_item_t * items)
 {
     const int32_t * row_templ;
     row_templ = get_row_dsc(cont);
@@ -399,23 +439,8 @@ static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
     /*Set sizes for CONTENT cells*/
     uint32_t i;
     for(i = 0; i < c->row_num; i++) {
-        int32_t size = LV_COORD_MIN;
         if(IS_CONTENT(row_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t row_span = get_row_span(item);
-                if(row_span != 1) continue;
-
-                uint32_t row_pos = get_row_pos(item);
-                if(row_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_height(item));
-            }
-            if(size >= 0) c->h[i] = size;
-            else c->h[i] = 0;
+            c->h[i] = calc_content_track_size(cont, items, i, false);
         }
     }
 
@@ -460,6 +485,45 @@ static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
     return LV_RESULT_OK;
 }
 
+/**
+ * Get the size of a `LV_GRID_CONTENT` track
+ * @param cont  pointer to a grid container
+ * @param items the cells and sizes of the children or NULL to get them from the children
+ * @param track index of the column or row
+ * @param col   true: `track` is a column; false: `track` is a row
+ * @return      the size of the largest child in the track
+ */
+static int32_t calc_content_track_size(lv_obj_t * cont, const grid_item_t * items, uint32_t track, bool col)
+{
+    int32_t size = LV_COORD_MIN;
+
+    /*Check the size of children of this cell*/
+    uint32_t ci;
+    for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
+        if(items) {
+            const grid_item_t * item = &items[ci];
+            if(item->flags) continue;
+            if((col ? item->col_span : item->row_span) != 1) continue;
+            if((col ? item->col_pos : item->row_pos) != track) continue;
+
+            size = LV_MAX(size, col ? item->w : item->h);
+        }
+        else {
+            lv_obj_t * item = lv_obj_get_child(cont, ci);
+            if(lv_obj_has_flag_any(item, ITEM_SKIP_FLAGS)) continue;
+            uint32_t span = col ? get_col_span(item) : get_row_span(item);
+            if(span != 1) continue;
+
+            uint32_t pos = col ? get_col_pos(item) : get_row_pos(item);
+            if(pos != track) continue;
+
+            size = LV_MAX(size, col ? lv_obj_get_width(item) : lv_obj_get_height(item));
+        }
+    }
+
+    return size >= 0 ? size : 0;
+}
+
 /**
  * Reposition a grid item in its cell
  * @param item a grid item to reposition
@@ -469,7 +533,7 @@ static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
  */
 static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint)
 {
-    if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) return;
+    if(lv_obj_has_flag_any(item, ITEM_SKIP_FLAGS)) return;
     uint32_t col_span = get_col_span(item);
     uint32_t row_span = get_row_span(item);
     if(row_span == 0 || col_span == 0) return;
@@ -683,4 +747,179 @@ static uint32_t count_tracks(const int32_t * templ)
     return i;
 }
 
+#if LV_LAYOUT_INCREMENTAL
+
+/**
+ * Reposition only the children whose size or cell has changed since the last update
+ * @param cont  pointer to a grid container
+ * @param hint  the absolute position of the grid
+ * @return      true: the layout is updated; false: everything needs to be recalculated
+ */
+static bool grid_update_incremental(lv_obj_t * cont, item_repos_hint_t * hint)
+{
+    grid_cache_t * cache = lv_layout_cache_get(cont, LV_LAYOUT_GRID);
+    if(cache == NULL) return false;
+
+    if(cache->item_cnt != cont->spec_attr->child_cnt ||
+       cache->cont_w != lv_obj_get_content_width(cont) || cache->cont_h != lv_obj_get_content_height(cont) ||
+       cache->w_layout != cont->w_layout || cache->h_layout != cont->h_layout) {
+        return false;
+    }
+
+    /*The styles haven't changed, so only the sizes of the same children need to be checked*/
+    uint32_t changed_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < cache->item_cnt; i++) {
+        lv_obj_t * obj = cont->spec_attr->children[i];
+        grid_item_t * item = &cache->items[i];
+        if(item->obj != obj || item->flags != (obj->flags & ITEM_SKIP_FLAGS)) return false;
+        if(item->flags) continue;
+
+        int32_t w = lv_obj_get_width(obj);
+        int32_t h = lv_obj_get_height(obj);
+        if(w != item->w || h != item->h) {
+            item->w = w;
+            item->h = h;
+            item->changed = 1;
+            changed_cnt++;
+        }
+    }
+
+    if(changed_cnt == 0) {
+        /*The children are already placed*/
+        layout_stats.skip_cnt++;
+        return true;
+    }
+
+    lv_grid_calc_t c;
+    if(calc(cont, &c, cache->items) != LV_RESULT_OK) return false;
+    if(c.col_num != cache->calc.col_num || c.row_num != cache->calc.row_num) {
+        calc_free(&c);
+        return false;
+    }
+
+    layout_stats.incremental_cnt++;
+
+    /*Find the tracks whose position or size has changed*/
+    lv_grid_calc_t * old_c = &cache->calc;
+    uint8_t * track_changed = lv_malloc_zeroed(c.col_num + c.row_num);
+    LV_ASSERT_MALLOC(track_changed);
+    if(track_changed == NULL) {
+        calc_free(&c);
+        return false;
+    }
+    uint8_t * col_changed = track_changed;
+    uint8_t * row_changed = track_changed + c.col_num;
+
+    for(i = 0; i < c.col_num; i++) {
+        col_changed[i] = c.x[i] != old_c->x[i] || c.w[i] != old_c->w[i];
+        if(col_changed[i]) layout_stats.track_update_cnt++;
+        else layout_stats.track_reuse_cnt++;
+    }
+    for(i = 0; i < c.row_num; i++) {
+        row_changed[i] = c.y[i] != old_c->y[i] || c.h[i] != old_c->h[i];
+        if(row_changed[i]) layout_stats.track_update_cnt++;
+        else layout_stats.track_reuse_cnt++;
+    }
+
+    for(i = 0; i < cache->item_cnt; i++) {
+        grid_item_t * item = &cache->items[i];
+        if(item->flags) continue;
+
+        bool repos = item->changed;
+        uint32_t t;
+        for(t = item->col_pos; !repos && t < item->col_pos + item->col_span && t < c.col_num; t++) {
+            if(col_changed[t]) repos = true;
+        }
+        for(t = item->row_pos; !repos && t < item->row_pos + item->row_span && t < c.row_num; t++) {
+            if(row_changed[t]) repos = true;
+        }
+
+        if(repos) {
+            item_repos(item->obj, &c, hint);
+            /*Stretched items might have been resized*/
+            item->w = lv_obj_get_width(item->obj);
+            item->h = lv_obj_get_height(item->obj);
+        }
+        item->changed = 0;
+    }
+
+    lv_free(track_changed);
+
+    lv_memcpy(old_c->x, c.x, c.col_num * sizeof(int32_t));
+    lv_memcpy(old_c->w, c.w, c.col_num * sizeof(int32_t));
+    lv_memcpy(old_c->y, c.y, c.row_num * sizeof(int32_t));
+    lv_memcpy(old_c->h, c.h, c.row_num * sizeof(int32_t));
+    old_c->grid_w = c.grid_w;
+    old_c->grid_h = c.grid_h;
+    calc_free(&c);
+
+    /*`lv_obj_refr_size` doesn't notify the parent if the size of the container remains the same*/
+    int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
+    int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
+    if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
+        lv_obj_refr_size(cont);
+    }
+
+    lv_obj_send_event(cont, LV_EVENT_LAYOUT_CHANGED, NULL);
+    return true;
+}
+
+/**
+ * Save the result of a full update
+ * @param cont  pointer to a grid container
+ * @param c     the calculated grid of `cont`
+ */
+static void cache_create(lv_obj_t * cont, const lv_grid_calc_t * c)
+{
+    uint32_t child_cnt = cont->spec_attr->child_cnt;
+    size_t size = sizeof(grid_cache_t) + child_cnt * sizeof(grid_item_t) +
+                  (c->col_num * 2 + c->row_num * 2) * sizeof(int32_t);
+    grid_cache_t * cache = lv_layout_cache_alloc(cont, LV_LAYOUT_GRID, size);
+    if(cache == NULL) return;
+
+    cache->cont_w = lv_obj_get_content_width(cont);
+    cache->cont_h = lv_obj_get_content_height(cont);
+    cache->w_layout = cont->w_layout;
+    cache->h_layout = cont->h_layout;
+    cache->item_cnt = child_cnt;
+    cache->items = (grid_item_t *)(cache + 1);
+
+    lv_grid_calc_t * cc = &cache->calc;
+    *cc = *c;
+    cc->x = (int32_t *)(cache->items + child_cnt);
+    cc->w = cc->x + c->col_num;
+    cc->y = cc->w + c->col_num;
+    cc->h = cc->y + c->row_num;
+    lv_memcpy(cc->x, c->x, c->col_num * sizeof(int32_t));
+    lv_memcpy(cc->w, c->w, c->col_num * sizeof(int32_t));
+    lv_memcpy(cc->y, c->y, c->row_num * sizeof(int32_t));
+    lv_memcpy(cc->h, c->h, c->row_num * sizeof(int32_t));
+
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        item_measure(cont->spec_attr->children[i], &cache->items[i]);
+    }
+}
+
+/**
+ * Save the cell and the size of a child
+ */
+static void item_measure(lv_obj_t * item, grid_item_t * dsc)
+{
+    lv_memzero(dsc, sizeof(grid_item_t));
+    dsc->obj = item;
+    dsc->flags = item->flags & ITEM_SKIP_FLAGS;
+    if(dsc->flags) return;
+
+    dsc->col_pos = get_col_pos(item);
+    dsc->col_span = get_col_span(item);
+    dsc->row_pos = get_row_pos(item);
+    dsc->row_span = get_row_span(item);
+    dsc->w = lv_obj_get_width(item);
+    dsc->h = lv_obj_get_height(item);
+}
+
+#endif /*LV_LAYOUT_INCREMENTAL*/
+
 #endif /*LV_USE_GRID*/
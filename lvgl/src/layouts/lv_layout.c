@@ -9,12 +9,21 @@
 #include "lv_layout_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define layout_cnt LV_GLOBAL_DEFAULT()->layout_count
 #define layout_list_def LV_GLOBAL_DEFAULT()->layout_list
+#define layout_cache LV_GLOBAL_DEFAULT()->layout_cache
+#define layout_cache_cnt LV_GLOBAL_DEFAULT()->layout_cache_cnt
+#define layout_cache_capacity LV_GLOBAL_DEFAULT()->layout_cache_capacity
+#define layout_cache_gen LV_GLOBAL_DEFAULT()->layout_cache_gen
+#define layout_stats LV_GLOBAL_DEFAULT()->layout_stats
+
+/*Don't save the layout of containers with less children*/
+#define LAYOUT_CACHE_MIN_CHILD_CNT  4
 
 /**********************
  *      TYPEDEFS
@@ -23,6 +32,9 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_LAYOUT_INCREMENTAL
+    static bool layout_cache_find(const lv_obj_t * obj, uint32_t * index);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -48,11 +60,26 @@ void lv_layout_init(void)
 #if LV_USE_GRID
     lv_grid_init();
 #endif
+
+#if LV_LAYOUT_INCREMENTAL
+    layout_cache_gen = 1;
+#endif
 }
 
 void lv_layout_deinit(void)
 {
     lv_free(layout_list_def);
+
+#if LV_LAYOUT_INCREMENTAL
+    uint32_t i;
+    for(i = 0; i < layout_cache_cnt; i++) {
+        lv_free(layout_cache[i]);
+    }
+    lv_free(layout_cache);
+    layout_cache = NULL;
+    layout_cache_cnt = 0;
+    layout_cache_capacity = 0;
+#endif
 }
 
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
@@ -74,6 +101,127 @@ void lv_layout_apply(lv_obj_t * obj)
     }
 }
 
+#if LV_LAYOUT_INCREMENTAL
+
+void * lv_layout_cache_get(lv_obj_t * obj, uint32_t layout)
+{
+    uint32_t index;
+    if(!layout_cache_find(obj, &index)) return NULL;
+
+    lv_layout_cache_t * entry = layout_cache[index];
+    if(entry->layout != layout || entry->gen != layout_cache_gen) return NULL;
+
+    return entry + 1;
+}
+
+void * lv_layout_cache_alloc(lv_obj_t * obj, uint32_t layout, size_t size)
+{
+    /*Placing a few children is as fast as checking what has changed*/
+    if(lv_obj_get_child_count(obj) < LAYOUT_CACHE_MIN_CHILD_CNT) {
+        lv_layout_cache_drop(obj);
+        return NULL;
+    }
+
+    uint32_t index;
+    lv_layout_cache_t * entry = NULL;
+    if(layout_cache_find(obj, &index)) {
+        entry = layout_cache[index];
+        if(entry->data_size != size) {
+            entry = lv_realloc(entry, sizeof(lv_layout_cache_t) + size);
+            LV_ASSERT_MALLOC(entry);
+            if(entry == NULL) {
+                lv_layout_cache_drop(obj);
+                return NULL;
+            }
+            layout_cache[index] = entry;
+        }
+    }
+    else {
+        /*The list is not shrunk to not allocate again when containers are deleted and created*/
+        if(layout_cache_cnt == layout_cache_capacity) {
+            uint32_t new_capacity = layout_cache_capacity ? layout_cache_capacity * 2 : 8;
+            lv_layout_cache_t ** new_cache = lv_realloc(layout_cache, new_capacity * sizeof(lv_layout_cache_t *));
+            LV_ASSERT_MALLOC(new_cache);
+            if(new_cache == NULL) return NULL;
+            layout_cache = new_cache;
+            layout_cache_capacity = new_capacity;
+        }
+
+        entry = lv_malloc(sizeof(lv_layout_cache_t) + size);
+        LV_ASSERT_MALLOC(entry);
+        if(entry == NULL) return NULL;
+
+        /*Keep the entries sorted by the address of the containers*/
+        lv_memmove(&layout_cache[index + 1], &layout_cache[index],
+                   (layout_cache_cnt - index) * sizeof(lv_layout_cache_t *));
+        layout_cache[index] = entry;
+        layout_cache_cnt++;
+        entry->obj = obj;
+    }
+
+    entry->data_size = size;
+    entry->layout = layout;
+    entry->gen = layout_cache_gen;
+    return entry + 1;
+}
+
+void lv_layout_cache_drop(lv_obj_t * obj)
+{
+    uint32_t index;
+    if(!layout_cache_find(obj, &index)) return;
+
+    lv_free(layout_cache[index]);
+    layout_cache_cnt--;
+    lv_memmove(&layout_cache[index], &layout_cache[index + 1],
+               (layout_cache_cnt - index) * sizeof(lv_layout_cache_t *));
+}
+
+void lv_layout_cache_invalidate_all(void)
+{
+    layout_cache_gen++;
+}
+
+void lv_layout_get_stats(lv_layout_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    *stats = layout_stats;
+}
+
+void lv_layout_reset_stats(void)
+{
+    lv_memzero(&layout_stats, sizeof(layout_stats));
+}
+
+#endif /*LV_LAYOUT_INCREMENTAL*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_LAYOUT_INCREMENTAL
+/**
+ * Search the saved data of a container with binary search
+ * @param obj       pointer to a container
+ * @param index     store the index of the container's entry here,
+ *                  or the index where it should be inserted if it's not found
+ * @return          true: the container has saved data
+ */
+static bool layout_cache_find(const lv_obj_t * obj, uint32_t * index)
+{
+    uint32_t first = 0;
+    uint32_t last = layout_cache_cnt;
+    while(first < last) {
+        uint32_t mid = first + (last - first) / 2;
+        if(layout_cache[mid]->obj == obj) {
+            *index = mid;
+            return true;
+        }
+
+        if((lv_uintptr_t)layout_cache[mid]->obj < (lv_uintptr_t)obj) first = mid + 1;
+        else last = mid;
+    }
+
+    *index = first;
+    return false;
+}
+#endif
@@ -40,6 +40,20 @@ typedef enum {
     LV_LAYOUT_LAST
 } lv_layout_t;
 
+#if LV_LAYOUT_INCREMENTAL
+typedef struct {
+    uint32_t full_cnt;          /**< Updates which measured every child and placed every track*/
+    uint32_t incremental_cnt;   /**< Updates which reused the cached measurements*/
+    uint32_t skip_cnt;          /**< Updates skipped as the size of no child has changed*/
+    uint32_t track_update_cnt;  /**< Tracks whose children were placed again*/
+    uint32_t track_reuse_cnt;   /**< Tracks kept as they were in the previous update*/
+} lv_layout_stats_t;
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
 /**
  * Register a new layout
  * @param cb        the layout update callback
@@ -48,6 +62,22 @@ typedef enum {
  */
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data);
 
+#if LV_LAYOUT_INCREMENTAL
+
+/**
+ * Get the counters of the incremental flex and grid updates.
+ * The time spent on the layout updates can be measured with the `LV_PROFILER_LAYOUT` traces.
+ * @param stats     store the counters here
+ */
+void lv_layout_get_stats(lv_layout_stats_t * stats);
+
+/**
+ * Reset the counters of the incremental flex and grid updates
+ */
+void lv_layout_reset_stats(void);
+
+#endif /*LV_LAYOUT_INCREMENTAL*/
+
 /**********************
  *      MACROS
  **********************/
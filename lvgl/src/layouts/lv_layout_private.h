@@ -29,6 +29,16 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
+#if LV_LAYOUT_INCREMENTAL
+/** The result of the last layout update of a container. The data saved by the layout follows it.*/
+typedef struct {
+    lv_obj_t * obj;     /**< The container*/
+    size_t data_size;
+    uint32_t layout;    /**< The layout which saved `data`*/
+    uint32_t gen;       /**< `data` is valid only if the layout styles haven't changed since it was saved*/
+} lv_layout_cache_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -47,6 +57,39 @@ void lv_layout_deinit(void);
  */
 void lv_layout_apply(lv_obj_t * obj);
 
+#if LV_LAYOUT_INCREMENTAL
+
+/**
+ * Get the data saved by a layout in the last update of a container
+ * @param obj       pointer to a container
+ * @param layout    ID of the layout
+ * @return          the saved data or NULL if there is no data or a layout related style has changed since then
+ */
+void * lv_layout_cache_get(lv_obj_t * obj, uint32_t layout);
+
+/**
+ * Allocate space to save the result of a layout update. The previously saved data is not kept.
+ * @param obj       pointer to a container
+ * @param layout    ID of the layout
+ * @param size      size of the data in bytes
+ * @return          pointer to the allocated data or NULL on error or if `obj` has only a few children
+ */
+void * lv_layout_cache_alloc(lv_obj_t * obj, uint32_t layout, size_t size);
+
+/**
+ * Free the saved layout data of a container
+ * @param obj       pointer to a container
+ */
+void lv_layout_cache_drop(lv_obj_t * obj);
+
+/**
+ * Mark the saved data of all containers as invalid.
+ * Should be called if a style property affecting the layout has changed.
+ */
+void lv_layout_cache_invalidate_all(void);
+
+#endif /*LV_LAYOUT_INCREMENTAL*/
+
 /**********************
  *      MACROS
  **********************/
@@ -9,7 +9,7 @@
 #include "../../draw/lv_image_decoder_private.h"
 #include "lv_bin_decoder.h"
 #include "../../draw/lv_draw_image.h"
-#include "../../draw/lv_draw_buf.h"
+#include "../../draw/lv_draw_buf_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../../libs/rle/lv_rle.h"
@@ -47,6 +47,25 @@ typedef struct _lv_image_compressed_t {
     const uint8_t * data; /*Compressed data*/
 } lv_image_compressed_t;
 
+/**
+ * Random access to the tiles of an `LV_IMAGE_COMPRESS_LZ4_TILED` image.
+ * The data following the compression header: 16 bit tile width and height,
+ * 32 bit offset of each tile from the first tile and the end of the last tile,
+ * then the LZ4 compressed tiles row by row. The rows of a tile are stored without padding.
+ */
+typedef struct {
+    uint32_t tile_w;
+    uint32_t tile_h;
+    uint32_t col_cnt;
+    uint32_t tile_cnt;
+    uint32_t * offsets;         /*`tile_cnt + 1` offsets of the tiles from the first tile*/
+    const uint8_t * data;       /*The first tile if the tiles are in memory*/
+    const uint8_t * map;        /*The mapped file to release*/
+    uint32_t data_pos;          /*File position of the first tile if the tiles are read from the file*/
+    uint8_t * read_buf;         /*Buffer for a compressed tile read from the file*/
+    uint32_t read_buf_size;
+} tiles_t;
+
 typedef struct {
     lv_fs_file_t * f;
     lv_color32_t * palette;
@@ -56,6 +75,7 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    tiles_t * tiles;                    /*The tiles of a tiled image to decompress in get_area_cb*/
 } decoder_data_t;
 
 /**********************
@@ -72,6 +92,14 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static bool is_mappable(lv_color_format_t cf);
+static lv_result_t map_file(lv_image_decoder_dsc_t * dsc);
+static void mmap_draw_buf_free_cb(void * buf);
+static lv_result_t decode_tiled(lv_image_decoder_dsc_t * dsc);
+static lv_result_t tiles_open(lv_image_decoder_dsc_t * dsc, tiles_t * tiles);
+static void tiles_close(tiles_t * tiles);
+static lv_result_t tile_decompress(lv_image_decoder_dsc_t * dsc, uint32_t idx, uint8_t * buf, uint32_t buf_size);
+static lv_result_t get_tile_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area, lv_area_t * decoded_area);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
@@ -81,6 +109,11 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
  *  STATIC VARIABLES
  **********************/
 
+/*The draw buffers of the mapped files only need to release the mapping*/
+static const lv_draw_buf_handlers_t mmap_draw_buf_handlers = {
+    .buf_free_cb = mmap_draw_buf_free_cb,
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -220,7 +253,14 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
         lv_color_format_t cf = dsc->header.cf;
 
-        if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        if(!(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) && is_mappable(cf) && map_file(dsc) == LV_RESULT_OK) {
+            /*The pixels are used directly from the mapped file*/
+            res = LV_RESULT_OK;
+        }
+        else if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) {
+            res = decode_tiled(dsc);
+        }
+        else if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
             res = decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
@@ -261,7 +301,10 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         }
 
         lv_color_format_t cf = image->header.cf;
-        if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) {
+            res = decode_tiled(dsc);
+        }
+        else if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
             res = decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
@@ -403,6 +446,10 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    /*Tiled images are decompressed tile by tile*/
+    decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data && decoder_data->tiles) return get_tile_area(dsc, full_area, decoded_area);
+
     lv_color_format_t cf = dsc->header.cf;
     /*Check if cf is supported*/
 
@@ -420,7 +467,6 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
     }
 
     lv_fs_res_t res = LV_FS_RES_UNKNOWN;
-    decoder_data_t * decoder_data = dsc->user_data;
     if(decoder_data == NULL) {
         LV_LOG_ERROR("Unexpected null decoder data");
         return LV_RESULT_INVALID;
@@ -570,6 +616,7 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
 
     if(decoder_data->decoded) lv_draw_buf_destroy(decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy(decoder_data->decompressed);
+    if(decoder_data->tiles) tiles_close(decoder_data->tiles);
     lv_free(decoder_data->palette);
     lv_free(decoder_data);
     dsc->user_data = NULL;
@@ -934,6 +981,7 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
     lv_result_t res;
     lv_fs_res_t fs_res;
     uint8_t * file_buf = NULL;
+    const uint8_t * file_map = NULL;
     lv_image_compressed_t * compressed = &decoder_data->compressed;
 
     lv_memzero(compressed, sizeof(lv_image_compressed_t));
@@ -963,24 +1011,32 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
             return LV_RESULT_INVALID;
         }
 
-        file_buf = lv_malloc(compressed_len);
-        if(file_buf == NULL) {
-            LV_LOG_WARN("No memory for compressed file");
-            return LV_RESULT_INVALID;
-
+        /*Decompress straight from the mapped file if the driver supports it*/
+        uint32_t map_size;
+        file_map = lv_fs_mmap(f, &map_size);
+        if(file_map) {
+            compressed->data = file_map + sizeof(lv_image_header_t) + len;
         }
+        else {
+            file_buf = lv_malloc(compressed_len);
+            if(file_buf == NULL) {
+                LV_LOG_WARN("No memory for compressed file");
+                return LV_RESULT_INVALID;
 
-        /*Continue to read the compressed data following compression header*/
-        fs_res = lv_fs_read(f, file_buf, compressed_len, &rn);
-        if(fs_res != LV_FS_RES_OK || rn != compressed_len) {
-            LV_LOG_WARN("Read compressed file failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
-                        compressed_len);
-            lv_free(file_buf);
-            return LV_RESULT_INVALID;
-        }
+            }
+
+            /*Continue to read the compressed data following compression header*/
+            fs_res = lv_fs_read(f, file_buf, compressed_len, &rn);
+            if(fs_res != LV_FS_RES_OK || rn != compressed_len) {
+                LV_LOG_WARN("Read compressed file failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
+                            compressed_len);
+                lv_free(file_buf);
+                return LV_RESULT_INVALID;
+            }
 
-        /*Decompress the image*/
-        compressed->data = file_buf;
+            /*Decompress the image*/
+            compressed->data = file_buf;
+        }
     }
     else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
         lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
@@ -1004,6 +1060,7 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
     res = decompress_image(dsc, compressed);
     compressed->data = NULL; /*No need to store the data any more*/
     lv_free(file_buf);
+    if(file_map) lv_fs_munmap(file_map);
     if(res != LV_RESULT_OK) {
         LV_LOG_WARN("Decompress failed");
         return LV_RESULT_INVALID;
@@ -1043,6 +1100,363 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
 #endif
 }
 
+static bool is_mappable(lv_color_format_t cf)
+{
+    return cf == LV_COLOR_FORMAT_ARGB8888       \
+           || cf == LV_COLOR_FORMAT_XRGB8888    \
+           || cf == LV_COLOR_FORMAT_RGB888      \
+           || cf == LV_COLOR_FORMAT_RGB565      \
+           || cf == LV_COLOR_FORMAT_RGB565_SWAPPED      \
+           || cf == LV_COLOR_FORMAT_RGB565A8    \
+           || cf == LV_COLOR_FORMAT_ARGB8565    \
+           || cf == LV_COLOR_FORMAT_A8;
+}
+
+/**
+ * Use the pixels of an uncompressed image file directly from a read-only mapping of the file.
+ * The mapping is released when the decoded draw buffer is destroyed.
+ */
+static lv_result_t map_file(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_color_format_t cf = dsc->header.cf;
+
+    uint32_t len = dsc->header.stride * dsc->header.h;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) {
+        len += (dsc->header.stride / 2) * dsc->header.h; /*A8 mask*/
+    }
+
+    uint32_t map_size;
+    const uint8_t * map = lv_fs_mmap(decoder_data->f, &map_size);
+    if(map == NULL) return LV_RESULT_INVALID;
+
+    uint8_t * data = (uint8_t *)map + sizeof(lv_image_header_t);
+    lv_draw_buf_t * decoded = NULL;
+    if(dsc->header.stride != 0 && map_size >= sizeof(lv_image_header_t) + len && lv_draw_buf_align(data, cf) == data) {
+        decoded = lv_malloc(sizeof(lv_draw_buf_t));
+        LV_ASSERT_MALLOC(decoded);
+    }
+
+    if(decoded == NULL ||
+       lv_draw_buf_init(decoded, dsc->header.w, dsc->header.h, cf, dsc->header.stride, data, len) != LV_RESULT_OK) {
+        lv_free(decoded);
+        lv_fs_munmap(map);
+        return LV_RESULT_INVALID;
+    }
+
+    decoded->unaligned_data = (void *)map;
+    decoded->handlers = &mmap_draw_buf_handlers;
+    lv_draw_buf_set_flag(decoded, LV_IMAGE_FLAGS_ALLOCATED);
+
+    dsc->decoded = decoded;
+    decoder_data->decoded = decoded; /*Free when decoder closes*/
+    return LV_RESULT_OK;
+}
+
+static void mmap_draw_buf_free_cb(void * buf)
+{
+    lv_fs_munmap(buf);
+}
+
+/**
+ * Open a tiled image. The tiles are decompressed in `get_area_cb` if `partial_tiles` is set,
+ * else the whole image is decompressed here.
+ */
+static lv_result_t decode_tiled(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = get_decoder_data(dsc);
+    if(decoder_data == NULL) return LV_RESULT_INVALID;
+
+    tiles_t * tiles = lv_malloc_zeroed(sizeof(tiles_t));
+    LV_ASSERT_MALLOC(tiles);
+    if(tiles == NULL) return LV_RESULT_INVALID;
+    decoder_data->tiles = tiles; /*Free on decoder close*/
+
+    if(tiles_open(dsc, tiles) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    if(dsc->args.partial_tiles) return LV_RESULT_OK;
+
+    lv_draw_buf_t * decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, dsc->header.h,
+                                                    dsc->header.cf, dsc->header.stride);
+    if(decoded == NULL) {
+        LV_LOG_WARN("No memory for the tiled image");
+        return LV_RESULT_INVALID;
+    }
+
+    /*Decompress the tiles one by one and copy their rows to their place*/
+    uint32_t px_size = lv_color_format_get_size(dsc->header.cf);
+    uint32_t stride = decoded->header.stride;
+    uint8_t * tile_buf = lv_malloc(tiles->tile_w * tiles->tile_h * px_size);
+    LV_ASSERT_MALLOC(tile_buf);
+    if(tile_buf == NULL) {
+        lv_draw_buf_destroy(decoded);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t i;
+    for(i = 0; i < tiles->tile_cnt; i++) {
+        uint32_t x = (i % tiles->col_cnt) * tiles->tile_w;
+        uint32_t y = (i / tiles->col_cnt) * tiles->tile_h;
+        uint32_t tile_h = LV_MIN(tiles->tile_h, dsc->header.h - y);
+        uint32_t tile_stride = LV_MIN(tiles->tile_w, dsc->header.w - x) * px_size;
+
+        if(tile_decompress(dsc, i, tile_buf, tile_stride * tile_h) != LV_RESULT_OK) {
+            lv_free(tile_buf);
+            lv_draw_buf_destroy(decoded);
+            return LV_RESULT_INVALID;
+        }
+
+        uint8_t * dest = decoded->data + y * stride + x * px_size;
+        uint32_t row;
+        for(row = 0; row < tile_h; row++) {
+            lv_memcpy(dest, tile_buf + row * tile_stride, tile_stride);
+            dest += stride;
+        }
+    }
+    lv_free(tile_buf);
+
+    tiles_close(tiles);
+    decoder_data->tiles = NULL;
+
+    dsc->decoded = decoded;
+    decoder_data->decoded = decoded; /*Free when decoder closes*/
+    return LV_RESULT_OK;
+}
+
+/**
+ * Read the tile size and the offset table of a tiled image.
+ * The compressed tiles are used from memory if possible, else they will be read from the file one by one.
+ */
+static lv_result_t tiles_open(lv_image_decoder_dsc_t * dsc, tiles_t * tiles)
+{
+#if LV_USE_LZ4
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_color_format_t cf = dsc->header.cf;
+    if(!is_mappable(cf) || cf == LV_COLOR_FORMAT_RGB565A8) {
+        LV_LOG_WARN("Tiled image with unsupported color format: %d", cf);
+        return LV_RESULT_INVALID;
+    }
+
+    /*Data after the image header: compression header, tile size, offset table, tiles*/
+    const uint8_t * src = NULL;
+    uint32_t src_size;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        uint32_t map_size;
+        tiles->map = lv_fs_mmap(decoder_data->f, &map_size);
+        if(tiles->map) {
+            src = tiles->map + sizeof(lv_image_header_t);
+            src_size = map_size - sizeof(lv_image_header_t);
+        }
+        else {
+            if(lv_fs_get_size(decoder_data->f, &src_size) != LV_FS_RES_OK) return LV_RESULT_INVALID;
+            src_size -= sizeof(lv_image_header_t);
+        }
+    }
+    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t * image = dsc->src;
+        src = image->data;
+        src_size = image->data_size;
+    }
+    else {
+        return LV_RESULT_INVALID;
+    }
+
+    lv_image_compressed_t compressed;
+    uint16_t tile_size[2];
+    uint32_t head_size = 12 + sizeof(tile_size);
+    if(src_size < head_size) return LV_RESULT_INVALID;
+    if(src) {
+        lv_memcpy(&compressed, src, 12);
+        lv_memcpy(tile_size, src + 12, sizeof(tile_size));
+    }
+    else {
+        uint8_t head[12 + sizeof(tile_size)];
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t), head, head_size, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != head_size) {
+            LV_LOG_WARN("Read tiled image header failed: %d", fs_res);
+            return LV_RESULT_INVALID;
+        }
+        lv_memcpy(&compressed, head, 12);
+        lv_memcpy(tile_size, head + 12, sizeof(tile_size));
+    }
+
+    if(compressed.method != LV_IMAGE_COMPRESS_LZ4_TILED || tile_size[0] == 0 || tile_size[1] == 0) {
+        LV_LOG_WARN("Invalid tiled image: method %" LV_PRIu32 ", tile size %dx%d",
+                    (uint32_t)compressed.method, tile_size[0], tile_size[1]);
+        return LV_RESULT_INVALID;
+    }
+
+    tiles->tile_w = tile_size[0];
+    tiles->tile_h = tile_size[1];
+    tiles->col_cnt = (dsc->header.w + tiles->tile_w - 1) / tiles->tile_w;
+    tiles->tile_cnt = tiles->col_cnt * ((dsc->header.h + tiles->tile_h - 1) / tiles->tile_h);
+
+    uint32_t table_size = (tiles->tile_cnt + 1) * sizeof(uint32_t);
+    if(src_size < head_size + table_size) return LV_RESULT_INVALID;
+
+    /*Copy the table as it might be unaligned in memory*/
+    tiles->offsets = lv_malloc(table_size);
+    LV_ASSERT_MALLOC(tiles->offsets);
+    if(tiles->offsets == NULL) return LV_RESULT_INVALID;
+
+    if(src) {
+        lv_memcpy(tiles->offsets, src + head_size, table_size);
+        tiles->data = src + head_size + table_size;
+    }
+    else {
+        uint32_t rn;
+        tiles->data_pos = sizeof(lv_image_header_t) + head_size + table_size;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t) + head_size, tiles->offsets,
+                                             table_size, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != table_size) {
+            LV_LOG_WARN("Read tile offsets failed: %d", fs_res);
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    /*The tiles are checked against the end of the data only once here*/
+    if(compressed.compressed_size != src_size - 12 ||
+       tiles->offsets[tiles->tile_cnt] != src_size - head_size - table_size) {
+        LV_LOG_WARN("Tiled image size mismatch: %" LV_PRIu32 " != %" LV_PRIu32, compressed.compressed_size, src_size - 12);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+#else
+    LV_UNUSED(dsc);
+    LV_UNUSED(tiles);
+    LV_LOG_WARN("LZ4 decompression is not enabled");
+    return LV_RESULT_INVALID;
+#endif /*LV_USE_LZ4*/
+}
+
+static void tiles_close(tiles_t * tiles)
+{
+    if(tiles->map) lv_fs_munmap(tiles->map);
+    lv_free(tiles->offsets);
+    lv_free(tiles->read_buf);
+    lv_free(tiles);
+}
+
+/**
+ * Decompress a tile
+ * @param dsc       the decoder descriptor of an opened tiled image
+ * @param idx       index of the tile, row by row
+ * @param buf       buffer for the tile's pixels without row padding
+ * @param buf_size  the expected size of the decompressed tile
+ * @return          LV_RESULT_OK: the tile is decompressed; LV_RESULT_INVALID: read or decompression error
+ */
+static lv_result_t tile_decompress(lv_image_decoder_dsc_t * dsc, uint32_t idx, uint8_t * buf, uint32_t buf_size)
+{
+#if LV_USE_LZ4
+    decoder_data_t * decoder_data = dsc->user_data;
+    tiles_t * tiles = decoder_data->tiles;
+    uint32_t start = tiles->offsets[idx];
+    uint32_t end = tiles->offsets[idx + 1];
+    if(end < start || end > tiles->offsets[tiles->tile_cnt]) {
+        LV_LOG_WARN("Invalid offset of tile %" LV_PRIu32, idx);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t len = end - start;
+    const uint8_t * input;
+    if(tiles->data) {
+        input = tiles->data + start;
+    }
+    else {
+        if(tiles->read_buf_size < len) {
+            uint8_t * read_buf = lv_realloc(tiles->read_buf, len);
+            LV_ASSERT_MALLOC(read_buf);
+            if(read_buf == NULL) return LV_RESULT_INVALID;
+            tiles->read_buf = read_buf;
+            tiles->read_buf_size = len;
+        }
+
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, tiles->data_pos + start, tiles->read_buf, len, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != len) {
+            LV_LOG_WARN("Read tile %" LV_PRIu32 " failed: %d", idx, fs_res);
+            return LV_RESULT_INVALID;
+        }
+        input = tiles->read_buf;
+    }
+
+    int ret = LZ4_decompress_safe((const char *)input, (char *)buf, (int)len, (int)buf_size);
+    if(ret < 0 || (uint32_t)ret != buf_size) {
+        LV_LOG_WARN("Decompress tile %" LV_PRIu32 " failed: %d", idx, ret);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+#else
+    LV_UNUSED(dsc);
+    LV_UNUSED(idx);
+    LV_UNUSED(buf);
+    LV_UNUSED(buf_size);
+    return LV_RESULT_INVALID;
+#endif /*LV_USE_LZ4*/
+}
+
+/**
+ * Decompress the tiles overlapping with `full_area` one by one.
+ * `decoded_area` is set to the area of the tile, even if only a part of it is in `full_area`.
+ */
+static lv_result_t get_tile_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    tiles_t * tiles = decoder_data->tiles;
+    int32_t tile_w = (int32_t)tiles->tile_w;
+    int32_t tile_h = (int32_t)tiles->tile_h;
+    int32_t first_x = full_area->x1 - full_area->x1 % tile_w;
+
+    int32_t x;
+    int32_t y;
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        x = first_x;
+        y = full_area->y1 - full_area->y1 % tile_h;
+    }
+    else {
+        x = decoded_area->x1 + tile_w;
+        y = decoded_area->y1;
+        if(x > full_area->x2 || x >= dsc->header.w) {
+            x = first_x;
+            y += tile_h;
+        }
+    }
+
+    if(y > full_area->y2 || y >= dsc->header.h) return LV_RESULT_INVALID;
+
+    decoded_area->x1 = x;
+    decoded_area->y1 = y;
+    decoded_area->x2 = LV_MIN(x + tile_w, dsc->header.w) - 1;
+    decoded_area->y2 = LV_MIN(y + tile_h, dsc->header.h) - 1;
+
+    lv_color_format_t cf = dsc->header.cf;
+    uint32_t w = lv_area_get_width(decoded_area);
+    uint32_t h = lv_area_get_height(decoded_area);
+    uint32_t stride = w * lv_color_format_get_size(cf);
+    lv_draw_buf_t * decoded = lv_draw_buf_reshape(decoder_data->decoded_partial, cf, w, h, stride);
+    if(decoded == NULL) {
+        if(decoder_data->decoded_partial) lv_draw_buf_destroy(decoder_data->decoded_partial);
+        /*Allocate for a whole tile to fit all tiles*/
+        decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, tile_w, tile_h, cf,
+                                        tile_w * lv_color_format_get_size(cf));
+        decoder_data->decoded_partial = decoded; /*Free on decoder close*/
+        if(decoded == NULL) return LV_RESULT_INVALID;
+        decoded = lv_draw_buf_reshape(decoded, cf, w, h, stride);
+    }
+
+    uint32_t idx = (y / tile_h) * tiles->col_cnt + x / tile_w;
+    if(tile_decompress(dsc, idx, decoded->data, stride * h) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    if(dsc->header.flags & LV_IMAGE_FLAGS_PREMULTIPLIED) lv_draw_buf_set_flag(decoded, LV_IMAGE_FLAGS_PREMULTIPLIED);
+    else lv_draw_buf_clear_flag(decoded, LV_IMAGE_FLAGS_PREMULTIPLIED);
+
+    dsc->decoded = decoded;
+    return LV_RESULT_OK;
+}
+
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out)
 {
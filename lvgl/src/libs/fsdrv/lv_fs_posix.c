@@ -13,6 +13,7 @@
 #include <fcntl.h>
 #include <stdio.h>
 #include <sys/types.h>
+#include <sys/mman.h>
 #include <dirent.h>
 #include <unistd.h>
 #include <errno.h>
@@ -45,6 +46,8 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+static void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t size);
+static void fs_munmap(lv_fs_drv_t * drv, void * buf, uint32_t size);
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn, uint32_t fn_len);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -84,6 +87,8 @@ void lv_fs_posix_init(void)
     fs_drv_p->write_cb = fs_write;
     fs_drv_p->seek_cb = fs_seek;
     fs_drv_p->tell_cb = fs_tell;
+    fs_drv_p->mmap_cb = fs_mmap;
+    fs_drv_p->munmap_cb = fs_munmap;
 
     fs_drv_p->dir_close_cb = fs_dir_close;
     fs_drv_p->dir_open_cb = fs_dir_open;
@@ -254,6 +259,39 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return LV_FS_RES_OK;
 }
 
+/**
+ * Map an opened file to the memory for reading
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param size      size of the file
+ * @return pointer to the mapped file or NULL in case of fail
+ */
+static void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t size)
+{
+    LV_UNUSED(drv);
+
+    int fd = FILEP2FD(file_p);
+    void * buf = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    if(buf == MAP_FAILED) {
+        LV_LOG_WARN("Could not map file: %d, errno: %d", fd, errno);
+        return NULL;
+    }
+
+    return buf;
+}
+
+/**
+ * Release a mapping created by `fs_mmap`
+ * @param drv       pointer to a driver where this function belongs
+ * @param buf       pointer to the mapped file
+ * @param size      size of the mapped file
+ */
+static void fs_munmap(lv_fs_drv_t * drv, void * buf, uint32_t size)
+{
+    LV_UNUSED(drv);
+    munmap(buf, size);
+}
+
 /**
  * Initialize a 'fs_read_dir_t' variable for directory reading
  * @param drv   pointer to a driver where this function belongs
@@ -13,6 +13,7 @@
 #ifndef WIN32
     #include <dirent.h>
     #include <unistd.h>
+    #include <sys/mman.h>
 #else
     #include <windows.h>
 #endif
@@ -47,6 +48,10 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#ifndef WIN32
+    static void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t size);
+    static void fs_munmap(lv_fs_drv_t * drv, void * buf, uint32_t size);
+#endif
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn, uint32_t fn_len);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -85,6 +90,10 @@ void lv_fs_stdio_init(void)
     fs_drv_p->write_cb = fs_write;
     fs_drv_p->seek_cb = fs_seek;
     fs_drv_p->tell_cb = fs_tell;
+#ifndef WIN32
+    fs_drv_p->mmap_cb = fs_mmap;
+    fs_drv_p->munmap_cb = fs_munmap;
+#endif
 
     fs_drv_p->dir_close_cb = fs_dir_close;
     fs_drv_p->dir_open_cb = fs_dir_open;
@@ -214,6 +223,34 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return LV_FS_RES_OK;
 }
 
+#ifndef WIN32
+/**
+ * Map an opened file to the memory for reading
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    pointer to a FILE variable
+ * @param size      size of the file
+ * @return pointer to the mapped file or NULL in case of fail
+ */
+static void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t size)
+{
+    LV_UNUSED(drv);
+    void * buf = mmap(NULL, size, PROT_READ, MAP_SHARED, fileno(file_p), 0);
+    return buf == MAP_FAILED ? NULL : buf;
+}
+
+/**
+ * Release a mapping created by `fs_mmap`
+ * @param drv       pointer to a driver where this function belongs
+ * @param buf       pointer to the mapped file
+ * @param size      size of the mapped file
+ */
+static void fs_munmap(lv_fs_drv_t * drv, void * buf, uint32_t size)
+{
+    LV_UNUSED(drv);
+    munmap(buf, size);
+}
+#endif
+
 /**
  * Initialize a 'DIR' or 'HANDLE' variable for directory reading
  * @param drv   pointer to a driver where this function belongs
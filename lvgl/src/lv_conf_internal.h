@@ -23,6 +23,7 @@
 #define LV_STDLIB_CLIB              1
 #define LV_STDLIB_MICROPYTHON       2
 #define LV_STDLIB_RTTHREAD          3
+#define LV_STDLIB_POOL              4
 #define LV_STDLIB_CUSTOM            255
 
 #define LV_DRAW_SW_ASM_NONE             0
@@ -107,6 +108,7 @@
  * - LV_STDLIB_CLIB:        Standard C functions, like malloc, strlen, etc
  * - LV_STDLIB_MICROPYTHON: MicroPython implementation
  * - LV_STDLIB_RTTHREAD:    RT-Thread implementation
+ * - LV_STDLIB_POOL:        Size class pools with per-thread caches on top of the C library's malloc
  * - LV_STDLIB_CUSTOM:      Implement the functions externally
  */
 #ifndef LV_USE_STDLIB_MALLOC
@@ -236,6 +238,28 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL
+    /** Size of the slabs taken from the C library and split into blocks of one size class.
+     *  Larger allocations (e.g. draw buffers) are passed to the C library directly. */
+    #ifndef LV_MEM_SLAB_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_SIZE
+            #define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+        #else
+            #define LV_MEM_SLAB_SIZE (16 * 1024U)     /**< [bytes] */
+        #endif
+    #endif
+
+    /** Number of free blocks per size class cached by each thread to allocate and free without locking.
+     *  Used only if `LV_USE_OS` is `LV_OS_PTHREAD` or `LV_OS_WINDOWS`. 0: disable the per-thread caches. */
+    #ifndef LV_MEM_MAGAZINE_SIZE
+        #ifdef CONFIG_LV_MEM_MAGAZINE_SIZE
+            #define LV_MEM_MAGAZINE_SIZE CONFIG_LV_MEM_MAGAZINE_SIZE
+        #else
+            #define LV_MEM_MAGAZINE_SIZE 32
+        #endif
+    #endif
+#endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL*/
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -372,6 +396,17 @@
     #endif
 #endif
 
+/** Keep the buffers of the finished layers up to this size to reuse them for new layers
+ *  with the same width, height, stride and color format, instead of freeing and allocating them in every frame.
+ *  The least recently used buffers are freed first. 0: disable */
+#ifndef LV_DRAW_LAYER_BUF_POOL_SIZE
+    #ifdef CONFIG_LV_DRAW_LAYER_BUF_POOL_SIZE
+        #define LV_DRAW_LAYER_BUF_POOL_SIZE CONFIG_LV_DRAW_LAYER_BUF_POOL_SIZE
+    #else
+        #define LV_DRAW_LAYER_BUF_POOL_SIZE 0  /**< [bytes]*/
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -599,7 +634,7 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /** Allow buffering some shadow calculation.
          *  LV_DRAW_SW_SHADOW_CACHE_SIZE is the maximum shadow size to buffer, where shadow size is
-         *  `shadow_width + radius`.  Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost. */
+         *  `shadow_width + radius`.  Caching a shadow has `2 * shadow_size^2` RAM cost. */
         #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
             #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
                 #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
@@ -608,6 +643,15 @@
             #endif
         #endif
 
+        /** Maximum RAM used by the buffered shadows in bytes. The least recently used shadows are freed first. */
+        #ifndef LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY
+            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY
+                #define LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY CONFIG_LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY
+            #else
+                #define LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY (32 * 1024)
+            #endif
+        #endif
+
         /** Set number of maximally-cached circle data.
          *  The circumference of 1/4 circle are saved for anti-aliasing.
          *  `radius * 4` bytes are used per circle (the most often used radiuses are saved).
@@ -648,6 +692,17 @@
         #endif
     #endif
 
+    /** Keep the color and opacity maps of the gradients to reuse them in the next frames.
+     *  The maximum total size of the kept maps in bytes. The least recently used ones are freed first.
+     *  0: disable */
+    #ifndef LV_DRAW_SW_GRADIENT_CACHE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_GRADIENT_CACHE_SIZE
+            #define LV_DRAW_SW_GRADIENT_CACHE_SIZE CONFIG_LV_DRAW_SW_GRADIENT_CACHE_SIZE
+        #else
+            #define LV_DRAW_SW_GRADIENT_CACHE_SIZE      0
+        #endif
+    #endif
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -1530,6 +1585,17 @@
     #endif
 #endif
 
+/** Split the image cache into this many independently locked parts to let the draw threads
+ *  use it at the same time. Each part can hold `LV_CACHE_DEF_SIZE / LV_IMAGE_CACHE_SHARD_CNT` bytes.
+ *  0 or 1: use a single part. */
+#ifndef LV_IMAGE_CACHE_SHARD_CNT
+    #ifdef CONFIG_LV_IMAGE_CACHE_SHARD_CNT
+        #define LV_IMAGE_CACHE_SHARD_CNT CONFIG_LV_IMAGE_CACHE_SHARD_CNT
+    #else
+        #define LV_IMAGE_CACHE_SHARD_CNT 0
+    #endif
+#endif
+
 /** Default number of image header cache entries. The cache is used to store the headers of images
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #ifndef LV_IMAGE_HEADER_CACHE_DEF_CNT
@@ -1540,6 +1606,38 @@
     #endif
 #endif
 
+/** 1: Decode the images missing from the image cache in a background thread instead of the rendering.
+ *  The images are not drawn until they are decoded, then their widgets are invalidated.
+ *  Requires `LV_USE_OS` and `LV_CACHE_DEF_SIZE > 0`. */
+#ifndef LV_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC
+        #define LV_IMAGE_DECODER_ASYNC CONFIG_LV_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_IMAGE_DECODER_ASYNC  0
+    #endif
+#endif
+
+/** 1: Store the decoded images of image files and variables in a directory set by `lv_image_disk_cache_set_path()`
+ *  and load them from there (e.g. after a reboot) instead of decoding them again.
+ *  Requires `LV_CACHE_DEF_SIZE > 0`. */
+#ifndef LV_USE_IMAGE_DISK_CACHE
+    #ifdef CONFIG_LV_USE_IMAGE_DISK_CACHE
+        #define LV_USE_IMAGE_DISK_CACHE CONFIG_LV_USE_IMAGE_DISK_CACHE
+    #else
+        #define LV_USE_IMAGE_DISK_CACHE 0
+    #endif
+#endif
+#if LV_USE_IMAGE_DISK_CACHE
+    /** Maximum total size of the stored images [bytes] */
+    #ifndef LV_IMAGE_DISK_CACHE_MAX_SIZE
+        #ifdef CONFIG_LV_IMAGE_DISK_CACHE_MAX_SIZE
+            #define LV_IMAGE_DISK_CACHE_MAX_SIZE CONFIG_LV_IMAGE_DISK_CACHE_MAX_SIZE
+        #else
+            #define LV_IMAGE_DISK_CACHE_MAX_SIZE (16 * 1024 * 1024)
+        #endif
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1573,6 +1671,62 @@
     #endif
 #endif
 
+/** Keep a small per-object table of resolved style property values (keyed by part, state and property)
+ *  so repeated getters during drawing are O(1). Costs ~400 bytes per drawn widget.
+ *  The table is invalidated when the widget's (or an ancestor's) styles or state change. */
+#ifndef LV_OBJ_STYLE_PROP_CACHE
+    #ifdef CONFIG_LV_OBJ_STYLE_PROP_CACHE
+        #define LV_OBJ_STYLE_PROP_CACHE CONFIG_LV_OBJ_STYLE_PROP_CACHE
+    #else
+        #define LV_OBJ_STYLE_PROP_CACHE 0
+    #endif
+#endif
+
+/** Share the local styles of widgets which have the same local properties with the same values,
+ *  instead of allocating a private style for each widget. */
+#ifndef LV_OBJ_LOCAL_STYLE_INTERN
+    #ifdef CONFIG_LV_OBJ_LOCAL_STYLE_INTERN
+        #define LV_OBJ_LOCAL_STYLE_INTERN CONFIG_LV_OBJ_LOCAL_STYLE_INTERN
+    #else
+        #define LV_OBJ_LOCAL_STYLE_INTERN 0
+    #endif
+#endif
+
+/** Max. memory for the bitmaps of the widgets having `LV_OBJ_FLAG_CACHE_LAYER`.
+ *  Such widgets are rendered with their children once and the bitmap is reused until
+ *  something changes in the subtree. The least recently used bitmaps are freed first.
+ *  0: disable, the flag is ignored */
+#ifndef LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    #ifdef CONFIG_LV_OBJ_CACHE_LAYER_MAX_MEMORY
+        #define LV_OBJ_CACHE_LAYER_MAX_MEMORY CONFIG_LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    #else
+        #define LV_OBJ_CACHE_LAYER_MAX_MEMORY 0  /**< [bytes]*/
+    #endif
+#endif
+
+/** Don't draw the widgets (or parts of them) which are covered by their opaque younger siblings.
+ *  The skipped widgets don't get draw events either.
+ *  See `lv_display_get_occlusion_stats()` for the culled pixels. */
+#ifndef LV_REFR_OCCLUSION_CULLING
+    #ifdef CONFIG_LV_REFR_OCCLUSION_CULLING
+        #define LV_REFR_OCCLUSION_CULLING CONFIG_LV_REFR_OCCLUSION_CULLING
+    #else
+        #define LV_REFR_OCCLUSION_CULLING 0
+    #endif
+#endif
+
+/** In `LV_DISPLAY_RENDER_MODE_DIRECT` move the pixels of a scrolled widget in the draw buffer
+ *  and redraw only the newly exposed areas instead of the whole widget.
+ *  Used only for widgets with a plain opaque background and no custom drawing.
+ *  See `lv_display_get_sync_stats()` for the moved bytes. */
+#ifndef LV_REFR_SCROLL_BLIT
+    #ifdef CONFIG_LV_REFR_SCROLL_BLIT
+        #define LV_REFR_SCROLL_BLIT CONFIG_LV_REFR_SCROLL_BLIT
+    #else
+        #define LV_REFR_SCROLL_BLIT 0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -2798,6 +2952,16 @@
     #endif
 #endif
 
+/** 1: Cache the measured size of the children and the result of each track of flex and grid containers.
+ *  If only the size of some children changed, only the affected tracks are recalculated. */
+#ifndef LV_LAYOUT_INCREMENTAL
+    #ifdef CONFIG_LV_LAYOUT_INCREMENTAL
+        #define LV_LAYOUT_INCREMENTAL CONFIG_LV_LAYOUT_INCREMENTAL
+    #else
+        #define LV_LAYOUT_INCREMENTAL 0
+    #endif
+#endif
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
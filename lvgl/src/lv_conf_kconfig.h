@@ -47,6 +47,8 @@ extern "C" {
 #  define CONFIG_LV_USE_STDLIB_MALLOC LV_STDLIB_MICROPYTHON
 #elif defined(CONFIG_LV_USE_RTTHREAD_MALLOC)
 #  define CONFIG_LV_USE_STDLIB_MALLOC LV_STDLIB_RTTHREAD
+#elif defined(CONFIG_LV_USE_POOL_MALLOC)
+#  define CONFIG_LV_USE_STDLIB_MALLOC LV_STDLIB_POOL
 #elif defined (CONFIG_LV_USE_CUSTOM_MALLOC)
 #  define CONFIG_LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM
 #endif
@@ -137,6 +139,10 @@ extern "C" {
 #  define CONFIG_LV_MEM_POOL_EXPAND_SIZE (CONFIG_LV_MEM_POOL_EXPAND_SIZE_KILOBYTES * 1024U)
 #endif
 
+#ifdef CONFIG_LV_MEM_SLAB_SIZE_KILOBYTES
+#  define CONFIG_LV_MEM_SLAB_SIZE (CONFIG_LV_MEM_SLAB_SIZE_KILOBYTES * 1024U)
+#endif
+
 /*------------------
  * MONITOR POSITION
  *-----------------*/
@@ -20,6 +20,7 @@
 #include "display/lv_display_private.h"
 #include "indev/lv_indev_private.h"
 #include "layouts/lv_layout_private.h"
+#include "core/lv_observer_private.h"
 #include "libs/bin_decoder/lv_bin_decoder.h"
 #include "libs/bmp/lv_bmp.h"
 #include "libs/ffmpeg/lv_ffmpeg.h"
@@ -148,11 +149,6 @@ static inline void lv_global_init(lv_global_t * global)
     void LV_LOG_PRINT_CB(lv_log_level_t, const char * txt);
     global->custom_log_print_cb = LV_LOG_PRINT_CB;
 #endif
-
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void lv_cleanup_devices(lv_global_t * global)
@@ -513,6 +509,10 @@ void lv_deinit(void)
 
     lv_layout_deinit();
 
+#if LV_USE_OBSERVER
+    lv_observer_deinit();
+#endif
+
     lv_timer_core_deinit();
 
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
@@ -0,0 +1,521 @@
+/**
+* @file lv_cache_2q.c
+*
+*/
+
+/***************************************************************************\
+*                                                                           *
+*  ┏ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ┓       *
+*                      2Q Cache (two segment LRU)                           *
+*  ┃                                                                ┃       *
+*         new entries                      hit in probation                 *
+*  ┃          │                          ┌ ─ ─ ─ ─ ─ ─ ─ ─ ─ ┐      ┃       *
+*             ▼                          │                   ▼              *
+*  ┃   ┌─────┬─────┬─────┬─────┐               ┌─────┬─────┬─────┐  ┃       *
+*      │  N  │  M  │  K  │  J  │  probation    │  B  │  E  │  A  │          *
+*  ┃   └─────┴─────┴─────┴──┬──┘               └─────┴─────┴──┬──┘  ┃       *
+*                 ▲         │                     protected   │             *
+*  ┃              └ ─ ─ ─ ─ ┼ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ─ ┘     ┃       *
+*                           ▼            demoted when the protected         *
+*  ┃                  victims first       segment is full               ┃   *
+*                                                                           *
+*  ┃  Entries used only once (e.g. while scrolling through a long   ┃       *
+*     list) never leave the probation segment, so they can't evict          *
+*  ┃  the entries used again and again from the protected segment.  ┃       *
+*  ┗ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ━ ┛       *
+*                                                                           *
+\***************************************************************************/
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_cache_2q.h"
+#include "../lv_cache_entry.h"
+#include "../../../stdlib/lv_sprintf.h"
+#include "../../../stdlib/lv_string.h"
+#include "../../lv_ll.h"
+#include "../../lv_rb_private.h"
+#include "../../lv_rb.h"
+#include "../../lv_iter.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The protected segment can use this percentage of the cache's max size*/
+#define PROTECTED_RATIO     75
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef uint32_t (get_data_size_cb_t)(const void * data);
+
+/*The node of both linked lists*/
+typedef struct {
+    lv_rb_node_t * rb_node;
+    bool is_protected;
+} queue_node_t;
+
+typedef struct {
+    lv_cache_t cache;
+
+    lv_rb_t rb;
+    lv_ll_t probation_ll;
+    lv_ll_t protected_ll;
+    uint32_t protected_size;
+
+    get_data_size_cb_t * get_data_size_cb;
+} lv_cache_2q_t;
+
+typedef struct {
+    queue_node_t * node;
+    bool in_probation;
+} iter_context_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void * alloc_cb(void);
+static bool init_cnt_cb(lv_cache_t * cache);
+static bool init_size_cb(lv_cache_t * cache);
+static void destroy_cb(lv_cache_t * cache, void * user_data);
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data);
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data);
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data);
+static void drop_all_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data);
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data);
+
+static bool init_common(lv_cache_2q_t * q);
+static queue_node_t * get_queue_node(lv_cache_2q_t * q, lv_rb_node_t * node);
+static void unlink_node(lv_cache_2q_t * q, lv_rb_node_t * node);
+static void promote(lv_cache_2q_t * q, queue_node_t * queue_node);
+static void drop_all_in_list(lv_cache_2q_t * q, lv_ll_t * ll, void * user_data, uint32_t * used_cnt);
+
+static uint32_t cnt_get_data_size_cb(const void * data);
+static uint32_t size_get_data_size_cb(const void * data);
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache);
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const lv_cache_class_t lv_cache_class_2q_count = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_cnt_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+
+const lv_cache_class_t lv_cache_class_2q_size = {
+    .alloc_cb = alloc_cb,
+    .init_cb = init_size_cb,
+    .destroy_cb = destroy_cb,
+
+    .get_cb = get_cb,
+    .add_cb = add_cb,
+    .remove_cb = remove_cb,
+    .drop_cb = drop_cb,
+    .drop_all_cb = drop_all_cb,
+    .get_victim_cb = get_victim_cb,
+    .reserve_cond_cb = reserve_cond_cb,
+    .iter_create_cb = cache_iter_create_cb,
+};
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * alloc_cb(void)
+{
+    void * res = lv_malloc(sizeof(lv_cache_2q_t));
+    LV_ASSERT_MALLOC(res);
+    if(res == NULL) {
+        LV_LOG_ERROR("malloc failed");
+        return NULL;
+    }
+
+    lv_memzero(res, sizeof(lv_cache_2q_t));
+    return res;
+}
+
+static bool init_cnt_cb(lv_cache_t * cache)
+{
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+    q->get_data_size_cb = cnt_get_data_size_cb;
+    return init_common(q);
+}
+
+static bool init_size_cb(lv_cache_t * cache)
+{
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+    q->get_data_size_cb = size_get_data_size_cb;
+    return init_common(q);
+}
+
+static bool init_common(lv_cache_2q_t * q)
+{
+    LV_ASSERT_NULL(q->cache.ops.compare_cb);
+    LV_ASSERT_NULL(q->cache.ops.free_cb);
+    LV_ASSERT(q->cache.node_size > 0);
+
+    if(q->cache.node_size <= 0 || q->cache.ops.compare_cb == NULL || q->cache.ops.free_cb == NULL) {
+        return false;
+    }
+
+    /*add void* to store the ll node pointer*/
+    if(!lv_rb_init(&q->rb, q->cache.ops.compare_cb, lv_cache_entry_get_size(q->cache.node_size) + sizeof(void *))) {
+        return false;
+    }
+    lv_ll_init(&q->probation_ll, sizeof(queue_node_t));
+    lv_ll_init(&q->protected_ll, sizeof(queue_node_t));
+
+    return true;
+}
+
+static void destroy_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+
+    if(cache == NULL) {
+        return;
+    }
+
+    cache->clz->drop_all_cb(cache, user_data);
+}
+
+static lv_cache_entry_t * get_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+    LV_ASSERT_NULL(key);
+
+    if(q == NULL || key == NULL) {
+        return NULL;
+    }
+
+    /*try the most recently used protected entry first*/
+    queue_node_t * head = lv_ll_get_head(&q->protected_ll);
+    if(head && cache->ops.compare_cb(head->rb_node->data, key) == 0) {
+        return lv_cache_entry_get_entry(head->rb_node->data, cache->node_size);
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&q->rb, key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    queue_node_t * queue_node = get_queue_node(q, node);
+    if(queue_node->is_protected) {
+        lv_ll_move_before(&q->protected_ll, queue_node, lv_ll_get_head(&q->protected_ll));
+    }
+    else {
+        promote(q, queue_node);
+    }
+
+    return lv_cache_entry_get_entry(node->data, cache->node_size);
+}
+
+static lv_cache_entry_t * add_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+    LV_ASSERT_NULL(key);
+
+    if(q == NULL || key == NULL) {
+        return NULL;
+    }
+
+    lv_rb_node_t * node = lv_rb_insert(&q->rb, (void *)key);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    void * data = node->data;
+    lv_memcpy(data, key, cache->node_size);
+
+    /*New entries are on probation until they are used again*/
+    queue_node_t * queue_node = lv_ll_ins_head(&q->probation_ll);
+    if(queue_node == NULL) {
+        lv_rb_drop_node(&q->rb, node);
+        return NULL;
+    }
+
+    queue_node->rb_node = node;
+    queue_node->is_protected = false;
+    lv_memcpy((uint8_t *)data + q->rb.size - sizeof(void *), &queue_node, sizeof(void *));
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+    lv_cache_entry_init(entry, cache, cache->node_size);
+
+    cache->size += q->get_data_size_cb(key);
+
+    return entry;
+}
+
+static void remove_cb(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+    LV_ASSERT_NULL(entry);
+
+    if(q == NULL || entry == NULL) {
+        return;
+    }
+
+    void * data = lv_cache_entry_get_data(entry);
+    lv_rb_node_t * node = lv_rb_find(&q->rb, data);
+    if(node == NULL) {
+        return;
+    }
+
+    unlink_node(q, node);
+    lv_rb_remove_node(&q->rb, node);
+}
+
+static void drop_cb(lv_cache_t * cache, const void * key, void * user_data)
+{
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+    LV_ASSERT_NULL(key);
+
+    if(q == NULL || key == NULL) {
+        return;
+    }
+
+    lv_rb_node_t * node = lv_rb_find(&q->rb, key);
+    if(node == NULL) {
+        return;
+    }
+
+    void * data = node->data;
+    cache->ops.free_cb(data, user_data);
+    unlink_node(q, node);
+
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, cache->node_size);
+    lv_rb_remove_node(&q->rb, node);
+    lv_cache_entry_delete(entry);
+}
+
+static void drop_all_cb(lv_cache_t * cache, void * user_data)
+{
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+
+    if(q == NULL) {
+        return;
+    }
+
+    uint32_t used_cnt = 0;
+    drop_all_in_list(q, &q->protected_ll, user_data, &used_cnt);
+    drop_all_in_list(q, &q->probation_ll, user_data, &used_cnt);
+    if(used_cnt > 0) {
+        LV_LOG_WARN("%" LV_PRId32 " entries are still referenced", used_cnt);
+    }
+
+    lv_rb_destroy(&q->rb);
+    lv_ll_clear(&q->protected_ll);
+    lv_ll_clear(&q->probation_ll);
+
+    cache->size = 0;
+    q->protected_size = 0;
+}
+
+static lv_cache_entry_t * get_victim_cb(lv_cache_t * cache, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+
+    /*Evict the entries on probation first, so the ones used many times stay longer*/
+    lv_ll_t * lists[] = {&q->probation_ll, &q->protected_ll};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        queue_node_t * tail;
+        LV_LL_READ_BACK(lists[i], tail) {
+            lv_cache_entry_t * entry = lv_cache_entry_get_entry(tail->rb_node->data, cache->node_size);
+            if(lv_cache_entry_get_ref(entry) == 0) {
+                return entry;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static lv_cache_reserve_cond_res_t reserve_cond_cb(lv_cache_t * cache, const void * key, size_t reserved_size,
+                                                   void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_cache_2q_t * q = (lv_cache_2q_t *)cache;
+
+    LV_ASSERT_NULL(q);
+
+    if(q == NULL) {
+        return LV_CACHE_RESERVE_COND_ERROR;
+    }
+
+    uint32_t data_size = key ? q->get_data_size_cb(key) : 0;
+    if(data_size > cache->max_size) {
+        LV_LOG_ERROR("data size (%" LV_PRIu32 ") is larger than max size (%" LV_PRIu32 ")", data_size, cache->max_size);
+        return LV_CACHE_RESERVE_COND_TOO_LARGE;
+    }
+
+    return cache->size + reserved_size + data_size > cache->max_size
+           ? LV_CACHE_RESERVE_COND_NEED_VICTIM
+           : LV_CACHE_RESERVE_COND_OK;
+}
+
+static queue_node_t * get_queue_node(lv_cache_2q_t * q, lv_rb_node_t * node)
+{
+    queue_node_t * queue_node;
+    lv_memcpy(&queue_node, (uint8_t *)node->data + q->rb.size - sizeof(void *), sizeof(void *));
+    return queue_node;
+}
+
+/**
+ * Remove the node from its list and update the sizes, but keep it in the tree
+ */
+static void unlink_node(lv_cache_2q_t * q, lv_rb_node_t * node)
+{
+    queue_node_t * queue_node = get_queue_node(q, node);
+    uint32_t data_size = q->get_data_size_cb(node->data);
+
+    if(queue_node->is_protected) {
+        q->protected_size -= data_size;
+        lv_ll_remove(&q->protected_ll, queue_node);
+    }
+    else {
+        lv_ll_remove(&q->probation_ll, queue_node);
+    }
+    lv_free(queue_node);
+
+    q->cache.size -= data_size;
+}
+
+/**
+ * Move an entry used again from the probation to the protected segment.
+ * The least recently used protected entries go back on probation to make room.
+ */
+static void promote(lv_cache_2q_t * q, queue_node_t * queue_node)
+{
+    uint32_t protected_max = (uint32_t)(((uint64_t)q->cache.max_size * PROTECTED_RATIO) / 100);
+    uint32_t data_size = q->get_data_size_cb(queue_node->rb_node->data);
+
+    /*Too large to be protected, keep it as the most recent entry on probation*/
+    if(data_size > protected_max) {
+        lv_ll_move_before(&q->probation_ll, queue_node, lv_ll_get_head(&q->probation_ll));
+        return;
+    }
+
+    lv_ll_chg_list(&q->probation_ll, &q->protected_ll, queue_node, true);
+    queue_node->is_protected = true;
+    q->protected_size += data_size;
+
+    while(q->protected_size > protected_max) {
+        queue_node_t * tail = lv_ll_get_tail(&q->protected_ll);
+        lv_ll_chg_list(&q->protected_ll, &q->probation_ll, tail, true);
+        tail->is_protected = false;
+        q->protected_size -= q->get_data_size_cb(tail->rb_node->data);
+    }
+}
+
+static void drop_all_in_list(lv_cache_2q_t * q, lv_ll_t * ll, void * user_data, uint32_t * used_cnt)
+{
+    queue_node_t * queue_node;
+    LV_LL_READ(ll, queue_node) {
+        /*free user handled data and do other clean up*/
+        void * search_key = queue_node->rb_node->data;
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(search_key, q->cache.node_size);
+        if(lv_cache_entry_get_ref(entry) == 0) {
+            q->cache.ops.free_cb(search_key, user_data);
+        }
+        else {
+            LV_LOG_WARN("entry (%p) is still referenced (%" LV_PRId32 ")", (void *)entry, lv_cache_entry_get_ref(entry));
+            (*used_cnt)++;
+        }
+    }
+}
+
+static uint32_t cnt_get_data_size_cb(const void * data)
+{
+    LV_UNUSED(data);
+    return 1;
+}
+
+static uint32_t size_get_data_size_cb(const void * data)
+{
+    lv_cache_slot_size_t * slot = (lv_cache_slot_size_t *)data;
+    return slot->size;
+}
+
+static lv_iter_t * cache_iter_create_cb(lv_cache_t * cache)
+{
+    return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(iter_context_t), cache_iter_next_cb);
+}
+
+static lv_result_t cache_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_cache_2q_t * q = (lv_cache_2q_t *)instance;
+    iter_context_t * ctx = context;
+
+    LV_ASSERT_NULL(ctx);
+
+    /*The protected entries first, then the ones on probation*/
+    if(ctx->node == NULL && !ctx->in_probation) {
+        ctx->node = lv_ll_get_head(&q->protected_ll);
+    }
+    else if(ctx->node) {
+        ctx->node = lv_ll_get_next(ctx->in_probation ? &q->probation_ll : &q->protected_ll, ctx->node);
+    }
+
+    if(ctx->node == NULL && !ctx->in_probation) {
+        ctx->in_probation = true;
+        ctx->node = lv_ll_get_head(&q->probation_ll);
+    }
+
+    if(ctx->node == NULL) return LV_RESULT_INVALID;
+
+    lv_memcpy(elem, ctx->node->rb_node->data, lv_cache_entry_get_size(q->cache.node_size));
+
+    return LV_RESULT_OK;
+}
@@ -34,6 +34,7 @@
 static lv_cache_compare_res_t image_cache_compare_cb(const lv_image_cache_data_t * lhs,
                                                      const lv_image_cache_data_t * rhs);
 static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data);
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key);
 static void iter_inspect_cb(void * elem);
 
 /**********************
@@ -58,12 +59,13 @@ lv_result_t lv_image_cache_init(uint32_t size)
         return LV_RESULT_OK;
     }
 
-    img_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    img_cache_p = lv_cache_create_sharded(&lv_cache_class_lru_rb_size,
     sizeof(lv_image_cache_data_t), size, (lv_cache_ops_t) {
         .compare_cb = (lv_cache_compare_cb_t) image_cache_compare_cb,
         .create_cb = NULL,
         .free_cb = (lv_cache_free_cb_t) image_cache_free_cb,
-    });
+        .hash_cb = (lv_cache_hash_cb_t) image_cache_hash_cb,
+    }, LV_IMAGE_CACHE_SHARD_CNT);
 
     lv_cache_set_name(img_cache_p, CACHE_NAME);
     return img_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
@@ -164,6 +166,25 @@ static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
     if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
 }
 
+static uint32_t image_cache_hash_cb(const lv_image_cache_data_t * key)
+{
+    /*Must be equal for the sources considered equal by `image_cache_common_compare()`*/
+    uint32_t hash = 2166136261u ^ (uint32_t)key->src_type;
+    if(key->src_type == LV_IMAGE_SRC_FILE) {
+        const uint8_t * c;
+        for(c = key->src; *c != '\0'; c++) {
+            hash = (hash ^ *c) * 16777619u;
+        }
+    }
+    else if(key->src_type == LV_IMAGE_SRC_VARIABLE) {
+        /*The lowest bits of the descriptors' address are usually the same, mix in the others too*/
+        lv_uintptr_t addr = (lv_uintptr_t)key->src;
+        hash = (hash ^ (uint32_t)(addr >> 4)) * 16777619u;
+        hash = (hash ^ (uint32_t)(addr >> 12)) * 16777619u;
+    }
+    return hash;
+}
+
 static void iter_inspect_cb(void * elem)
 {
     lv_image_cache_data_t * data = (lv_image_cache_data_t *)elem;
@@ -0,0 +1,408 @@
+/**
+* @file lv_image_disk_cache.c
+*
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../draw/lv_image_decoder_private.h"
+
+#if LV_USE_IMAGE_DISK_CACHE
+
+#include "lv_image_disk_cache.h"
+#include "../../../draw/lv_draw_buf_private.h"
+#include "../../../core/lv_global.h"
+#include "../../../stdlib/lv_string.h"
+#include "../../../stdlib/lv_sprintf.h"
+#include "../../../misc/lv_assert.h"
+#include "../../../misc/lv_fs.h"
+#include "../../../misc/lv_profiler.h"
+#include "../../../../lv_version.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define disk_cache_p (&LV_GLOBAL_DEFAULT()->img_disk_cache)
+#define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
+
+#if LV_USE_OS != LV_OS_NONE
+    #define img_decoder_open_lock_p &(LV_GLOBAL_DEFAULT()->img_decoder_open_lock)
+#else
+    #define img_decoder_open_lock_p NULL
+#endif
+
+#define FILE_EXT        "lvdc"
+#define FILE_MAGIC      0x4344564c  /*"LVDC"*/
+
+/*The file format and the LVGL version. Files written by an other version are ignored*/
+#define FILE_VERSION    ((1 << 24) | (LVGL_VERSION_MAJOR << 16) | (LVGL_VERSION_MINOR << 8) | LVGL_VERSION_PATCH)
+
+/*The pixels start here so that they stay aligned in a mapped file*/
+#define DATA_OFFSET     64
+
+#define HASH_INIT       0x811c9dc5
+#define READ_CHUNK_SIZE 1024
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t magic;             /*Written last, so a partially written file is never used*/
+    uint32_t version;
+    uint32_t key;
+    uint32_t data_size;
+    uint32_t data_hash;
+    lv_image_header_t header;   /*Header of the decoded draw buffer*/
+} file_header_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static uint32_t hash_data(uint32_t hash, const void * data, uint32_t size);
+static uint32_t hash_src(const lv_image_decoder_dsc_t * dsc);
+static void get_file_path(char * buf, uint32_t buf_size, uint32_t key);
+static uint32_t get_file_size(const char * path);
+static lv_draw_buf_t * load_file(lv_fs_file_t * f, const file_header_t * file_header);
+static void mmap_draw_buf_free_cb(void * buf);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const lv_draw_buf_handlers_t mmap_draw_buf_handlers = {
+    .buf_free_cb = mmap_draw_buf_free_cb,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_image_disk_cache_set_path(const char * path)
+{
+    lv_image_disk_cache_t * disk_cache = disk_cache_p;
+    lv_result_t res = LV_RESULT_OK;
+
+    lv_mutex_lock(img_decoder_open_lock_p);
+
+    lv_free(disk_cache->path);
+    disk_cache->path = NULL;
+    disk_cache->size = 0;
+
+    if(path) {
+        lv_fs_dir_t dir;
+        if(lv_fs_dir_open(&dir, path) != LV_FS_RES_OK) {
+            LV_LOG_WARN("Can't open %s", path);
+            res = LV_RESULT_INVALID;
+        }
+        else {
+            disk_cache->path = lv_strdup(path);
+            LV_ASSERT_MALLOC(disk_cache->path);
+
+            /*Count the size of the images stored earlier to respect the size limit*/
+            char fn[64];
+            char file_path[LV_FS_MAX_PATH_LENGTH];
+            while(lv_fs_dir_read(&dir, fn, sizeof(fn)) == LV_FS_RES_OK && fn[0] != '\0') {
+                const char * ext = lv_fs_get_ext(fn);
+                if(fn[0] == '/' || lv_strcmp(ext, FILE_EXT) != 0) continue;
+
+                lv_snprintf(file_path, sizeof(file_path), "%s/%s", path, fn);
+                disk_cache->size += get_file_size(file_path);
+            }
+            lv_fs_dir_close(&dir);
+        }
+    }
+
+    lv_mutex_unlock(img_decoder_open_lock_p);
+    return res;
+}
+
+void lv_image_disk_cache_get_stats(lv_image_disk_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    lv_image_disk_cache_t * disk_cache = disk_cache_p;
+
+    stats->size = disk_cache->size;
+    stats->hit_cnt = disk_cache->hit_cnt;
+    stats->store_cnt = disk_cache->store_cnt;
+}
+
+lv_result_t lv_image_disk_cache_load(lv_image_decoder_dsc_t * dsc, uint32_t * key)
+{
+    *key = 0;
+
+    lv_image_disk_cache_t * disk_cache = disk_cache_p;
+    if(disk_cache->path == NULL) return LV_RESULT_INVALID;
+
+    /*Images in LVGL's own format don't need to be decoded.
+     *The name is part of the key, so images of unnamed decoders are not stored.*/
+    const char * name = dsc->decoder->name;
+    if(name == NULL || lv_strcmp(name, "BIN") == 0) return LV_RESULT_INVALID;
+
+    LV_PROFILER_DECODER_BEGIN;
+    *key = hash_src(dsc);
+    if(*key == 0) {
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_INVALID;
+    }
+
+    char file_path[LV_FS_MAX_PATH_LENGTH];
+    get_file_path(file_path, sizeof(file_path), *key);
+
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, file_path, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_INVALID;
+    }
+
+    file_header_t file_header;
+    uint32_t br = 0;
+    lv_fs_res_t fs_res = lv_fs_read(&f, &file_header, sizeof(file_header), &br);
+    lv_draw_buf_t * decoded = NULL;
+    if(fs_res == LV_FS_RES_OK && br == sizeof(file_header)
+       && file_header.magic == FILE_MAGIC
+       && file_header.version == FILE_VERSION
+       && file_header.key == *key) {
+        decoded = load_file(&f, &file_header);
+    }
+    lv_fs_close(&f);
+
+    if(decoded == NULL) {
+        LV_LOG_WARN("Ignoring invalid file %s", file_path);
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_INVALID;
+    }
+
+    lv_image_cache_data_t search_key;
+    search_key.src_type = dsc->src_type;
+    search_key.src = dsc->src;
+    search_key.slot.size = decoded->data_size;
+
+    lv_cache_entry_t * entry = lv_image_decoder_add_to_cache(dsc->decoder, &search_key, decoded, NULL);
+    if(entry == NULL) {
+        lv_draw_buf_destroy(decoded);
+        LV_PROFILER_DECODER_END;
+        return LV_RESULT_INVALID;
+    }
+
+    dsc->decoded = decoded;
+    dsc->cache_entry = entry;
+    disk_cache->hit_cnt++;
+
+    LV_PROFILER_DECODER_END;
+    return LV_RESULT_OK;
+}
+
+void lv_image_disk_cache_store(lv_image_decoder_dsc_t * dsc, uint32_t key)
+{
+    lv_image_disk_cache_t * disk_cache = disk_cache_p;
+
+    /*Only images kept in the image cache are stored, others might be decoded differently, e.g. by area*/
+    const lv_draw_buf_t * decoded = dsc->decoded;
+    if(disk_cache->path == NULL || dsc->cache_entry == NULL || decoded == NULL) return;
+
+    LV_PROFILER_DECODER_BEGIN;
+    char file_path[LV_FS_MAX_PATH_LENGTH];
+    get_file_path(file_path, sizeof(file_path), key);
+
+    /*An invalid file with the same name is overwritten*/
+    uint32_t old_size = get_file_size(file_path);
+    uint32_t new_size = DATA_OFFSET + decoded->data_size;
+    if(disk_cache->size - old_size + new_size > LV_IMAGE_DISK_CACHE_MAX_SIZE) {
+        LV_LOG_INFO("No room for %s", file_path);
+        LV_PROFILER_DECODER_END;
+        return;
+    }
+
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, file_path, LV_FS_MODE_WR) != LV_FS_RES_OK) {
+        LV_LOG_WARN("Can't create %s", file_path);
+        LV_PROFILER_DECODER_END;
+        return;
+    }
+
+    uint8_t buf[DATA_OFFSET];
+    lv_memzero(buf, sizeof(buf));
+    file_header_t * file_header = (file_header_t *)buf;
+    file_header->version = FILE_VERSION;
+    file_header->key = key;
+    file_header->data_size = decoded->data_size;
+    file_header->data_hash = hash_data(HASH_INIT, decoded->data, decoded->data_size);
+    file_header->header = decoded->header;
+
+    uint32_t bw = 0;
+    lv_fs_res_t res = lv_fs_write(&f, buf, DATA_OFFSET, &bw);
+    if(res == LV_FS_RES_OK && bw == DATA_OFFSET) res = lv_fs_write(&f, decoded->data, decoded->data_size, &bw);
+    if(res == LV_FS_RES_OK && bw == decoded->data_size) res = lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+    if(res == LV_FS_RES_OK) {
+        uint32_t magic = FILE_MAGIC;
+        res = lv_fs_write(&f, &magic, sizeof(magic), &bw);
+        if(res == LV_FS_RES_OK && bw == sizeof(magic)) disk_cache->store_cnt++;
+    }
+    lv_fs_close(&f);
+
+    disk_cache->size = disk_cache->size - old_size + new_size;
+    LV_PROFILER_DECODER_END;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * FNV-1a hash
+ */
+static uint32_t hash_data(uint32_t hash, const void * data, uint32_t size)
+{
+    const uint8_t * p = data;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        hash ^= p[i];
+        hash *= 16777619;
+    }
+    return hash;
+}
+
+/**
+ * Hash everything the decoded image depends on: the source's path and content,
+ * the decoder and the way the image is decoded.
+ * @return      the hash, or 0 if the source can't be read
+ */
+static uint32_t hash_src(const lv_image_decoder_dsc_t * dsc)
+{
+    uint32_t hash = HASH_INIT;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        const char * path = dsc->src;
+        hash = hash_data(hash, path, lv_strlen(path));
+
+        lv_fs_file_t f;
+        if(lv_fs_open(&f, path, LV_FS_MODE_RD) != LV_FS_RES_OK) return 0;
+
+        uint8_t buf[READ_CHUNK_SIZE];
+        uint32_t br = 0;
+        lv_fs_res_t res;
+        do {
+            res = lv_fs_read(&f, buf, sizeof(buf), &br);
+            hash = hash_data(hash, buf, br);
+        } while(res == LV_FS_RES_OK && br == sizeof(buf));
+        lv_fs_close(&f);
+
+        if(res != LV_FS_RES_OK) return 0;
+    }
+    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t * img_dsc = dsc->src;
+        if(img_dsc->data == NULL || img_dsc->data_size == 0) return 0;
+        hash = hash_data(hash, &img_dsc->header, sizeof(img_dsc->header));
+        hash = hash_data(hash, img_dsc->data, img_dsc->data_size);
+    }
+    else {
+        return 0;
+    }
+
+    hash = hash_data(hash, dsc->decoder->name, lv_strlen(dsc->decoder->name));
+
+    const uint32_t params[] = {
+        dsc->args.stride_align,
+        dsc->args.premultiply,
+        dsc->args.use_indexed,
+        LV_DRAW_BUF_STRIDE_ALIGN,
+        LV_DRAW_BUF_ALIGN,
+        LV_COLOR_DEPTH,
+    };
+    hash = hash_data(hash, params, sizeof(params));
+
+    return hash != 0 ? hash : 1;
+}
+
+static void get_file_path(char * buf, uint32_t buf_size, uint32_t key)
+{
+    lv_snprintf(buf, buf_size, "%s/%08" LV_PRIx32 "." FILE_EXT, disk_cache_p->path, key);
+}
+
+static uint32_t get_file_size(const char * path)
+{
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, path, LV_FS_MODE_RD) != LV_FS_RES_OK) return 0;
+
+    uint32_t size = 0;
+    if(lv_fs_get_size(&f, &size) != LV_FS_RES_OK) size = 0;
+    lv_fs_close(&f);
+    return size;
+}
+
+/**
+ * Create a draw buffer from a stored image. The file is mapped if the driver supports it,
+ * else it's read to a new draw buffer.
+ * @return      the draw buffer or NULL if the file is invalid
+ */
+static lv_draw_buf_t * load_file(lv_fs_file_t * f, const file_header_t * file_header)
+{
+    const lv_image_header_t * header = &file_header->header;
+    uint32_t data_size = file_header->data_size;
+    if(header->w == 0 || header->h == 0 || header->stride == 0
+       || data_size < (uint32_t)header->stride * header->h) return NULL;
+
+    uint32_t flags = header->flags & ~(LV_IMAGE_FLAGS_ALLOCATED | LV_IMAGE_FLAGS_MODIFIABLE);
+    lv_draw_buf_t * decoded = NULL;
+
+    uint32_t map_size;
+    const uint8_t * map = lv_fs_mmap(f, &map_size);
+    if(map) {
+        uint8_t * data = (uint8_t *)map + DATA_OFFSET;
+        if(map_size >= DATA_OFFSET + data_size && lv_draw_buf_align(data, header->cf) == data) {
+            decoded = lv_malloc(sizeof(lv_draw_buf_t));
+            LV_ASSERT_MALLOC(decoded);
+        }
+
+        if(decoded == NULL ||
+           lv_draw_buf_init(decoded, header->w, header->h, header->cf, header->stride, data, data_size) != LV_RESULT_OK) {
+            lv_free(decoded);
+            decoded = NULL;
+            lv_fs_munmap(map);
+        }
+        else {
+            decoded->unaligned_data = (void *)map;
+            decoded->handlers = &mmap_draw_buf_handlers;
+            decoded->header.flags = flags | LV_IMAGE_FLAGS_ALLOCATED;
+        }
+    }
+
+    if(decoded == NULL) {
+        decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, header->w, header->h, header->cf, header->stride);
+        if(decoded == NULL) return NULL;
+
+        uint32_t br = 0;
+        if(decoded->data_size < data_size
+           || lv_fs_seek(f, DATA_OFFSET, LV_FS_SEEK_SET) != LV_FS_RES_OK
+           || lv_fs_read(f, decoded->data, data_size, &br) != LV_FS_RES_OK
+           || br != data_size) {
+            lv_draw_buf_destroy(decoded);
+            return NULL;
+        }
+
+        decoded->data_size = data_size;
+        decoded->header.flags = flags | LV_IMAGE_FLAGS_ALLOCATED | LV_IMAGE_FLAGS_MODIFIABLE;
+    }
+
+    if(hash_data(HASH_INIT, decoded->data, data_size) != file_header->data_hash) {
+        lv_draw_buf_destroy(decoded);
+        return NULL;
+    }
+
+    return decoded;
+}
+
+static void mmap_draw_buf_free_cb(void * buf)
+{
+    lv_fs_munmap(buf);
+}
+
+#endif /*LV_USE_IMAGE_DISK_CACHE*/
@@ -0,0 +1,70 @@
+/**
+* @file lv_image_disk_cache.h
+*
+ */
+
+#ifndef LV_IMAGE_DISK_CACHE_H
+#define LV_IMAGE_DISK_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_types.h"
+
+#if LV_USE_IMAGE_DISK_CACHE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t size;          /**< Total size of the stored images in bytes*/
+    uint32_t hit_cnt;       /**< Number of images loaded from the disk instead of decoding them*/
+    uint32_t store_cnt;     /**< Number of decoded images written to the disk*/
+} lv_image_disk_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Set the directory where the decoded images of image files are stored.
+ * Later (e.g. after a reboot) they are loaded from here instead of decoding them again.
+ * The images are stored in the format they are drawn, after stride adjustment and premultiplication,
+ * and they are used directly from the file if the file system driver supports mapping.
+ * @param path  path to an existing directory with a drive letter, e.g. "A:/var/cache/lvgl",
+ *              or NULL to disable the disk cache
+ * @return      LV_RESULT_OK: the directory is used; LV_RESULT_INVALID: the directory can't be opened
+ */
+lv_result_t lv_image_disk_cache_set_path(const char * path);
+
+/**
+ * Get the statistics of the disk cache.
+ * @param stats     store the statistics here
+ */
+void lv_image_disk_cache_get_stats(lv_image_disk_cache_stats_t * stats);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMAGE_DISK_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_DISK_CACHE_H*/
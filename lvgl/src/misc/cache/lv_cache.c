@@ -12,6 +12,8 @@
 #include "lv_cache_entry_private.h"
 #include "lv_cache_private.h"
 #include "../lv_profiler.h"
+#include "../lv_iter.h"
+#include "../../stdlib/lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -21,12 +23,21 @@
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t shard_idx;
+    uint32_t pos;
+} shard_iter_context_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void cache_drop_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
 static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_data);
 static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const void * key, void * user_data);
+static void cache_lock(lv_cache_t * cache);
+static void cache_unlock(lv_cache_t * cache);
+static lv_cache_t * shard_of_key(lv_cache_t * cache, const void * key);
+static lv_result_t shard_iter_next_cb(void * instance, void * context, void * elem);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -56,6 +67,14 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     cache->max_size = max_size;
     cache->size = 0;
     cache->ops = ops;
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
+    cache->evict_cnt = 0;
+    cache->lock_cnt = 0;
+    cache->lock_contended_cnt = 0;
+    cache->shards = NULL;
+    cache->shard_cnt = 0;
+    cache->evict_shard = 0;
 
     if(cache->clz->init_cb(cache) == false) {
         LV_LOG_ERROR("Cache init failed");
@@ -68,10 +87,63 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
     return cache;
 }
 
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size,
+                                     lv_cache_ops_t ops, uint32_t shard_cnt)
+{
+    if(shard_cnt <= 1 || ops.hash_cb == NULL) {
+        return lv_cache_create(cache_class, node_size, max_size, ops);
+    }
+
+    lv_cache_t * cache = lv_malloc_zeroed(sizeof(lv_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) return NULL;
+
+    cache->shards = lv_malloc_zeroed(shard_cnt * sizeof(lv_cache_t *));
+    LV_ASSERT_MALLOC(cache->shards);
+    if(cache->shards == NULL) {
+        lv_free(cache);
+        return NULL;
+    }
+
+    cache->clz = cache_class;
+    cache->node_size = node_size;
+    cache->max_size = max_size;
+    cache->ops = ops;
+    cache->shard_cnt = shard_cnt;
+
+    /*The parent cache doesn't store entries, its lock protects only `evict_shard`*/
+    lv_mutex_init(&cache->lock);
+
+    uint32_t i;
+    for(i = 0; i < shard_cnt; i++) {
+        size_t shard_max_size = max_size / shard_cnt + (i < max_size % shard_cnt ? 1 : 0);
+        cache->shards[i] = lv_cache_create(cache_class, node_size, shard_max_size, ops);
+        if(cache->shards[i] == NULL) {
+            cache->shard_cnt = i;
+            lv_cache_destroy(cache, NULL);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
 void lv_cache_destroy(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_destroy(cache->shards[i], user_data);
+        }
+        lv_free(cache->shards);
+        lv_mutex_delete(&cache->lock);
+        lv_free(cache);
+        return;
+    }
+
     lv_mutex_lock(&cache->lock);
     cache->clz->destroy_cb(cache, user_data);
     lv_mutex_unlock(&cache->lock);
@@ -84,12 +156,15 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) return lv_cache_acquire(shard_of_key(cache, key), key, user_data);
+
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    cache_lock(cache);
 
     if(cache->size == 0) {
-        lv_mutex_unlock(&cache->lock);
+        cache->miss_cnt++;
+        cache_unlock(cache);
 
         LV_PROFILER_CACHE_END;
         return NULL;
@@ -98,8 +173,12 @@ lv_cache_entry_t * lv_cache_acquire(lv_cache_t * cache, const void * key, void *
     lv_cache_entry_t * entry = cache->clz->get_cb(cache, key, user_data);
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
+        cache->hit_cnt++;
     }
-    lv_mutex_unlock(&cache->lock);
+    else {
+        cache->miss_cnt++;
+    }
+    cache_unlock(cache);
 
     LV_PROFILER_CACHE_END;
     return entry;
@@ -108,16 +187,19 @@ void lv_cache_release(lv_cache_t * cache, lv_cache_entry_t * entry, void * user_
 {
     LV_ASSERT_NULL(entry);
 
+    /*Lock only the shard owning the entry*/
+    if(cache->shards) cache = (lv_cache_t *)lv_cache_entry_get_cache(entry);
+
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    cache_lock(cache);
     lv_cache_entry_release_data(entry, user_data);
 
     if(lv_cache_entry_get_ref(entry) == 0 && lv_cache_entry_is_invalid(entry)) {
         cache->ops.free_cb(lv_cache_entry_get_data(entry), user_data);
         lv_cache_entry_delete(entry);
     }
-    lv_mutex_unlock(&cache->lock);
+    cache_unlock(cache);
 
     LV_PROFILER_CACHE_END;
 }
@@ -126,11 +208,13 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) return lv_cache_add(shard_of_key(cache, key), key, user_data);
+
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    cache_lock(cache);
     if(cache->max_size == 0) {
-        lv_mutex_unlock(&cache->lock);
+        cache_unlock(cache);
 
         LV_PROFILER_CACHE_END;
         return NULL;
@@ -140,7 +224,7 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
     if(entry != NULL) {
         lv_cache_entry_acquire_data(entry);
     }
-    lv_mutex_unlock(&cache->lock);
+    cache_unlock(cache);
 
     LV_PROFILER_CACHE_END;
     return entry;
@@ -150,24 +234,29 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) return lv_cache_acquire_or_create(shard_of_key(cache, key), key, user_data);
+
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    cache_lock(cache);
     lv_cache_entry_t * entry = NULL;
 
     if(cache->size != 0) {
         entry = cache->clz->get_cb(cache, key, user_data);
         if(entry != NULL) {
             lv_cache_entry_acquire_data(entry);
-            lv_mutex_unlock(&cache->lock);
+            cache->hit_cnt++;
+            cache_unlock(cache);
 
             LV_PROFILER_CACHE_END;
             return entry;
         }
     }
 
+    cache->miss_cnt++;
+
     if(cache->max_size == 0) {
-        lv_mutex_unlock(&cache->lock);
+        cache_unlock(cache);
 
         LV_PROFILER_CACHE_END;
         return NULL;
@@ -175,7 +264,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
 
     entry = cache_add_internal_no_lock(cache, key, user_data);
     if(entry == NULL) {
-        lv_mutex_unlock(&cache->lock);
+        cache_unlock(cache);
 
         LV_PROFILER_CACHE_END;
         return NULL;
@@ -190,7 +279,7 @@ lv_cache_entry_t * lv_cache_acquire_or_create(lv_cache_t * cache, const void * k
     else {
         lv_cache_entry_acquire_data(entry);
     }
-    lv_mutex_unlock(&cache->lock);
+    cache_unlock(cache);
 
     LV_PROFILER_CACHE_END;
     return entry;
@@ -199,6 +288,14 @@ void lv_cache_reserve(lv_cache_t * cache, uint32_t reserved_size, void * user_da
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_reserve(cache->shards[i], reserved_size / cache->shard_cnt, user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
     for(lv_cache_reserve_cond_res_t reserve_cond_res = cache->clz->reserve_cond_cb(cache, NULL, reserved_size, user_data);
@@ -213,11 +310,16 @@ void lv_cache_drop(lv_cache_t * cache, const void * key, void * user_data)
     LV_ASSERT_NULL(cache);
     LV_ASSERT_NULL(key);
 
+    if(cache->shards) {
+        lv_cache_drop(shard_of_key(cache, key), key, user_data);
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    cache_lock(cache);
     cache_drop_internal_no_lock(cache, key, user_data);
-    lv_mutex_unlock(&cache->lock);
+    cache_unlock(cache);
 
     LV_PROFILER_CACHE_END;
 }
@@ -225,11 +327,26 @@ bool lv_cache_evict_one(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        /*Take the victims from the shards in turns to keep them balanced*/
+        lv_mutex_lock(&cache->lock);
+        uint32_t first = cache->evict_shard;
+        cache->evict_shard = (cache->evict_shard + 1) % cache->shard_cnt;
+        lv_mutex_unlock(&cache->lock);
+
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_t * shard = cache->shards[(first + i) % cache->shard_cnt];
+            if(lv_cache_get_size(shard, user_data) > 0 && lv_cache_evict_one(shard, user_data)) return true;
+        }
+        return false;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    cache_lock(cache);
     bool res = cache_evict_one_internal_no_lock(cache, user_data);
-    lv_mutex_unlock(&cache->lock);
+    cache_unlock(cache);
 
     LV_PROFILER_CACHE_END;
     return res;
@@ -238,11 +355,19 @@ void lv_cache_drop_all(lv_cache_t * cache, void * user_data)
 {
     LV_ASSERT_NULL(cache);
 
+    if(cache->shards) {
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_drop_all(cache->shards[i], user_data);
+        }
+        return;
+    }
+
     LV_PROFILER_CACHE_BEGIN;
 
-    lv_mutex_lock(&cache->lock);
+    cache_lock(cache);
     cache->clz->drop_all_cb(cache, user_data);
-    lv_mutex_unlock(&cache->lock);
+    cache_unlock(cache);
 
     LV_PROFILER_CACHE_END;
 }
@@ -251,6 +376,12 @@ void lv_cache_set_max_size(lv_cache_t * cache, size_t max_size, void * user_data
 {
     LV_UNUSED(user_data);
     cache->max_size = max_size;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        size_t shard_max_size = max_size / cache->shard_cnt + (i < max_size % cache->shard_cnt ? 1 : 0);
+        lv_cache_set_max_size(cache->shards[i], shard_max_size, user_data);
+    }
 }
 size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 {
@@ -260,12 +391,18 @@ size_t lv_cache_get_max_size(lv_cache_t * cache, void * user_data)
 size_t lv_cache_get_size(lv_cache_t * cache, void * user_data)
 {
     LV_UNUSED(user_data);
-    return cache->size;
+    if(cache->shards == NULL) return cache->size;
+
+    size_t size = 0;
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        size += cache->shards[i]->size;
+    }
+    return size;
 }
 size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data)
 {
-    LV_UNUSED(user_data);
-    return cache->max_size - cache->size;
+    return cache->max_size - lv_cache_get_size(cache, user_data);
 }
 bool lv_cache_is_enabled(lv_cache_t * cache)
 {
@@ -275,21 +412,41 @@ void lv_cache_set_compare_cb(lv_cache_t * cache, lv_cache_compare_cb_t compare_c
 {
     LV_UNUSED(user_data);
     cache->ops.compare_cb = compare_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_compare_cb(cache->shards[i], compare_cb, user_data);
+    }
 }
 void lv_cache_set_create_cb(lv_cache_t * cache, lv_cache_create_cb_t alloc_cb, void * user_data)
 {
     LV_UNUSED(user_data);
     cache->ops.create_cb = alloc_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_create_cb(cache->shards[i], alloc_cb, user_data);
+    }
 }
 void lv_cache_set_free_cb(lv_cache_t * cache, lv_cache_free_cb_t free_cb, void * user_data)
 {
     LV_UNUSED(user_data);
     cache->ops.free_cb = free_cb;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_free_cb(cache->shards[i], free_cb, user_data);
+    }
 }
 void lv_cache_set_name(lv_cache_t * cache, const char * name)
 {
     if(cache == NULL) return;
     cache->name = name;
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_set_name(cache->shards[i], name);
+    }
 }
 const char * lv_cache_get_name(lv_cache_t * cache)
 {
@@ -300,9 +457,61 @@ lv_iter_t * lv_cache_iter_create(lv_cache_t * cache)
 {
     LV_ASSERT_NULL(cache);
     if(cache == NULL || cache->clz->iter_create_cb == NULL) return NULL;
+    if(cache->shards) {
+        return lv_iter_create(cache, lv_cache_entry_get_size(cache->node_size), sizeof(shard_iter_context_t),
+                              shard_iter_next_cb);
+    }
     return cache->clz->iter_create_cb(cache);
 }
 
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(stats);
+
+    if(cache->shards) {
+        lv_memzero(stats, sizeof(lv_cache_stats_t));
+        uint32_t i;
+        for(i = 0; i < cache->shard_cnt; i++) {
+            lv_cache_stats_t shard_stats;
+            lv_cache_get_stats(cache->shards[i], &shard_stats);
+            stats->hit_cnt += shard_stats.hit_cnt;
+            stats->miss_cnt += shard_stats.miss_cnt;
+            stats->evict_cnt += shard_stats.evict_cnt;
+            stats->lock_cnt += shard_stats.lock_cnt;
+            stats->lock_contended_cnt += shard_stats.lock_contended_cnt;
+        }
+        return;
+    }
+
+    /*Not `cache_lock()` to not count the lock taken only for the statistics*/
+    lv_mutex_lock(&cache->lock);
+    stats->hit_cnt = cache->hit_cnt;
+    stats->miss_cnt = cache->miss_cnt;
+    stats->evict_cnt = cache->evict_cnt;
+    stats->lock_cnt = cache->lock_cnt;
+    stats->lock_contended_cnt = cache->lock_contended_cnt;
+    lv_mutex_unlock(&cache->lock);
+}
+
+void lv_cache_reset_stats(lv_cache_t * cache)
+{
+    LV_ASSERT_NULL(cache);
+
+    uint32_t i;
+    for(i = 0; i < cache->shard_cnt; i++) {
+        lv_cache_reset_stats(cache->shards[i]);
+    }
+
+    lv_mutex_lock(&cache->lock);
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
+    cache->evict_cnt = 0;
+    cache->lock_cnt = 0;
+    cache->lock_contended_cnt = 0;
+    lv_mutex_unlock(&cache->lock);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -337,6 +546,7 @@ static bool cache_evict_one_internal_no_lock(lv_cache_t * cache, void * user_dat
     cache->clz->remove_cb(cache, victim, user_data);
     cache->ops.free_cb(lv_cache_entry_get_data(victim), user_data);
     lv_cache_entry_delete(victim);
+    cache->evict_cnt++;
     return true;
 }
 
@@ -357,3 +567,57 @@ static lv_cache_entry_t * cache_add_internal_no_lock(lv_cache_t * cache, const v
 
     return entry;
 }
+
+static void cache_lock(lv_cache_t * cache)
+{
+    if(lv_mutex_trylock(&cache->lock) != LV_RESULT_OK) {
+        LV_PROFILER_CACHE_BEGIN_TAG("lock_wait");
+        lv_mutex_lock(&cache->lock);
+        LV_PROFILER_CACHE_END_TAG("lock_wait");
+        cache->lock_contended_cnt++;
+    }
+
+    cache->lock_cnt++;
+    LV_PROFILER_CACHE_BEGIN_TAG("lock_hold");
+}
+
+static void cache_unlock(lv_cache_t * cache)
+{
+    LV_PROFILER_CACHE_END_TAG("lock_hold");
+    lv_mutex_unlock(&cache->lock);
+}
+
+static lv_cache_t * shard_of_key(lv_cache_t * cache, const void * key)
+{
+    return cache->shards[cache->ops.hash_cb(key) % cache->shard_cnt];
+}
+
+static lv_result_t shard_iter_next_cb(void * instance, void * context, void * elem)
+{
+    lv_cache_t * cache = instance;
+    shard_iter_context_t * ctx = context;
+
+    /*The shards' iterators can't be kept between the calls as they would leak if the iteration is stopped early,
+     *so continue from the saved position. It's slow, but iterating is used only for debugging.*/
+    while(ctx->shard_idx < cache->shard_cnt) {
+        lv_iter_t * iter = lv_cache_iter_create(cache->shards[ctx->shard_idx]);
+        if(iter == NULL) return LV_RESULT_INVALID;
+
+        lv_result_t res = LV_RESULT_OK;
+        uint32_t i;
+        for(i = 0; i <= ctx->pos && res == LV_RESULT_OK; i++) {
+            res = lv_iter_next(iter, elem);
+        }
+        lv_iter_destroy(iter);
+
+        if(res == LV_RESULT_OK) {
+            ctx->pos++;
+            return LV_RESULT_OK;
+        }
+
+        ctx->shard_idx++;
+        ctx->pos = 0;
+    }
+
+    return LV_RESULT_INVALID;
+}
@@ -29,6 +29,14 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of entries found by `lv_cache_acquire()` and `lv_cache_acquire_or_create()` */
+    uint32_t miss_cnt;      /**< Number of entries not found by them */
+    uint32_t evict_cnt;     /**< Number of entries evicted to make room for new ones */
+    uint32_t lock_cnt;      /**< Number of times the cache's lock was taken */
+    uint32_t lock_contended_cnt; /**< Number of times the lock was held by an other thread and had to be waited for */
+} lv_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -38,6 +46,8 @@ extern "C" {
  * @param cache_class   The class of the cache. Currently only support one two builtin classes:
  *                        - lv_cache_class_lru_rb_count for LRU-based cache with count-based eviction policy.
  *                        - lv_cache_class_lru_rb_size for LRU-based cache with size-based eviction policy.
+ *                        - lv_cache_class_2q_count and lv_cache_class_2q_size for the same policies,
+ *                          but entries used only once are evicted before the ones used repeatedly.
  * @param node_size     The node size is the size of the data stored in the cache..
  * @param max_size      The max size is the maximum amount of memory or count that the cache can hold.
  *                        - lv_cache_class_lru_rb_count: max_size is the maximum count of nodes in the cache.
@@ -49,6 +59,22 @@ lv_cache_t * lv_cache_create(const lv_cache_class_t * cache_class,
                              size_t node_size, size_t max_size,
                              lv_cache_ops_t ops);
 
+/**
+ * Create a cache whose keys are partitioned by `ops.hash_cb` among `shard_cnt` independent caches.
+ * Each shard has its own lock, so threads using keys of different shards don't wait for each other.
+ * Each shard can hold `max_size / shard_cnt`, therefore an entry larger than that can't be cached.
+ * The returned cache can be used with all `lv_cache_...` functions like a normal cache.
+ * @param cache_class   The class of the shards. See `lv_cache_create()`.
+ * @param node_size     The node size is the size of the data stored in the cache.
+ * @param max_size      The maximum size of all shards together.
+ * @param ops           A set of operations that can be performed on the cache. `hash_cb` is required.
+ * @param shard_cnt     Number of shards. If 1 or `hash_cb` is `NULL` a normal cache is created.
+ * @return              Returns a pointer to the created cache object on success, `NULL` on error.
+ */
+lv_cache_t * lv_cache_create_sharded(const lv_cache_class_t * cache_class,
+                                     size_t node_size, size_t max_size,
+                                     lv_cache_ops_t ops, uint32_t shard_cnt);
+
 /**
  * Destroy a cache object.
  * @param cache         The cache object pointer to destroy.
@@ -91,6 +117,7 @@ lv_cache_entry_t * lv_cache_add(lv_cache_t * cache, const void * key, void * use
 /**
  * Release a cache entry. The `lv_cache_entry_t::ref_cnt` will be decremented. If the `lv_cache_entry_t::ref_cnt` is zero, it will issue an error.
  * If the entry passed to this function is the last reference to the data and the entry is marked as invalid, the cache's policy will be used to evict the entry.
+ * In sharded caches only the lock of the shard owning the entry is taken.
  * @param cache         The cache object pointer to release the entry.
  * @param entry         The cache entry pointer to release.
  * @param user_data     A user data pointer that will be passed to the free callback.
@@ -222,6 +249,19 @@ const char * lv_cache_get_name(lv_cache_t * cache);
  */
 lv_iter_t * lv_cache_iter_create(lv_cache_t * cache);
 
+/**
+ * Get the hit, miss, eviction and lock counters of the cache. In sharded caches they are summed up for all shards.
+ * @param cache         The cache object pointer to get the statistics from.
+ * @param stats         Store the statistics here.
+ */
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss and eviction counters of the cache.
+ * @param cache         The cache object pointer to reset the statistics of.
+ */
+void lv_cache_reset_stats(lv_cache_t * cache);
+
 /*************************
  *    GLOBAL VARIABLES
  *************************/
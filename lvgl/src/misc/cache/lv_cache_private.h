@@ -46,6 +46,7 @@ typedef int32_t lv_cache_compare_res_t;
 typedef bool (*lv_cache_create_cb_t)(void * node, void * user_data);
 typedef void (*lv_cache_free_cb_t)(void * node, void * user_data);
 typedef lv_cache_compare_res_t (*lv_cache_compare_cb_t)(const void * a, const void * b);
+typedef uint32_t (*lv_cache_hash_cb_t)(const void * key);
 
 /**
  * The cache instance allocation function, used by the cache class to allocate memory for cache instances.
@@ -118,6 +119,8 @@ struct _lv_cache_ops_t {
     lv_cache_compare_cb_t compare_cb;    /**< Compare function for keys */
     lv_cache_create_cb_t create_cb;      /**< Create function for nodes */
     lv_cache_free_cb_t free_cb;          /**< Free function for nodes */
+    lv_cache_hash_cb_t hash_cb;          /**< Hash function for keys, used only to select the shard of sharded caches.
+                                          *   Keys which are equal by `compare_cb` must have the same hash. */
 };
 
 /**
@@ -136,6 +139,15 @@ struct _lv_cache_t {
     lv_cache_ops_t ops;               /**< Cache operations struct _lv_cache_ops_t */
 
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
+    uint32_t hit_cnt;                 /**< Number of entries found by `lv_cache_acquire()` and `lv_cache_acquire_or_create()` */
+    uint32_t miss_cnt;                /**< Number of entries not found by them */
+    uint32_t evict_cnt;               /**< Number of entries evicted to make room for new ones */
+    uint32_t lock_cnt;                /**< Number of times the lock was taken */
+    uint32_t lock_contended_cnt;      /**< Number of times the lock was held by an other thread and had to be waited for */
+
+    lv_cache_t ** shards;             /**< Independently locked caches of a sharded cache, `NULL` if not sharded */
+    uint32_t shard_cnt;               /**< Number of shards */
+    uint32_t evict_shard;             /**< The shard `lv_cache_evict_one()` tries first */
 
     const char * name;                /**< Name of the cache */
 };
@@ -18,6 +18,7 @@
 
 #define event_head LV_GLOBAL_DEFAULT()->event_header
 #define event_last_id LV_GLOBAL_DEFAULT()->event_last_register_id
+#define event_stats LV_GLOBAL_DEFAULT()->event_stats
 
 /**********************
  *      TYPEDEFS
@@ -35,6 +36,7 @@ static void event_mark_deleting(lv_event_list_t * list, lv_event_dsc_t * dsc);
 static bool event_is_marked_deleting(lv_event_dsc_t * dsc);
 static uint32_t event_array_size(lv_event_list_t * list);
 static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index);
+static inline uint32_t event_code_to_mask(uint32_t code);
 
 /**********************
  *  STATIC VARIABLES
@@ -75,11 +77,35 @@ void lv_event_push(lv_event_t * e)
     e->prev = event_head;
     event_head = e;
 
+    event_stats.sent_cnt++;
+    event_stats.frame_sent_cnt++;
 }
 
 void lv_event_pop(lv_event_t * e)
 {
     event_head = e->prev;
+
+    if(e->handled) {
+        event_stats.handled_cnt++;
+        event_stats.frame_handled_cnt++;
+    }
+}
+
+void lv_event_stats_frame_start(void)
+{
+    event_stats.frame_sent_cnt = 0;
+    event_stats.frame_handled_cnt = 0;
+}
+
+void lv_event_get_stats(lv_event_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    *stats = event_stats;
+}
+
+void lv_event_reset_stats(void)
+{
+    lv_memzero(&event_stats, sizeof(lv_event_stats_t));
 }
 
 lv_result_t lv_event_push_and_send(lv_event_list_t * event_list, lv_event_code_t code, void * original_target,
@@ -110,6 +136,12 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
     if(list == NULL) return LV_RESULT_OK;
     if(e->deleted) return LV_RESULT_INVALID;
 
+    /*Most events (e.g. the drawing events) have no callbacks, so don't look for them*/
+    if((list->code_mask & event_code_to_mask(e->code)) == 0) {
+        event_stats.skip_cnt++;
+        return LV_RESULT_OK;
+    }
+
     /* When obj is deleted in its own event, it will cause the `list->array` header to be released,
      * but the content still exists, which leads to memory leakage.
      * Therefore, back up the header in advance,
@@ -134,6 +166,7 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
 #if LV_USE_EXT_DATA
             e->ext_data.data = dsc->ext_data.data;
 #endif
+            e->handled = 1;
             dsc->cb(e);
             if(e->stop_processing) break;
 
@@ -176,6 +209,7 @@ lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event
     }
 
     lv_array_push_back(&list->array, &dsc);
+    list->code_mask |= event_code_to_mask(filter);
     return dsc;
 }
 
@@ -463,6 +497,13 @@ static void cleanup_event_list(lv_event_list_t * list)
 
     cleanup_event_list_core(&list->array);
 
+    /*Collect the codes of the remaining callbacks*/
+    list->code_mask = 0;
+    const uint32_t size = event_array_size(list);
+    for(uint32_t i = 0; i < size; i++) {
+        list->code_mask |= event_code_to_mask((*event_array_at(list, i))->filter);
+    }
+
     list->has_marked_deleting = false;
 }
 
@@ -483,3 +524,11 @@ static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index)
 {
     return lv_array_at(&list->array, index);
 }
+static inline uint32_t event_code_to_mask(uint32_t code)
+{
+    code &= ~(LV_EVENT_PREPROCESS | LV_EVENT_MARKED_DELETING);
+    if(code == LV_EVENT_ALL) return UINT32_MAX;
+
+    /*Codes sharing a bit only make the list searched in vain*/
+    return (uint32_t)1 << (code & 0x1f);
+}
@@ -129,11 +129,23 @@ typedef enum {
 
 typedef struct {
     lv_array_t array;
+    uint32_t code_mask;                /**< Bit `code % 32` is set if a callback might be added for `code`.
+                                         Events whose bit is not set are not looked for in the array. */
     uint8_t is_traversing: 1;          /**< True: the list is being nested traversed */
     uint8_t has_marked_deleting: 1;    /**< True: the list has marked deleting objects
                                          when some of events are marked as deleting */
 } lv_event_list_t;
 
+/** Counters of the sent events */
+typedef struct {
+    uint32_t sent_cnt;              /**< Number of events sent to widgets, displays and input devices */
+    uint32_t handled_cnt;           /**< Number of sent events for which at least one added callback was called */
+    uint32_t skip_cnt;              /**< Number of times an event list wasn't searched as it had no callback
+                                     *   for the event's code */
+    uint32_t frame_sent_cnt;        /**< `sent_cnt` since the last refresh of a display has started */
+    uint32_t frame_handled_cnt;     /**< `handled_cnt` since the last refresh of a display has started */
+} lv_event_stats_t;
+
 /**
  * @brief Event callback.
  * Events are used to notify the user of some action being taken on Widget.
@@ -245,6 +257,17 @@ uint32_t lv_event_register_id(void);
  */
 const char * lv_event_code_get_name(lv_event_code_t code);
 
+/**
+ * Get how many events were sent and handled since LVGL was initialized or the counters were reset.
+ * @param stats     store the counters here
+ */
+void lv_event_get_stats(lv_event_stats_t * stats);
+
+/**
+ * Reset the counters of `lv_event_get_stats()`
+ */
+void lv_event_reset_stats(void);
+
 #if LV_USE_EXT_DATA
 /**
  * Set external data and its destructor for an event descriptor.
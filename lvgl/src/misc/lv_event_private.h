@@ -48,6 +48,7 @@ struct _lv_event_t {
     uint8_t stop_processing : 1;
     uint8_t stop_bubbling : 1;
     uint8_t stop_trickling : 1;
+    uint8_t handled : 1;
 #if LV_USE_EXT_DATA
     lv_ext_data_t ext_data;
 #endif
@@ -66,6 +67,11 @@ void lv_event_push(lv_event_t * e);
 
 void lv_event_pop(lv_event_t * e);
 
+/**
+ * Reset the `frame_...` counters of `lv_event_get_stats()`. Called when a display refresh starts.
+ */
+void lv_event_stats_frame_start(void);
+
 
 lv_result_t lv_event_push_and_send(lv_event_list_t * event_list, lv_event_code_t code, void * original_target,
                                    void * param);
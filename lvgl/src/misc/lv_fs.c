@@ -23,6 +23,7 @@
 #endif
 
 #define fsdrv_ll_p &(LV_GLOBAL_DEFAULT()->fsdrv_ll)
+#define fs_mmap_ll_p &(LV_GLOBAL_DEFAULT()->fs_mmap_ll)
 
 /**********************
  *      TYPEDEFS
@@ -32,6 +33,12 @@ typedef struct {
     const char * real_path;
 } resolved_path_t;
 
+typedef struct {
+    lv_fs_drv_t * drv;
+    void * buf;
+    uint32_t size;
+} mmap_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -55,11 +62,13 @@ static lv_fs_res_t lv_fs_seek_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_
 void lv_fs_init(void)
 {
     lv_ll_init(fsdrv_ll_p, sizeof(lv_fs_drv_t *));
+    lv_ll_init(fs_mmap_ll_p, sizeof(mmap_t));
 }
 
 void lv_fs_deinit(void)
 {
     lv_ll_clear(fsdrv_ll_p);
+    lv_ll_clear(fs_mmap_ll_p);
 }
 
 bool lv_fs_is_ready(char letter)
@@ -449,6 +458,56 @@ fail:
     return data;
 }
 
+const void * lv_fs_mmap(lv_fs_file_t * file_p, uint32_t * size)
+{
+    *size = 0;
+    if(file_p->drv == NULL || file_p->drv->mmap_cb == NULL) return NULL;
+
+    mmap_t * map = lv_ll_ins_tail(fs_mmap_ll_p);
+    LV_ASSERT_MALLOC(map);
+    if(map == NULL) return NULL;
+
+    LV_PROFILER_FS_BEGIN;
+
+    map->drv = file_p->drv;
+    map->buf = NULL;
+    if(lv_fs_get_size(file_p, &map->size) == LV_FS_RES_OK && map->size > 0) {
+        map->buf = file_p->drv->mmap_cb(file_p->drv, file_p->file_d, map->size);
+    }
+
+    LV_PROFILER_FS_END;
+
+    if(map->buf == NULL) {
+        lv_ll_remove(fs_mmap_ll_p, map);
+        lv_free(map);
+        return NULL;
+    }
+
+    *size = map->size;
+    return map->buf;
+}
+
+lv_fs_res_t lv_fs_munmap(const void * buf)
+{
+    mmap_t * map;
+    LV_LL_READ(fs_mmap_ll_p, map) {
+        const uint8_t * start = map->buf;
+        if((const uint8_t *)buf >= start && (const uint8_t *)buf < start + map->size) break;
+    }
+
+    if(map == NULL) return LV_FS_RES_INV_PARAM;
+
+    if(map->drv->munmap_cb) {
+        LV_PROFILER_FS_BEGIN;
+        map->drv->munmap_cb(map->drv, map->buf, map->size);
+        LV_PROFILER_FS_END;
+    }
+
+    lv_ll_remove(fs_mmap_ll_p, map);
+    lv_free(map);
+    return LV_FS_RES_OK;
+}
+
 lv_fs_res_t lv_fs_dir_open(lv_fs_dir_t * rddir_p, const char * path)
 {
     if(path == NULL) return LV_FS_RES_INV_PARAM;
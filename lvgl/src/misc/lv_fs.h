@@ -81,6 +81,9 @@ struct _lv_fs_drv_t {
     lv_fs_res_t (*seek_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
 
+    void * (*mmap_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t size); /*Optional*/
+    void (*munmap_cb)(lv_fs_drv_t * drv, void * buf, uint32_t size); /*Optional*/
+
     void * (*dir_open_cb)(lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(lv_fs_drv_t * drv, void * rddir_p, char * fn, uint32_t fn_len);
     lv_fs_res_t (*dir_close_cb)(lv_fs_drv_t * drv, void * rddir_p);
@@ -267,6 +270,22 @@ lv_fs_res_t lv_fs_load_to_buf(void * buf, uint32_t buf_size, const char * path);
  */
 void * lv_fs_load_with_alloc(const char * path, uint32_t * size);
 
+/**
+ * Map the whole content of an opened file to the memory for reading.
+ * The mapping stays valid after closing the file, until `lv_fs_munmap()` is called.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param size      pointer to store the size of the file
+ * @return          pointer to the mapped content, or NULL if the driver doesn't support mapping
+ */
+const void * lv_fs_mmap(lv_fs_file_t * file_p, uint32_t * size);
+
+/**
+ * Release a mapping created by `lv_fs_mmap()`.
+ * @param buf       pointer to anywhere in the mapped content
+ * @return          LV_FS_RES_OK: unmapped; LV_FS_RES_INV_PARAM: `buf` is not in a mapped content
+ */
+lv_fs_res_t lv_fs_munmap(const void * buf);
+
 /**
  * Initialize a 'fs_dir_t' variable for directory reading
  * @param rddir_p   pointer to a 'lv_fs_dir_t' variable
@@ -402,6 +402,58 @@ lv_style_res_t lv_style_get_prop(const lv_style_t * style, lv_style_prop_t prop,
     return lv_style_get_prop_inlined(style, prop, value);
 }
 
+lv_style_value_t lv_style_value_normalize(lv_style_prop_t prop, lv_style_value_t value)
+{
+    /*The type of custom properties is unknown so keep all the bytes*/
+    if(prop >= LV_STYLE_NUM_BUILT_IN_PROPS) return value;
+
+    lv_style_value_t res;
+    lv_memzero(&res, sizeof(res));
+
+    switch(prop) {
+        case LV_STYLE_BG_COLOR:
+        case LV_STYLE_BG_GRAD_COLOR:
+        case LV_STYLE_BG_IMAGE_RECOLOR:
+        case LV_STYLE_BORDER_COLOR:
+        case LV_STYLE_OUTLINE_COLOR:
+        case LV_STYLE_SHADOW_COLOR:
+        case LV_STYLE_IMAGE_RECOLOR:
+        case LV_STYLE_LINE_COLOR:
+        case LV_STYLE_ARC_COLOR:
+        case LV_STYLE_TEXT_COLOR:
+        case LV_STYLE_TEXT_OUTLINE_STROKE_COLOR:
+        case LV_STYLE_DROP_SHADOW_COLOR:
+        case LV_STYLE_RECOLOR:
+            res.color = value.color;
+            break;
+        case LV_STYLE_BG_GRAD:
+        case LV_STYLE_BG_IMAGE_SRC:
+        case LV_STYLE_IMAGE_COLORKEY:
+        case LV_STYLE_ARC_IMAGE_SRC:
+        case LV_STYLE_TEXT_FONT:
+        case LV_STYLE_COLOR_FILTER_DSC:
+        case LV_STYLE_ANIM:
+        case LV_STYLE_TRANSITION:
+        case LV_STYLE_BITMAP_MASK_SRC:
+        case LV_STYLE_GRID_COLUMN_DSC_ARRAY:
+        case LV_STYLE_GRID_ROW_DSC_ARRAY:
+            res.ptr = value.ptr;
+            break;
+        default:
+            res.num = value.num;
+            break;
+    }
+
+    return res;
+}
+
+bool lv_style_value_is_equal(lv_style_prop_t prop, lv_style_value_t v1, lv_style_value_t v2)
+{
+    v1 = lv_style_value_normalize(prop, v1);
+    v2 = lv_style_value_normalize(prop, v2);
+    return lv_memcmp(&v1, &v2, sizeof(lv_style_value_t)) == 0;
+}
+
 void lv_style_transition_dsc_init(lv_style_transition_dsc_t * tr, const lv_style_prop_t props[],
                                   lv_anim_path_cb_t path_cb, uint32_t time, uint32_t delay, void * user_data)
 {
@@ -0,0 +1,287 @@
+/**
+ * @file lv_style_intern.c
+ *
+ * Registry of shared, immutable local styles.
+ * Widgets having the same local properties with the same values use the same style
+ * instead of allocating a private copy.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_style_private.h"
+#if LV_OBJ_LOCAL_STYLE_INTERN
+
+#include "../core/lv_global.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BUCKET_CNT      128
+#define buckets         LV_GLOBAL_DEFAULT()->style_intern_buckets
+#define entry_cnt       LV_GLOBAL_DEFAULT()->style_intern_cnt
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*`style` must be the first member to get the entry from the style*/
+struct _lv_style_intern_entry_t {
+    lv_style_t style;
+    lv_style_intern_entry_t * next;
+    uint32_t hash;
+    uint32_t ref_cnt;
+};
+
+/*Describes `base` with `prop` set to `value` (or removed) without building the style*/
+typedef struct {
+    const lv_style_t * base;
+    lv_style_prop_t prop;
+    lv_style_value_t value;
+    bool remove;
+} edit_t;
+
+typedef struct {
+    const edit_t * edit;
+    uint32_t base_idx;
+    bool edit_done;
+} edit_iter_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static const lv_style_t * get_or_create(const edit_t * edit);
+static bool edit_iter_next(edit_iter_t * it, lv_style_prop_t * prop, lv_style_value_t * value);
+static uint32_t edit_hash(const edit_t * edit, uint32_t * prop_cnt);
+static bool edit_is_equal(const edit_t * edit, const lv_style_t * style);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_style_intern_init(void)
+{
+    buckets = NULL;
+    entry_cnt = 0;
+}
+
+void lv_style_intern_deinit(void)
+{
+    if(buckets == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < BUCKET_CNT; i++) {
+        lv_style_intern_entry_t * e = buckets[i];
+        while(e) {
+            lv_style_intern_entry_t * next = e->next;
+            lv_style_reset(&e->style);
+            lv_free(e);
+            e = next;
+        }
+    }
+
+    lv_free(buckets);
+    buckets = NULL;
+    entry_cnt = 0;
+}
+
+const lv_style_t * lv_style_intern_set_prop(const lv_style_t * base, lv_style_prop_t prop, lv_style_value_t value)
+{
+    LV_ASSERT(prop != LV_STYLE_PROP_INV);
+
+    edit_t edit;
+    edit.base = base;
+    edit.prop = prop;
+    edit.value = lv_style_value_normalize(prop, value);
+    edit.remove = false;
+
+    return get_or_create(&edit);
+}
+
+const lv_style_t * lv_style_intern_remove_prop(const lv_style_t * base, lv_style_prop_t prop)
+{
+    edit_t edit;
+    lv_memzero(&edit, sizeof(edit));
+    edit.base = base;
+    edit.prop = prop;
+    edit.remove = true;
+
+    return get_or_create(&edit);
+}
+
+void lv_style_intern_release(const lv_style_t * style)
+{
+    if(style == NULL) return;
+
+    lv_style_intern_entry_t * entry = (lv_style_intern_entry_t *)style;
+    LV_ASSERT(entry->ref_cnt > 0);
+
+    entry->ref_cnt--;
+    if(entry->ref_cnt > 0) return;
+
+    lv_style_intern_entry_t ** link = &buckets[entry->hash % BUCKET_CNT];
+    while(*link != entry) {
+        LV_ASSERT_NULL(*link);
+        link = &(*link)->next;
+    }
+    *link = entry->next;
+
+    lv_style_reset(&entry->style);
+    lv_free(entry);
+    entry_cnt--;
+}
+
+uint32_t lv_style_intern_get_count(void)
+{
+    return entry_cnt;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static const lv_style_t * get_or_create(const edit_t * edit)
+{
+    if(buckets == NULL) {
+        buckets = lv_malloc_zeroed(BUCKET_CNT * sizeof(lv_style_intern_entry_t *));
+        LV_ASSERT_MALLOC(buckets);
+        if(buckets == NULL) return NULL;
+    }
+
+    uint32_t prop_cnt;
+    uint32_t hash = edit_hash(edit, &prop_cnt);
+
+    lv_style_intern_entry_t * e;
+    for(e = buckets[hash % BUCKET_CNT]; e; e = e->next) {
+        if(e->hash == hash && edit_is_equal(edit, &e->style)) {
+            e->ref_cnt++;
+            return &e->style;
+        }
+    }
+
+    e = lv_malloc_zeroed(sizeof(lv_style_intern_entry_t));
+    LV_ASSERT_MALLOC(e);
+    if(e == NULL) return NULL;
+
+    lv_style_init(&e->style);
+    if(prop_cnt > 0) {
+        uint8_t * values_and_props = lv_malloc(prop_cnt * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t)));
+        LV_ASSERT_MALLOC(values_and_props);
+        if(values_and_props == NULL) {
+            lv_free(e);
+            return NULL;
+        }
+
+        lv_style_value_t * values = (lv_style_value_t *)values_and_props;
+        lv_style_prop_t * props = (lv_style_prop_t *)(values_and_props + prop_cnt * sizeof(lv_style_value_t));
+
+        /*Store the properties sorted, so the same set of properties always has the same layout*/
+        edit_iter_t it = {.edit = edit};
+        uint32_t i = 0;
+        while(edit_iter_next(&it, &props[i], &values[i])) {
+            e->style.has_group |= (uint32_t)1 << lv_style_get_prop_group(props[i]);
+            i++;
+        }
+
+        e->style.values_and_props = values_and_props;
+        e->style.prop_cnt = (uint8_t)prop_cnt;
+    }
+
+    e->hash = hash;
+    e->ref_cnt = 1;
+    e->next = buckets[hash % BUCKET_CNT];
+    buckets[hash % BUCKET_CNT] = e;
+    entry_cnt++;
+
+    return &e->style;
+}
+
+/**
+ * Get the next property of the edited style in ascending property order.
+ * The properties of the interned base styles are already sorted.
+ */
+static bool edit_iter_next(edit_iter_t * it, lv_style_prop_t * prop, lv_style_value_t * value)
+{
+    const edit_t * edit = it->edit;
+    const lv_style_t * base = edit->base;
+    uint32_t base_cnt = base ? base->prop_cnt : 0;
+    const lv_style_value_t * base_values = base ? base->values_and_props : NULL;
+    const lv_style_prop_t * base_props = base ? (const lv_style_prop_t *)base->values_and_props +
+                                         base_cnt * sizeof(lv_style_value_t) : NULL;
+
+    while(1) {
+        bool has_base = it->base_idx < base_cnt;
+        if(!it->edit_done && (!has_base || edit->prop <= base_props[it->base_idx])) {
+            it->edit_done = true;
+            /*The edited property replaces (or removes) the one in the base style*/
+            if(has_base && base_props[it->base_idx] == edit->prop) it->base_idx++;
+            if(edit->remove) continue;
+
+            *prop = edit->prop;
+            *value = edit->value;
+            return true;
+        }
+
+        if(!has_base) return false;
+
+        *prop = base_props[it->base_idx];
+        *value = base_values[it->base_idx];
+        it->base_idx++;
+        return true;
+    }
+}
+
+static uint32_t edit_hash(const edit_t * edit, uint32_t * prop_cnt)
+{
+    /*FNV-1a*/
+    uint32_t hash = 2166136261U;
+    uint32_t cnt = 0;
+    lv_style_prop_t prop;
+    lv_style_value_t value;
+    edit_iter_t it = {.edit = edit};
+    while(edit_iter_next(&it, &prop, &value)) {
+        const uint8_t * bytes = (const uint8_t *)&value;
+        uint32_t i;
+        hash = (hash ^ prop) * 16777619U;
+        for(i = 0; i < sizeof(value); i++) {
+            hash = (hash ^ bytes[i]) * 16777619U;
+        }
+        cnt++;
+    }
+
+    *prop_cnt = cnt;
+    return hash;
+}
+
+static bool edit_is_equal(const edit_t * edit, const lv_style_t * style)
+{
+    const lv_style_value_t * values = style->values_and_props;
+    const lv_style_prop_t * props = (const lv_style_prop_t *)style->values_and_props +
+                                    style->prop_cnt * sizeof(lv_style_value_t);
+
+    uint32_t i = 0;
+    lv_style_prop_t prop;
+    lv_style_value_t value;
+    edit_iter_t it = {.edit = edit};
+    while(edit_iter_next(&it, &prop, &value)) {
+        if(i >= style->prop_cnt) return false;
+        if(props[i] != prop) return false;
+        if(lv_memcmp(&values[i], &value, sizeof(value)) != 0) return false;
+        i++;
+    }
+
+    return i == style->prop_cnt;
+}
+
+#endif /*LV_OBJ_LOCAL_STYLE_INTERN*/
@@ -28,6 +28,70 @@ extern "C" {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Keep only the bytes of a style value which are meaningful for the given property
+ * and zero the rest of the union. Normalized values can be compared with `lv_memcmp`.
+ * @param prop      a style property
+ * @param value     a value of `prop`
+ * @return          the normalized value
+ */
+lv_style_value_t lv_style_value_normalize(lv_style_prop_t prop, lv_style_value_t value);
+
+/**
+ * Check if two values of a property are the same.
+ * @param prop      a style property
+ * @param v1        a value of `prop`
+ * @param v2        an other value of `prop`
+ * @return          true: the values are the same
+ */
+bool lv_style_value_is_equal(lv_style_prop_t prop, lv_style_value_t v1, lv_style_value_t v2);
+
+#if LV_OBJ_LOCAL_STYLE_INTERN
+
+/**
+ * Initialize the registry of shared local styles. Called in `lv_init()`.
+ */
+void lv_style_intern_init(void);
+
+/**
+ * Free the registry of shared local styles. Called in `lv_deinit()`.
+ */
+void lv_style_intern_deinit(void);
+
+/**
+ * Get a shared, immutable style which has the same properties as `base`,
+ * except `prop` which is set to `value`.
+ * A reference is taken on the returned style, the reference on `base` is kept.
+ * @param base      an interned style or NULL to start from an empty style
+ * @param prop      the property to set
+ * @param value     the new value of the property
+ * @return          the interned style or NULL on out of memory
+ */
+const lv_style_t * lv_style_intern_set_prop(const lv_style_t * base, lv_style_prop_t prop, lv_style_value_t value);
+
+/**
+ * Get a shared, immutable style which has the same properties as `base` except `prop`.
+ * A reference is taken on the returned style, the reference on `base` is kept.
+ * @param base      an interned style
+ * @param prop      the property to remove
+ * @return          the interned style or NULL on out of memory
+ */
+const lv_style_t * lv_style_intern_remove_prop(const lv_style_t * base, lv_style_prop_t prop);
+
+/**
+ * Drop a reference on an interned style. The style is freed when it's not used anymore.
+ * @param style     an interned style
+ */
+void lv_style_intern_release(const lv_style_t * style);
+
+/**
+ * Get the number of distinct interned styles.
+ * @return          the number of styles in the registry
+ */
+uint32_t lv_style_intern_get_count(void);
+
+#endif /*LV_OBJ_LOCAL_STYLE_INTERN*/
+
 /**********************
  *      MACROS
  **********************/
@@ -182,6 +182,10 @@ typedef struct _lv_draw_mask_rect_dsc_t lv_draw_mask_rect_dsc_t;
 
 typedef struct _lv_obj_style_t lv_obj_style_t;
 
+typedef struct _lv_obj_style_prop_cache_t lv_obj_style_prop_cache_t;
+
+typedef struct _lv_style_intern_entry_t lv_style_intern_entry_t;
+
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
@@ -190,6 +194,8 @@ typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
 
 typedef struct _lv_obj_spec_attr_t lv_obj_spec_attr_t;
 
+typedef struct _lv_refr_cache_layer_t lv_refr_cache_layer_t;
+
 typedef struct _lv_image_t lv_image_t;
 
 typedef struct _lv_animimg_t lv_animimg_t;
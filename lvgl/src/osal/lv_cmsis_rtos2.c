@@ -121,6 +121,11 @@ lv_result_t lv_mutex_lock_isr(lv_mutex_t * mutex)
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_mutex_trylock(lv_mutex_t * mutex)
+{
+    return osMutexAcquire(*mutex, 0U) == osOK ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
 lv_result_t lv_mutex_unlock(lv_mutex_t * mutex)
 {
     osStatus_t status = osMutexRelease(*mutex);
@@ -158,6 +158,14 @@ lv_result_t lv_mutex_lock_isr(lv_mutex_t * pxMutex)
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_mutex_trylock(lv_mutex_t * pxMutex)
+{
+    /* If mutex in uninitialized, perform initialization. */
+    prvCheckMutexInit(pxMutex);
+
+    return xSemaphoreTakeRecursive(pxMutex->xMutex, 0) == pdTRUE ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
 lv_result_t lv_mutex_unlock(lv_mutex_t * pxMutex)
 {
     /* If mutex in uninitialized, perform initialization. */
@@ -99,6 +99,11 @@ lv_result_t lv_mutex_lock_isr(lv_mutex_t * mutex)
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_mutex_trylock(lv_mutex_t * mutex)
+{
+    return _mutex_try_lock(mutex) == MQX_OK ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
 lv_result_t lv_mutex_unlock(lv_mutex_t * mutex)
 {
     _mqx_uint ret = _mutex_unlock(mutex);
@@ -131,6 +131,13 @@ lv_result_t lv_mutex_lock(lv_mutex_t * mutex);
  */
 lv_result_t lv_mutex_lock_isr(lv_mutex_t * mutex);
 
+/**
+ * Lock a mutex only if it's not locked by an other thread
+ * @param mutex         the mutex to lock
+ * @return              LV_RESULT_OK: locked; LV_RESULT_INVALID: the mutex is busy or failure
+ */
+lv_result_t lv_mutex_trylock(lv_mutex_t * mutex);
+
 /**
  * Unlock a mutex
  * @param mutex         the mutex to unlock
@@ -224,6 +231,12 @@ static inline lv_result_t lv_mutex_lock_isr(lv_mutex_t * mutex)
     return LV_RESULT_OK;
 }
 
+static inline lv_result_t lv_mutex_trylock(lv_mutex_t * mutex)
+{
+    LV_UNUSED(mutex);
+    return LV_RESULT_OK;
+}
+
 static inline lv_result_t lv_mutex_unlock(lv_mutex_t * mutex)
 {
     LV_UNUSED(mutex);
@@ -107,6 +107,11 @@ lv_result_t lv_mutex_lock_isr(lv_mutex_t * mutex)
     }
 }
 
+lv_result_t lv_mutex_trylock(lv_mutex_t * mutex)
+{
+    return rt_mutex_take(mutex->mutex, 0) == RT_EOK ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
 lv_result_t lv_mutex_unlock(lv_mutex_t * mutex)
 {
     rt_err_t ret = rt_mutex_release(mutex->mutex);
@@ -105,6 +105,11 @@ lv_result_t lv_mutex_lock_isr(lv_mutex_t * mutex)
     }
 }
 
+lv_result_t lv_mutex_trylock(lv_mutex_t * mutex)
+{
+    return SDL_TryLockMutex(*mutex) == 0 ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
 lv_result_t lv_mutex_unlock(lv_mutex_t * mutex)
 {
     int ret = SDL_UnlockMutex(*mutex);
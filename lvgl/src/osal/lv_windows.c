@@ -135,6 +135,11 @@ lv_result_t lv_mutex_lock_isr(lv_mutex_t * mutex)
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_mutex_trylock(lv_mutex_t * mutex)
+{
+    return TryEnterCriticalSection(mutex) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
 lv_result_t lv_mutex_unlock(lv_mutex_t * mutex)
 {
     LeaveCriticalSection(mutex);
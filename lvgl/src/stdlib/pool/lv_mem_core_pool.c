@@ -0,0 +1,446 @@
+/**
+ * @file lv_mem_core_pool.c
+ *
+ * Size class allocator on top of the C library's malloc.
+ * Small allocations are served from slabs split into blocks of a few fixed sizes.
+ * With a multi-threaded OS each thread keeps a small cache (magazine) of free blocks
+ * per size class, so most allocations and frees don't need to lock the shared pools.
+ * Allocations larger than the biggest size class (e.g. draw buffers) are passed to malloc directly.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_mem.h"
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL
+
+#include "../lv_string.h"
+#include "../../misc/lv_assert.h"
+#include "../../misc/lv_log.h"
+#include "../../misc/lv_math.h"
+#include "../../osal/lv_os_private.h"
+#include "../../core/lv_global.h"
+#include <stdlib.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define state LV_GLOBAL_DEFAULT()->mem_pool_state
+
+#define HDR_SIZE        sizeof(block_hdr_t)
+#define BLOCK_MAGIC     0x5a3c
+#define CLASS_LARGE     0xffff
+#define CLASS_MAX_SIZE  2048
+
+#if LV_MEM_SLAB_SIZE < 4 * (CLASS_MAX_SIZE + 16)
+    #error "LV_MEM_SLAB_SIZE is too small"
+#endif
+
+#if LV_MEM_MAGAZINE_SIZE > 0 && (LV_USE_OS == LV_OS_PTHREAD || LV_USE_OS == LV_OS_WINDOWS)
+    #if defined(_MSC_VER)
+        #define MAGAZINE_THREAD_LOCAL __declspec(thread)
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define MAGAZINE_THREAD_LOCAL __thread
+    #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+        #define MAGAZINE_THREAD_LOCAL _Thread_local
+    #endif
+#endif
+
+#ifdef MAGAZINE_THREAD_LOCAL
+    #define USE_MAGAZINE    1
+#else
+    #define USE_MAGAZINE    0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Placed before each block. The size is 16 bytes to keep the blocks aligned as malloc does.*/
+typedef union {
+    struct {
+        size_t size;            /*Usable size of the block*/
+        uint16_t class_idx;     /*Index in `class_sizes` or `CLASS_LARGE`*/
+        uint16_t magic;
+    } info;
+    uint8_t align[16];
+} block_hdr_t;
+
+#if USE_MAGAZINE
+typedef struct {
+    uint32_t epoch;
+    uint32_t cnt[LV_MEM_POOL_CLASS_CNT];
+    void * blocks[LV_MEM_POOL_CLASS_CNT][LV_MEM_MAGAZINE_SIZE];
+} magazine_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t get_class(size_t size);
+static void * pool_alloc(uint32_t class_idx);
+static void pool_free(block_hdr_t * hdr);
+static void * free_list_pop(uint32_t class_idx);
+static void free_list_push(uint32_t class_idx, void * block);
+static void * large_alloc(size_t size);
+static void large_free(block_hdr_t * hdr);
+static bool add_slab(uint32_t class_idx);
+static size_t get_used_size(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const uint16_t class_sizes[LV_MEM_POOL_CLASS_CNT] = {
+    16, 32, 48, 64, 80, 96, 128, 160, 192, 256, 320, 384, 512, 768, 1024, 1536, CLASS_MAX_SIZE
+};
+
+/*Not in the global state as it must change across `lv_deinit()`/`lv_init()`
+ *to drop the caches of the threads which are still alive*/
+static uint32_t epoch_cnt;
+
+#if USE_MAGAZINE
+    static MAGAZINE_THREAD_LOCAL magazine_t magazine;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+#if LV_USE_OS
+    #define POOL_LOCK()     lv_mutex_lock(&state.mutex)
+    #define POOL_UNLOCK()   lv_mutex_unlock(&state.mutex)
+#else
+    #define POOL_LOCK()
+    #define POOL_UNLOCK()
+#endif
+
+#define BLOCK_TO_HDR(p)     ((block_hdr_t *)((uint8_t *)(p) - HDR_SIZE))
+#define HDR_TO_BLOCK(h)     ((void *)((uint8_t *)(h) + HDR_SIZE))
+#define FREE_NEXT(p)        (*(void **)(p))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_mem_init(void)
+{
+#if LV_USE_OS
+    lv_mutex_init(&state.mutex);
+#endif
+    epoch_cnt++;
+    state.epoch = epoch_cnt;
+}
+
+void lv_mem_deinit(void)
+{
+    POOL_LOCK();
+    void * slab = state.slab_list;
+    while(slab) {
+        void * next = FREE_NEXT(slab);
+        free(slab);
+        slab = next;
+    }
+    POOL_UNLOCK();
+
+#if LV_USE_OS
+    lv_mutex_delete(&state.mutex);
+#endif
+    lv_memzero(&state, sizeof(lv_mem_pool_state_t));
+}
+
+lv_mem_pool_t lv_mem_add_pool(void * mem, size_t bytes)
+{
+    /*Not supported*/
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+    /*Not supported*/
+    LV_UNUSED(pool);
+    return;
+}
+
+void * lv_malloc_core(size_t size)
+{
+    if(size > CLASS_MAX_SIZE) return large_alloc(size);
+    return pool_alloc(get_class(size));
+}
+
+void * lv_realloc_core(void * p, size_t new_size)
+{
+    if(p == NULL) return lv_malloc_core(new_size);
+
+    block_hdr_t * hdr = BLOCK_TO_HDR(p);
+    LV_ASSERT(hdr->info.magic == BLOCK_MAGIC);
+
+    if(hdr->info.class_idx == CLASS_LARGE) {
+        /*Let the C library grow or shrink it in place if it can*/
+        if(new_size > CLASS_MAX_SIZE) {
+            size_t old_size = hdr->info.size;
+            block_hdr_t * new_hdr = realloc(hdr, HDR_SIZE + new_size);
+            if(new_hdr == NULL) return NULL;
+
+            new_hdr->info.size = new_size;
+            POOL_LOCK();
+            state.large_size = state.large_size - old_size + new_size;
+            state.max_used = LV_MAX(state.max_used, get_used_size());
+            POOL_UNLOCK();
+            return HDR_TO_BLOCK(new_hdr);
+        }
+    }
+    /*Still fits and wouldn't go to a smaller class*/
+    else if(new_size <= CLASS_MAX_SIZE && get_class(new_size) == hdr->info.class_idx) {
+        return p;
+    }
+
+    void * p_new = lv_malloc_core(new_size);
+    if(p_new == NULL) return NULL;
+
+    lv_memcpy(p_new, p, LV_MIN(new_size, hdr->info.size));
+    lv_free_core(p);
+    return p_new;
+}
+
+void lv_free_core(void * p)
+{
+    block_hdr_t * hdr = BLOCK_TO_HDR(p);
+    LV_ASSERT(hdr->info.magic == BLOCK_MAGIC);
+
+    if(hdr->info.class_idx == CLASS_LARGE) large_free(hdr);
+    else pool_free(hdr);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
+{
+    lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
+
+    /*The blocks cached by the threads are counted as used*/
+    POOL_LOCK();
+    uint32_t i;
+    for(i = 0; i < LV_MEM_POOL_CLASS_CNT; i++) {
+        mon_p->free_cnt += state.free_cnt[i];
+        if(state.free_cnt[i] > 0) mon_p->free_biggest_size = class_sizes[i];
+    }
+
+    mon_p->free_size = state.free_size;
+    mon_p->total_size = state.slab_size + state.large_size;
+    mon_p->used_cnt = state.slab_block_cnt - mon_p->free_cnt + state.large_cnt;
+    mon_p->max_used = state.max_used;
+    POOL_UNLOCK();
+
+    if(mon_p->total_size > 0) {
+        mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
+    }
+
+    /*Free memory can be reused only for its own size class,
+     *so the fragmentation shows how much of it is not in the biggest class*/
+    if(mon_p->free_size > 0) {
+        mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
+        mon_p->frag_pct = 100 - mon_p->frag_pct;
+    }
+    else {
+        mon_p->frag_pct = 0;
+    }
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+    lv_result_t res = LV_RESULT_OK;
+
+    POOL_LOCK();
+    uint32_t i;
+    for(i = 0; i < LV_MEM_POOL_CLASS_CNT && res == LV_RESULT_OK; i++) {
+        uint32_t cnt = 0;
+        void * p;
+        for(p = state.free_list[i]; p; p = FREE_NEXT(p)) {
+            block_hdr_t * hdr = BLOCK_TO_HDR(p);
+            if(hdr->info.magic != BLOCK_MAGIC || hdr->info.class_idx != i || cnt >= state.free_cnt[i]) {
+                LV_LOG_WARN("corrupted free block in class %" LV_PRIu32, i);
+                res = LV_RESULT_INVALID;
+                break;
+            }
+            cnt++;
+        }
+
+        if(res == LV_RESULT_OK && cnt != state.free_cnt[i]) {
+            LV_LOG_WARN("free block count mismatch in class %" LV_PRIu32, i);
+            res = LV_RESULT_INVALID;
+        }
+    }
+    POOL_UNLOCK();
+
+    return res;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t get_class(size_t size)
+{
+    uint32_t i = 0;
+    while(class_sizes[i] < size) i++;
+    return i;
+}
+
+static void * pool_alloc(uint32_t class_idx)
+{
+#if USE_MAGAZINE
+    magazine_t * mag = &magazine;
+    if(mag->epoch != state.epoch) {
+        lv_memzero(mag->cnt, sizeof(mag->cnt));
+        mag->epoch = state.epoch;
+    }
+
+    if(mag->cnt[class_idx] == 0) {
+        /*Refill half of the magazine to not go back to the shared pool on the next alloc/free*/
+        POOL_LOCK();
+        while(mag->cnt[class_idx] < (LV_MEM_MAGAZINE_SIZE + 1) / 2) {
+            void * block = free_list_pop(class_idx);
+            if(block == NULL) break;
+            mag->blocks[class_idx][mag->cnt[class_idx]] = block;
+            mag->cnt[class_idx]++;
+        }
+        POOL_UNLOCK();
+
+        if(mag->cnt[class_idx] == 0) return NULL;
+    }
+
+    mag->cnt[class_idx]--;
+    return mag->blocks[class_idx][mag->cnt[class_idx]];
+#else
+    POOL_LOCK();
+    void * block = free_list_pop(class_idx);
+    POOL_UNLOCK();
+    return block;
+#endif
+}
+
+static void pool_free(block_hdr_t * hdr)
+{
+    uint32_t class_idx = hdr->info.class_idx;
+    void * block = HDR_TO_BLOCK(hdr);
+
+#if USE_MAGAZINE
+    magazine_t * mag = &magazine;
+    if(mag->epoch != state.epoch) {
+        lv_memzero(mag->cnt, sizeof(mag->cnt));
+        mag->epoch = state.epoch;
+    }
+
+    if(mag->cnt[class_idx] == LV_MEM_MAGAZINE_SIZE) {
+        /*Give back half of the magazine to let other threads use them*/
+        POOL_LOCK();
+        while(mag->cnt[class_idx] > LV_MEM_MAGAZINE_SIZE / 2) {
+            mag->cnt[class_idx]--;
+            free_list_push(class_idx, mag->blocks[class_idx][mag->cnt[class_idx]]);
+        }
+        POOL_UNLOCK();
+    }
+
+    mag->blocks[class_idx][mag->cnt[class_idx]] = block;
+    mag->cnt[class_idx]++;
+#else
+    POOL_LOCK();
+    free_list_push(class_idx, block);
+    POOL_UNLOCK();
+#endif
+}
+
+/**
+ * Take a free block of a class. Must be called with the pool locked.
+ */
+static void * free_list_pop(uint32_t class_idx)
+{
+    if(state.free_list[class_idx] == NULL) {
+        if(!add_slab(class_idx)) return NULL;
+    }
+
+    void * block = state.free_list[class_idx];
+    state.free_list[class_idx] = FREE_NEXT(block);
+    state.free_cnt[class_idx]--;
+    state.free_size -= HDR_SIZE + class_sizes[class_idx];
+
+    state.max_used = LV_MAX(state.max_used, get_used_size());
+    return block;
+}
+
+/**
+ * Put back a free block of a class. Must be called with the pool locked.
+ */
+static void free_list_push(uint32_t class_idx, void * block)
+{
+    FREE_NEXT(block) = state.free_list[class_idx];
+    state.free_list[class_idx] = block;
+    state.free_cnt[class_idx]++;
+    state.free_size += HDR_SIZE + class_sizes[class_idx];
+}
+
+/**
+ * Allocate a slab and split it into free blocks of a class. Must be called with the pool locked.
+ * The first `HDR_SIZE` bytes of the slab link the slabs.
+ */
+static bool add_slab(uint32_t class_idx)
+{
+    uint8_t * slab = malloc(LV_MEM_SLAB_SIZE);
+    if(slab == NULL) return false;
+
+    FREE_NEXT(slab) = state.slab_list;
+    state.slab_list = slab;
+    state.slab_size += LV_MEM_SLAB_SIZE;
+
+    size_t block_size = HDR_SIZE + class_sizes[class_idx];
+    uint8_t * p;
+    for(p = slab + HDR_SIZE; p + block_size <= slab + LV_MEM_SLAB_SIZE; p += block_size) {
+        block_hdr_t * hdr = (block_hdr_t *)p;
+        hdr->info.size = class_sizes[class_idx];
+        hdr->info.class_idx = (uint16_t)class_idx;
+        hdr->info.magic = BLOCK_MAGIC;
+        free_list_push(class_idx, HDR_TO_BLOCK(hdr));
+        state.slab_block_cnt++;
+    }
+
+    return true;
+}
+
+static void * large_alloc(size_t size)
+{
+    block_hdr_t * hdr = malloc(HDR_SIZE + size);
+    if(hdr == NULL) return NULL;
+
+    hdr->info.size = size;
+    hdr->info.class_idx = CLASS_LARGE;
+    hdr->info.magic = BLOCK_MAGIC;
+
+    POOL_LOCK();
+    state.large_size += size;
+    state.large_cnt++;
+    state.max_used = LV_MAX(state.max_used, get_used_size());
+    POOL_UNLOCK();
+
+    return HDR_TO_BLOCK(hdr);
+}
+
+static void large_free(block_hdr_t * hdr)
+{
+    POOL_LOCK();
+    state.large_size -= hdr->info.size;
+    state.large_cnt--;
+    POOL_UNLOCK();
+
+    hdr->info.magic = 0;
+    free(hdr);
+}
+
+/**
+ * Get the bytes not in the free lists of the pool. Must be called with the pool locked.
+ */
+static size_t get_used_size(void)
+{
+    /*The slab links are counted as used too*/
+    return state.slab_size + state.large_size - state.free_size;
+}
+
+#endif /*LV_STDLIB_POOL*/
@@ -0,0 +1,62 @@
+/**
+ * @file lv_mem_pool_private.h
+ *
+ */
+
+#ifndef LV_MEM_POOL_PRIVATE_H
+#define LV_MEM_POOL_PRIVATE_H
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../osal/lv_os_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Number of size classes. Larger allocations are passed to the C library. */
+#define LV_MEM_POOL_CLASS_CNT   17
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+#if LV_USE_OS
+    lv_mutex_t mutex;
+#endif
+    void * free_list[LV_MEM_POOL_CLASS_CNT];    /**< Free blocks of each size class */
+    uint32_t free_cnt[LV_MEM_POOL_CLASS_CNT];   /**< Number of blocks in `free_list` */
+    size_t free_size;                           /**< Bytes of the blocks in the free lists (with headers) */
+    void * slab_list;                           /**< All slabs, to free them in `lv_mem_deinit()` */
+    size_t slab_size;                           /**< Bytes taken for the slabs */
+    size_t slab_block_cnt;                      /**< Number of blocks in the slabs */
+    size_t large_size;                          /**< Bytes taken for blocks larger than the biggest class */
+    size_t large_cnt;                           /**< Number of large blocks */
+    size_t max_used;                            /**< High-water mark of the used bytes */
+    uint32_t epoch;                             /**< Per-thread caches of an other epoch are dropped */
+} lv_mem_pool_state_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL*/
+
+#endif /*LV_MEM_POOL_PRIVATE_H*/
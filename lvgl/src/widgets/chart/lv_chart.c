@@ -26,6 +26,13 @@
 #define LV_CHART_POINT_CNT_DEF 10
 #define LV_CHART_LABEL_MAX_TEXT_LENGTH 16
 
+/*Order the accesses of the stream buffers which are shared with an other thread*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define STREAM_MEMORY_BARRIER() __sync_synchronize()
+#else
+    #define STREAM_MEMORY_BARRIER()
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -39,6 +46,8 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
+static void add_crowded_lines(lv_obj_t * obj, lv_chart_series_t * ser, lv_draw_line_dsc_t * line_dsc,
+                              const lv_area_t * clip_area, int32_t x_ofs, int32_t y_ofs, int32_t w, int32_t h, int32_t extra_space_x);
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_stacked(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
@@ -47,6 +56,11 @@ static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
 static int32_t value_to_y(lv_obj_t * obj, lv_chart_series_t * ser, int32_t v, int32_t h);
+static void columns_update(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t column_size);
+static void column_scan(const int32_t * points, uint32_t from, uint32_t to, lv_chart_column_t * col);
+static void column_mark_dirty(lv_chart_series_t * ser, uint32_t id);
+static void stream_timer_cb(lv_timer_t * t);
+static void series_free_caches(lv_chart_series_t * ser);
 
 /**********************
  *  STATIC VARIABLES
@@ -451,6 +465,13 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The points might have been changed directly in the arrays so recalculate the columns too*/
+    lv_chart_t * chart = (lv_chart_t *)obj;
+    lv_chart_series_t * ser;
+    LV_LL_READ_BACK(&chart->series_ll, ser) {
+        ser->column_size = 0;
+    }
+
     lv_obj_invalidate(obj);
 }
 
@@ -528,6 +549,7 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    series_free_caches(series);
 
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
@@ -690,6 +712,7 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
     lv_chart_t * chart  = (lv_chart_t *)obj;
 
     ser->y_points[ser->start_point] = value;
+    column_mark_dirty(ser, ser->start_point);
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
 }
@@ -712,6 +735,60 @@ void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, int32_t x
     invalidate_point(obj, ser->start_point);
 }
 
+void lv_chart_set_series_stream(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t capacity)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(ser);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    if(ser->stream) {
+        lv_free(ser->stream->buf);
+        lv_free(ser->stream);
+        ser->stream = NULL;
+    }
+
+    if(capacity == 0) return;
+
+    lv_chart_stream_t * stream = lv_malloc_zeroed(sizeof(lv_chart_stream_t));
+    LV_ASSERT_MALLOC(stream);
+    if(stream == NULL) return;
+
+    /*Power of 2 size to simply mask the counters to get the index*/
+    stream->size = 1;
+    while(stream->size < capacity) stream->size <<= 1;
+
+    stream->buf = lv_malloc(stream->size * sizeof(int32_t));
+    LV_ASSERT_MALLOC(stream->buf);
+    if(stream->buf == NULL) {
+        lv_free(stream);
+        return;
+    }
+
+    ser->stream = stream;
+
+    if(chart->stream_timer == NULL) {
+        chart->stream_timer = lv_timer_create(stream_timer_cb, LV_DEF_REFR_PERIOD, obj);
+    }
+}
+
+lv_result_t lv_chart_push_stream_value(lv_chart_series_t * ser, int32_t value)
+{
+    LV_ASSERT_NULL(ser);
+
+    lv_chart_stream_t * stream = ser->stream;
+    if(stream == NULL) return LV_RESULT_INVALID;
+
+    uint32_t write_cnt = stream->write_cnt;
+    if(write_cnt - stream->read_cnt >= stream->size) return LV_RESULT_INVALID;
+
+    stream->buf[write_cnt & (stream->size - 1)] = value;
+    STREAM_MEMORY_BARRIER();    /*The value needs to be written before the chart sees the new counter*/
+    stream->write_cnt = write_cnt + 1;
+
+    return LV_RESULT_OK;
+}
+
 void lv_chart_set_series_values(lv_obj_t * obj, lv_chart_series_t * ser, const int32_t values[], size_t values_cnt)
 {
     size_t i;
@@ -738,6 +815,7 @@ void lv_chart_set_series_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, ui
 
     if(id >= chart->point_cnt) return;
     ser->y_points[id] = value;
+    column_mark_dirty(ser, id);
     invalidate_point(obj, id);
 }
 
@@ -767,6 +845,7 @@ void lv_chart_set_series_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, in
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
+    ser->column_size = 0;
     lv_obj_invalidate(obj);
 }
 
@@ -867,6 +946,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        series_free_caches(ser);
 
         lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -881,6 +961,11 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     }
     lv_ll_clear(&chart->cursor_ll);
 
+    if(chart->stream_timer) {
+        lv_timer_delete(chart->stream_timer);
+        chart->stream_timer = NULL;
+    }
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -1052,7 +1137,7 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
 
     lv_point_precise_t * points = NULL;
     if(crowded_mode) {
-        points = lv_malloc((w + 2 * extra_space_x) * 3 * sizeof(lv_point_precise_t));
+        points = lv_malloc((w + 1 + 2 * extra_space_x) * 3 * sizeof(lv_point_precise_t));
     }
     else {
         points = lv_malloc(chart->point_cnt * sizeof(lv_point_precise_t));
@@ -1077,27 +1162,26 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.drop_shadow_color = ser->color;
         point_draw_dsc.bg_color = ser->color;
         line_dsc.base.id2 = 0;
-
-        int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
-        int32_t p_act = start_point;
-        int32_t p_prev = start_point;
-
-        lv_value_precise_t y_min = obj->coords.y2;
-        lv_value_precise_t y_max = obj->coords.y1;
-        lv_value_precise_t x_prev = -10000;
         line_dsc.p1.x = x_ofs;
         line_dsc.p2.x = x_ofs;
         line_dsc.point_cnt = 0;
 
+        /*In crowded mode draw vertical lines from the min/max on the same X coordinate*/
+        if(crowded_mode) {
+            add_crowded_lines(obj, ser, &line_dsc, &layer->_clip_area, x_ofs, y_ofs, w, h, extra_space_x);
+            lv_draw_line(layer, &line_dsc);
+            line_dsc.base.id1--;
+            continue;
+        }
+
+        int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+
         uint32_t i;
         for(i = 0; i < chart->point_cnt; i++) {
             lv_value_precise_t p_x = (int32_t)((w * i) / (chart->point_cnt - 1)) + x_ofs;
             if(p_x > layer->_clip_area.x2 + extra_space_x + 1) break;
-            if(p_x < layer->_clip_area.x1 - extra_space_x - 1) {
-                p_prev = p_act;
-                continue;
-            }
-            p_act = (start_point + i) % chart->point_cnt;
+            if(p_x < layer->_clip_area.x1 - extra_space_x - 1) continue;
+            int32_t p_act = (start_point + i) % chart->point_cnt;
 
             lv_value_precise_t p_y;
             if(ser->y_points[p_act] == LV_CHART_POINT_NONE) {
@@ -1110,62 +1194,31 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
                 p_y = (int32_t)lv_map(v, min_v, max_v, y_ofs + h, y_ofs);
             }
 
-            /*In normal mode just collect the points here*/
-            if(crowded_mode == false) {
-                points[line_dsc.point_cnt].x = p_x;
-                points[line_dsc.point_cnt].y = p_y;
-                line_dsc.point_cnt++;
-            }
-            /*In crowded mode draw vertical lines from the min/max on the same X coordinate*/
-            else {
-                if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                    /*Draw only one vertical line between the min and max y-values on the same x-value*/
-                    y_max = LV_MAX(y_max, p_y);
-                    y_min = LV_MIN(y_min, p_y);
-                    if(x_prev != p_x) {
-                        line_dsc.points[line_dsc.point_cnt].y = y_min;
-                        line_dsc.points[line_dsc.point_cnt].x = p_x;
-                        line_dsc.points[line_dsc.point_cnt + 1].y = y_max;
-                        line_dsc.points[line_dsc.point_cnt + 1].x = p_x;
-                        line_dsc.points[line_dsc.point_cnt + 2].y = LV_DRAW_LINE_POINT_NONE;
-                        line_dsc.points[line_dsc.point_cnt + 2].x = p_x;
-
-                        /*If they are the same no line would be drawn*/
-                        if(line_dsc.points[line_dsc.point_cnt].y == line_dsc.points[line_dsc.point_cnt + 1].y) {
-                            line_dsc.points[line_dsc.point_cnt + 1].y++;
-                        }
-                        y_min = p_y;  /*Start the line of the next x from the current last y*/
-                        y_max = p_y;
-                        x_prev = p_x;
-                        line_dsc.point_cnt += 3;
-                    }
-                }
-            }
-
-            p_prev = p_act;
+            points[line_dsc.point_cnt].x = p_x;
+            points[line_dsc.point_cnt].y = p_y;
+            line_dsc.point_cnt++;
         }
 
         /*Draw the line from the accumulated points*/
         lv_draw_line(layer, &line_dsc);
-        if(!crowded_mode) {
-            point_draw_dsc.bg_color = ser->color;
-            point_draw_dsc.base.id1 = line_dsc.base.id1;
-            /*Add the bullets too*/
-            if(bullet_w > 0 && bullet_h > 0) {
-                point_draw_dsc.base.id2 = i - 1; /*Start from the last rendered point*/
-                int32_t j;
-                for(j = line_dsc.point_cnt - 1; j >= 0; j--) {
-                    if(points[j].y == LV_DRAW_LINE_POINT_NONE) continue;
-
-                    lv_area_t point_area;
-                    point_area.x1 = (int32_t)points[j].x - bullet_w;
-                    point_area.x2 = (int32_t)points[j].x + bullet_w;
-                    point_area.y1 = (int32_t)points[j].y - bullet_h;
-                    point_area.y2 = (int32_t)points[j].y + bullet_h;
-
-                    lv_draw_rect(layer, &point_draw_dsc, &point_area);
-                    point_draw_dsc.base.id2--;
-                }
+
+        point_draw_dsc.bg_color = ser->color;
+        point_draw_dsc.base.id1 = line_dsc.base.id1;
+        /*Add the bullets too*/
+        if(bullet_w > 0 && bullet_h > 0) {
+            point_draw_dsc.base.id2 = i - 1; /*Start from the last rendered point*/
+            int32_t j;
+            for(j = line_dsc.point_cnt - 1; j >= 0; j--) {
+                if(points[j].y == LV_DRAW_LINE_POINT_NONE) continue;
+
+                lv_area_t point_area;
+                point_area.x1 = (int32_t)points[j].x - bullet_w;
+                point_area.x2 = (int32_t)points[j].x + bullet_w;
+                point_area.y1 = (int32_t)points[j].y - bullet_h;
+                point_area.y2 = (int32_t)points[j].y + bullet_h;
+
+                lv_draw_rect(layer, &point_draw_dsc, &point_area);
+                point_draw_dsc.base.id2--;
             }
         }
         line_dsc.base.id1--;
@@ -1174,10 +1227,120 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     if(points) lv_free(points);
 }
 
+/**
+ * Add one vertical line per X coordinate between the smallest and largest values drawn there.
+ * The min/max of `column_size` long ranges of points are cached in the series and recalculated
+ * only if a point of the range has changed, so only the new points are scanned when values are added.
+ * @param obj           pointer to a chart
+ * @param ser           pointer to the series
+ * @param line_dsc      the points are added to its `points` array
+ * @param clip_area     add lines only around this area
+ * @param x_ofs         X coordinate of the first point
+ * @param y_ofs         Y coordinate of the maximum value
+ * @param w             width of the series
+ * @param h             height of the series
+ * @param extra_space_x add lines this far outside of `clip_area` too
+ */
+static void add_crowded_lines(lv_obj_t * obj, lv_chart_series_t * ser, lv_draw_line_dsc_t * line_dsc,
+                              const lv_area_t * clip_area, int32_t x_ofs, int32_t y_ofs, int32_t w, int32_t h, int32_t extra_space_x)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    uint32_t point_cnt = chart->point_cnt;
+    int32_t min_v = chart->ymin[ser->y_axis_sec];
+    int32_t max_v = chart->ymax[ser->y_axis_sec];
+
+    uint32_t column_size = point_cnt / (uint32_t)LV_MAX(w, 1);
+    columns_update(obj, ser, column_size);
+
+    uint32_t p = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    uint32_t i = 0;
+    bool column_open = false;
+    int32_t x_prev = 0;
+    int32_t y_top = 0;
+    int32_t y_bottom = 0;
+    int32_t y_last = LV_CHART_POINT_NONE;
+
+    while(i < point_cnt) {
+        /*Take the points until the end of the column, the end of the array, or the last point*/
+        uint32_t len = column_size - p % column_size;
+        if(p + len > point_cnt) len = point_cnt - p;
+        if(i + len > point_cnt) len = point_cnt - i;
+
+        uint32_t first = p;
+        i += len;
+        p += len;
+        if(p == point_cnt) p = 0;
+
+        int32_t x = (int32_t)(((int64_t)w * (i - 1)) / (point_cnt - 1)) + x_ofs;
+        if(x < clip_area->x1 - extra_space_x - 1) continue;
+        if(x > clip_area->x2 + extra_space_x + 1) break;
+
+        lv_chart_column_t col_tmp;
+        lv_chart_column_t * col;
+        if(ser->columns && len == column_size && first / column_size < ser->column_cnt) {
+            col = &ser->columns[first / column_size];
+            if(col->dirty) column_scan(ser->y_points, first, first + len, col);
+        }
+        else {
+            col = &col_tmp;
+            column_scan(ser->y_points, first, first + len, col);
+        }
+
+        /*Break the line on the missing points*/
+        if(col->min == LV_CHART_POINT_NONE) {
+            y_last = LV_CHART_POINT_NONE;
+            continue;
+        }
+
+        int32_t y1 = lv_map(col->max, min_v, max_v, y_ofs + h, y_ofs);
+        int32_t y2 = lv_map(col->min, min_v, max_v, y_ofs + h, y_ofs);
+        /*Connect to the last value of the previous points*/
+        if(y_last != LV_CHART_POINT_NONE) {
+            y1 = LV_MIN(y1, y_last);
+            y2 = LV_MAX(y2, y_last);
+        }
+        y_last = col->last == LV_CHART_POINT_NONE ? LV_CHART_POINT_NONE : lv_map(col->last, min_v, max_v, y_ofs + h, y_ofs);
+
+        if(column_open && x == x_prev) {
+            y_top = LV_MIN(y_top, y1);
+            y_bottom = LV_MAX(y_bottom, y2);
+            continue;
+        }
+
+        if(column_open) {
+            lv_point_precise_t * points = &line_dsc->points[line_dsc->point_cnt];
+            points[0].x = x_prev;
+            points[0].y = y_top;
+            points[1].x = x_prev;
+            points[1].y = y_bottom == y_top ? y_bottom + 1 : y_bottom; /*If they are the same no line would be drawn*/
+            points[2].x = x_prev;
+            points[2].y = LV_DRAW_LINE_POINT_NONE;
+            line_dsc->point_cnt += 3;
+        }
+
+        column_open = true;
+        x_prev = x;
+        y_top = y1;
+        y_bottom = y2;
+    }
+
+    if(column_open) {
+        lv_point_precise_t * points = &line_dsc->points[line_dsc->point_cnt];
+        points[0].x = x_prev;
+        points[0].y = y_top;
+        points[1].x = x_prev;
+        points[1].y = y_bottom == y_top ? y_bottom + 1 : y_bottom;
+        points[2].x = x_prev;
+        points[2].y = LV_DRAW_LINE_POINT_NONE;
+        line_dsc->point_cnt += 3;
+    }
+}
+
 
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 {
     lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->point_cnt == 0) return;
 
     uint32_t i;
     int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
@@ -1206,6 +1369,15 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
     if(LV_MIN(point_w, point_h) > line_dsc.width / 2) line_dsc.raw_end = 1;
     if(line_dsc.width == 1) line_dsc.raw_end = 1;
 
+    /*Draw all points of a series with one line draw task instead of a task per segment*/
+    lv_point_precise_t * points = lv_malloc(chart->point_cnt * sizeof(lv_point_precise_t));
+    if(points == NULL) {
+        LV_LOG_WARN("Couldn't allocate the points array");
+        return;
+    }
+    line_dsc.points = points;
+    line_dsc.point_cnt = chart->point_cnt;
+
     /*Go through all data lines*/
     LV_LL_READ_BACK(&chart->series_ll, ser) {
         if(ser->hidden) continue;
@@ -1214,79 +1386,45 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
-        line_dsc.p1.x = x_ofs;
-        line_dsc.p2.x = x_ofs;
-
-        int32_t p_act = start_point;
-        int32_t p_prev = start_point;
-        if(ser->y_points[p_act] != LV_CHART_POINT_CNT_DEF) {
-            line_dsc.p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
-            line_dsc.p2.x += x_ofs;
-
-            line_dsc.p2.y = lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
-            line_dsc.p2.y = h - line_dsc.p2.y;
-            line_dsc.p2.y += y_ofs;
-        }
-        else {
-            line_dsc.p2.x = (lv_value_precise_t)LV_COORD_MIN;
-            line_dsc.p2.y = (lv_value_precise_t)LV_COORD_MIN;
-        }
-
         for(i = 0; i < chart->point_cnt; i++) {
-            line_dsc.p1.x = line_dsc.p2.x;
-            line_dsc.p1.y = line_dsc.p2.y;
-
-            p_act = (start_point + i) % chart->point_cnt;
-            if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                line_dsc.p2.y =  lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
-                line_dsc.p2.y = h - line_dsc.p2.y;
-                line_dsc.p2.y += y_ofs;
-
-                line_dsc.p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
-                line_dsc.p2.x += x_ofs;
-            }
-            else {
-                p_prev = p_act;
+            int32_t p_act = (start_point + i) % chart->point_cnt;
+            if(ser->y_points[p_act] == LV_CHART_POINT_NONE) {
+                points[i].x = LV_DRAW_LINE_POINT_NONE;
+                points[i].y = LV_DRAW_LINE_POINT_NONE;
                 continue;
             }
 
-            if(i != 0) { /*Don't draw line *to* the first point.*/
-                lv_area_t point_area;
-                point_area.x1 = (int32_t)line_dsc.p1.x - point_w;
-                point_area.x2 = (int32_t)line_dsc.p1.x + point_w;
-                point_area.y1 = (int32_t)line_dsc.p1.y - point_h;
-                point_area.y2 = (int32_t)line_dsc.p1.y + point_h;
-
-                if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                    line_dsc.base.id2 = i - 1;
-                    lv_draw_line(layer, &line_dsc);
-                    if(point_w && point_h) {
-                        point_dsc_default.base.id2 = i - 1;
-                        lv_draw_rect(layer, &point_dsc_default, &point_area);
-                    }
-                }
+            points[i].y = lv_map(ser->y_points[p_act], chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
+            points[i].y = h - points[i].y;
+            points[i].y += y_ofs;
 
-                p_prev = p_act;
-            }
+            points[i].x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
+            points[i].x += x_ofs;
+        }
 
-            /*Draw the last point*/
-            if(i == chart->point_cnt - 1) {
+        line_dsc.base.id2 = 0;
+        lv_draw_line(layer, &line_dsc);
 
-                if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                    lv_area_t point_area;
-                    point_area.x1 = (int32_t)line_dsc.p2.x - point_w;
-                    point_area.x2 = (int32_t)line_dsc.p2.x + point_w;
-                    point_area.y1 = (int32_t)line_dsc.p2.y - point_h;
-                    point_area.y2 = (int32_t)line_dsc.p2.y + point_h;
+        if(point_w && point_h) {
+            for(i = 0; i < chart->point_cnt; i++) {
+                if(points[i].y == LV_DRAW_LINE_POINT_NONE) continue;
 
-                    point_dsc_default.base.id2 = i;
-                    lv_draw_rect(layer, &point_dsc_default, &point_area);
-                }
+                lv_area_t point_area;
+                point_area.x1 = (int32_t)points[i].x - point_w;
+                point_area.x2 = (int32_t)points[i].x + point_w;
+                point_area.y1 = (int32_t)points[i].y - point_h;
+                point_area.y2 = (int32_t)points[i].y + point_h;
+
+                point_dsc_default.base.id2 = i;
+                lv_draw_rect(layer, &point_dsc_default, &point_area);
             }
         }
+
         line_dsc.base.id1++;
         point_dsc_default.base.id1++;
     }
+
+    lv_free(points);
 }
 
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer)
@@ -1736,4 +1874,137 @@ static int32_t value_to_y(lv_obj_t * obj, lv_chart_series_t * ser, int32_t v, in
     return lv_map(v, chart->ymin[ser->y_axis_sec], chart->ymax[ser->y_axis_sec], 0, h);
 }
 
+/**
+ * Allocate the cached columns of a series if the column size or the number of points has changed
+ * @param obj           pointer to a chart
+ * @param ser           pointer to the series
+ * @param column_size   number of points in a column
+ */
+static void columns_update(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t column_size)
+{
+    lv_chart_t * chart = (lv_chart_t *) obj;
+    uint32_t column_cnt = chart->point_cnt / column_size;
+    if(ser->column_size == column_size && ser->column_cnt == column_cnt) return;
+
+    if(ser->column_cnt != column_cnt) {
+        lv_free(ser->columns);
+        ser->columns = lv_malloc(column_cnt * sizeof(lv_chart_column_t));
+        LV_ASSERT_MALLOC(ser->columns);
+        if(ser->columns == NULL) {
+            ser->column_cnt = 0;
+            ser->column_size = 0;
+            return;
+        }
+        ser->column_cnt = column_cnt;
+    }
+
+    ser->column_size = column_size;
+
+    uint32_t i;
+    for(i = 0; i < column_cnt; i++) {
+        ser->columns[i].dirty = 1;
+    }
+}
+
+/**
+ * Get the smallest, largest, and last value of a range of points
+ * @param points    the points of a series
+ * @param from      index of the first point
+ * @param to        index after the last point
+ * @param col       store the result here
+ */
+static void column_scan(const int32_t * points, uint32_t from, uint32_t to, lv_chart_column_t * col)
+{
+    col->min = LV_CHART_POINT_NONE;
+    col->max = LV_CHART_POINT_NONE;
+
+    uint32_t i;
+    for(i = from; i < to; i++) {
+        int32_t v = points[i];
+        if(v == LV_CHART_POINT_NONE) continue;
+        if(col->min == LV_CHART_POINT_NONE) {
+            col->min = v;
+            col->max = v;
+        }
+        else {
+            col->min = LV_MIN(col->min, v);
+            col->max = LV_MAX(col->max, v);
+        }
+    }
+
+    col->last = points[to - 1];
+    col->dirty = 0;
+}
+
+static void column_mark_dirty(lv_chart_series_t * ser, uint32_t id)
+{
+    if(ser->column_size == 0) return;
+
+    uint32_t col_id = id / ser->column_size;
+    if(col_id < ser->column_cnt) ser->columns[col_id].dirty = 1;
+}
+
+/**
+ * Add the values pushed to the streams as `lv_chart_set_next_value()` but invalidate only once
+ * @param t     pointer to the timer of the chart
+ */
+static void stream_timer_cb(lv_timer_t * t)
+{
+    lv_obj_t * obj = lv_timer_get_user_data(t);
+    lv_chart_t * chart = (lv_chart_t *)obj;
+    bool has_stream = false;
+
+    lv_chart_series_t * ser;
+    LV_LL_READ_BACK(&chart->series_ll, ser) {
+        lv_chart_stream_t * stream = ser->stream;
+        if(stream == NULL) continue;
+        has_stream = true;
+
+        uint32_t write_cnt = stream->write_cnt;
+        STREAM_MEMORY_BARRIER();    /*Read the values only after the counter*/
+        uint32_t read_cnt = stream->read_cnt;
+        uint32_t cnt = write_cnt - read_cnt;
+        if(cnt == 0) continue;
+
+        uint32_t first_id = ser->start_point;
+        for(; read_cnt != write_cnt; read_cnt++) {
+            ser->y_points[ser->start_point] = stream->buf[read_cnt & (stream->size - 1)];
+            column_mark_dirty(ser, ser->start_point);
+            ser->start_point = (ser->start_point + 1) % chart->point_cnt;
+        }
+        STREAM_MEMORY_BARRIER();    /*Let the values be overwritten only after they are read*/
+        stream->read_cnt = read_cnt;
+
+        /*In shift mode all points move, else invalidate only around the new points*/
+        if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT || cnt >= chart->point_cnt) {
+            lv_obj_invalidate(obj);
+        }
+        else {
+            uint32_t i;
+            for(i = 0; i < cnt; i++) {
+                invalidate_point(obj, (first_id + i) % chart->point_cnt);
+            }
+        }
+    }
+
+    if(!has_stream) {
+        lv_timer_delete(t);
+        chart->stream_timer = NULL;
+    }
+}
+
+static void series_free_caches(lv_chart_series_t * ser)
+{
+    lv_free(ser->columns);
+    ser->columns = NULL;
+    ser->column_cnt = 0;
+    ser->column_size = 0;
+
+    if(ser->stream) {
+        lv_free(ser->stream->buf);
+        lv_free(ser->stream);
+        ser->stream = NULL;
+    }
+}
+
 #endif
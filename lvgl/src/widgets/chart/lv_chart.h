@@ -362,6 +362,27 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
  */
 void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, int32_t x_value, int32_t y_value);
 
+/**
+ * Create a buffer for a series where values can be pushed from an other thread by `lv_chart_push_stream_value()`.
+ * The chart reads the pushed values in every `LV_DEF_REFR_PERIOD` ms and adds them as `lv_chart_set_next_value()`,
+ * but invalidates the chart only once for all the new values.
+ * Set it before the other thread starts pushing values.
+ * @param obj       pointer to chart object
+ * @param ser       pointer to a data series on 'chart'
+ * @param capacity  number of values that can be pushed between two reads (rounded up to a power of 2).
+ *                  0: delete the buffer
+ */
+void lv_chart_set_series_stream(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t capacity);
+
+/**
+ * Push a value to the stream buffer of a series. It can be called from an other thread without `lv_lock()`,
+ * but only from one thread per series.
+ * @param ser       pointer to a data series with a stream buffer
+ * @param value     the new value
+ * @return          LV_RESULT_OK: the value is pushed; LV_RESULT_INVALID: the buffer is full or there is no buffer
+ */
+lv_result_t lv_chart_push_stream_value(lv_chart_series_t * ser, int32_t value);
+
 /**
  * Same as `lv_chart_set_next_value` but set the values from an array
  * @param obj           pointer to chart object
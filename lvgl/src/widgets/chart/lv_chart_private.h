@@ -27,12 +27,36 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Smallest, largest and last value of `column_size` consecutive points of a series
+ */
+typedef struct {
+    int32_t min;                /**< LV_CHART_POINT_NONE if all points are LV_CHART_POINT_NONE */
+    int32_t max;
+    int32_t last;
+    uint32_t dirty : 1;         /**< 1: the points have changed since `min`, `max`, and `last` were calculated */
+} lv_chart_column_t;
+
+/**
+ * Single producer, single consumer ring buffer to push values into a series from an other thread
+ */
+typedef struct {
+    int32_t * buf;
+    uint32_t size;                  /**< Always a power of 2 */
+    volatile uint32_t write_cnt;    /**< Written only by the pushing thread */
+    volatile uint32_t read_cnt;     /**< Written only by the chart */
+} lv_chart_stream_t;
+
 /**
  * Descriptor a chart series
  */
 struct _lv_chart_series_t {
     int32_t * x_points;
     int32_t * y_points;
+    lv_chart_column_t * columns;    /**< Cached min/max of the points to draw crowded line charts */
+    uint32_t column_cnt;
+    uint32_t column_size;           /**< Number of points in a column. 0: `columns` needs to be recalculated */
+    lv_chart_stream_t * stream;     /**< Set by `lv_chart_set_series_stream()` */
     lv_color_t color;
     uint32_t start_point;
     uint32_t hidden : 1;
@@ -63,6 +87,7 @@ struct _lv_chart_t {
     uint32_t hdiv_cnt;          /**< Number of horizontal division lines */
     uint32_t vdiv_cnt;          /**< Number of vertical division lines */
     uint32_t point_cnt;         /**< Number of points in all series */
+    lv_timer_t * stream_timer;  /**< Reads the streams of the series */
     lv_chart_type_t type  : 4;  /**< Chart type */
     lv_chart_update_mode_t update_mode : 2;
 };
@@ -17,6 +17,11 @@
 #include "../../misc/lv_text_private.h"
 #include "../../core/lv_observer_private.h"
 #include "../../draw/lv_draw_arc.h"
+#include "../../draw/lv_draw_private.h"
+#include "../../core/lv_obj_draw_private.h"
+#include "../../core/lv_refr_private.h"
+#include "../../display/lv_display_private.h"
+#include "../../misc/cache/instance/lv_image_cache.h"
 
 /*********************
  *      DEFINES
@@ -41,9 +46,14 @@ static void lv_scale_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 static void lv_scale_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_scale_event(const lv_obj_class_t * class_p, lv_event_t * event);
 
-static void scale_draw_main(lv_obj_t * obj, lv_event_t * event);
-static void scale_draw_indicator(lv_obj_t * obj, lv_event_t * event);
-static void scale_draw_label(lv_obj_t * obj, lv_event_t * event, lv_draw_label_dsc_t * label_dsc,
+static void scale_draw(lv_obj_t * obj, lv_layer_t * layer);
+static void scale_draw_cached(lv_obj_t * obj, lv_layer_t * layer);
+static void scale_render_static_cache(lv_obj_t * obj, const lv_area_t * cache_area);
+static void scale_invalidate(lv_obj_t * obj);
+static uint32_t scale_get_style_hash(lv_obj_t * obj);
+static void scale_draw_main(lv_obj_t * obj, lv_layer_t * layer);
+static void scale_draw_indicator(lv_obj_t * obj, lv_layer_t * layer);
+static void scale_draw_label(lv_obj_t * obj, lv_layer_t * layer, lv_draw_label_dsc_t * label_dsc,
                              const uint32_t major_tick_idx, const int32_t tick_value, lv_point_t * tick_point_b, const uint32_t tick_idx);
 static void scale_calculate_main_compensation(lv_obj_t * obj);
 
@@ -174,7 +184,7 @@ void lv_scale_set_mode(lv_obj_t * obj, lv_scale_mode_t mode)
 
     scale->mode = mode;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_total_tick_count(lv_obj_t * obj, uint32_t total_tick_count)
@@ -184,7 +194,7 @@ void lv_scale_set_total_tick_count(lv_obj_t * obj, uint32_t total_tick_count)
 
     scale->total_tick_count = total_tick_count;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_major_tick_every(lv_obj_t * obj, uint32_t major_tick_every)
@@ -194,7 +204,7 @@ void lv_scale_set_major_tick_every(lv_obj_t * obj, uint32_t major_tick_every)
 
     scale->major_tick_every = major_tick_every;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_label_show(lv_obj_t * obj, bool show_label)
@@ -204,7 +214,7 @@ void lv_scale_set_label_show(lv_obj_t * obj, bool show_label)
 
     scale->label_enabled = show_label;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_range(lv_obj_t * obj, int32_t min, int32_t max)
@@ -215,7 +225,7 @@ void lv_scale_set_range(lv_obj_t * obj, int32_t min, int32_t max)
     scale->range_min = min;
     scale->range_max = max;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_min_value(lv_obj_t * obj, int32_t min)
@@ -225,7 +235,7 @@ void lv_scale_set_min_value(lv_obj_t * obj, int32_t min)
     if(scale->range_min == min) return;
     scale->range_min = min;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_max_value(lv_obj_t * obj, int32_t max)
@@ -235,7 +245,7 @@ void lv_scale_set_max_value(lv_obj_t * obj, int32_t max)
     if(scale->range_max == max) return;
     scale->range_max = max;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_angle_range(lv_obj_t * obj, uint32_t angle_range)
@@ -245,7 +255,7 @@ void lv_scale_set_angle_range(lv_obj_t * obj, uint32_t angle_range)
 
     scale->angle_range = angle_range;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_rotation(lv_obj_t * obj, int32_t rotation)
@@ -263,7 +273,7 @@ void lv_scale_set_rotation(lv_obj_t * obj, int32_t rotation)
     }
 
     scale->rotation = normalized_angle;
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_line_needle_value(lv_obj_t * obj, lv_obj_t * needle_line, int32_t needle_length,
@@ -388,7 +398,7 @@ void lv_scale_set_text_src(lv_obj_t * obj, const char * txt_src[])
         }
     }
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_post_draw(lv_obj_t * obj, bool en)
@@ -398,7 +408,23 @@ void lv_scale_set_post_draw(lv_obj_t * obj, bool en)
 
     scale->post_draw = en;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
+}
+
+void lv_scale_set_static_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_scale_t * scale = (lv_scale_t *)obj;
+
+    scale->static_cache_en = en;
+
+    if(!en && scale->static_cache) {
+        lv_image_cache_drop(scale->static_cache);
+        lv_draw_buf_destroy(scale->static_cache);
+        scale->static_cache = NULL;
+    }
+
+    scale_invalidate(obj);
 }
 
 void lv_scale_set_draw_ticks_on_top(lv_obj_t * obj, bool en)
@@ -408,7 +434,7 @@ void lv_scale_set_draw_ticks_on_top(lv_obj_t * obj, bool en)
 
     scale->draw_ticks_on_top = en;
 
-    lv_obj_invalidate(obj);
+    scale_invalidate(obj);
 }
 
 lv_scale_section_t * lv_scale_add_section(lv_obj_t * obj)
@@ -448,7 +474,7 @@ void lv_scale_set_section_min_value(lv_obj_t * scale, lv_scale_section_t * secti
 
     if(section->range_min == min) return;
     section->range_min = min;
-    lv_obj_invalidate(scale);
+    scale_invalidate(scale);
 }
 
 void lv_scale_set_section_max_value(lv_obj_t * scale, lv_scale_section_t * section, int32_t max)
@@ -458,7 +484,7 @@ void lv_scale_set_section_max_value(lv_obj_t * scale, lv_scale_section_t * secti
 
     if(section->range_max == max) return;
     section->range_max = max;
-    lv_obj_invalidate(scale);
+    scale_invalidate(scale);
 }
 
 void lv_scale_section_set_range(lv_scale_section_t * section, int32_t min, int32_t max)
@@ -476,7 +502,7 @@ void lv_scale_set_section_style_main(lv_obj_t * scale, lv_scale_section_t * sect
     LV_ASSERT_NULL(section);
 
     section->main_style = style;
-    lv_obj_invalidate(scale);
+    scale_invalidate(scale);
 }
 
 void lv_scale_set_section_style_indicator(lv_obj_t * scale, lv_scale_section_t * section, const lv_style_t * style)
@@ -485,7 +511,7 @@ void lv_scale_set_section_style_indicator(lv_obj_t * scale, lv_scale_section_t *
     LV_ASSERT_NULL(section);
 
     section->indicator_style = style;
-    lv_obj_invalidate(scale);
+    scale_invalidate(scale);
 }
 
 void lv_scale_set_section_style_items(lv_obj_t * scale, lv_scale_section_t * section, const lv_style_t * style)
@@ -494,7 +520,7 @@ void lv_scale_set_section_style_items(lv_obj_t * scale, lv_scale_section_t * sec
     LV_ASSERT_NULL(section);
 
     section->items_style = style;
-    lv_obj_invalidate(scale);
+    scale_invalidate(scale);
 }
 
 void lv_scale_section_set_style(lv_scale_section_t * section, lv_part_t part, lv_style_t * section_part_style)
@@ -559,6 +585,14 @@ uint32_t lv_scale_get_angle_range(lv_obj_t * obj)
     return scale->angle_range;
 }
 
+bool lv_scale_get_static_cache(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_scale_t * scale = (lv_scale_t *)obj;
+
+    return scale->static_cache_en;
+}
+
 int32_t lv_scale_get_range_min_value(lv_obj_t * obj)
 {
     lv_scale_t * scale = (lv_scale_t *)obj;
@@ -638,6 +672,9 @@ static void lv_scale_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     scale->draw_ticks_on_top = false;
     scale->custom_label_cnt = 0;
     scale->txt_src = NULL;
+    scale->static_cache = NULL;
+    scale->static_cache_en = false;
+    scale->static_cache_valid = false;
     lv_array_init(&scale->needles, 0, sizeof(lv_scale_needle_t));
 
     lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
@@ -666,6 +703,12 @@ static void lv_scale_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     }
     lv_array_deinit(&scale->needles);
 
+    if(scale->static_cache) {
+        lv_image_cache_drop(scale->static_cache);
+        lv_draw_buf_destroy(scale->static_cache);
+        scale->static_cache = NULL;
+    }
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -682,35 +725,16 @@ static void lv_scale_event(const lv_obj_class_t * class_p, lv_event_t * event)
     lv_scale_t * scale = (lv_scale_t *) obj;
     LV_UNUSED(scale);
 
-    if(event_code == LV_EVENT_DRAW_MAIN) {
-        if(scale->post_draw == false) {
-            scale_find_section_tick_idx(obj);
-            scale_calculate_main_compensation(obj);
-
-            if(scale->draw_ticks_on_top) {
-                scale_draw_main(obj, event);
-                scale_draw_indicator(obj, event);
-            }
-            else {
-                scale_draw_indicator(obj, event);
-                scale_draw_main(obj, event);
-            }
+    if(event_code == LV_EVENT_DRAW_MAIN || event_code == LV_EVENT_DRAW_POST) {
+        bool post = event_code == LV_EVENT_DRAW_POST;
+        if(scale->post_draw == post) {
+            lv_layer_t * layer = lv_event_get_layer(event);
+            if(scale->static_cache_en) scale_draw_cached(obj, layer);
+            else scale_draw(obj, layer);
         }
     }
-    if(event_code == LV_EVENT_DRAW_POST) {
-        if(scale->post_draw == true) {
-            scale_find_section_tick_idx(obj);
-            scale_calculate_main_compensation(obj);
-
-            if(scale->draw_ticks_on_top) {
-                scale_draw_main(obj, event);
-                scale_draw_indicator(obj, event);
-            }
-            else {
-                scale_draw_indicator(obj, event);
-                scale_draw_main(obj, event);
-            }
-        }
+    else if(event_code == LV_EVENT_SIZE_CHANGED) {
+        scale->static_cache_valid = 0;
     }
     else if(event_code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
         /* NOTE: Extend scale draw size so the first tick label can be shown */
@@ -733,10 +757,180 @@ static void lv_scale_event(const lv_obj_class_t * class_p, lv_event_t * event)
     }
 }
 
-static void scale_draw_indicator(lv_obj_t * obj, lv_event_t * event)
+/**
+ * Draw the ticks, labels, main line and sections
+ * @param obj       pointer to a scale object
+ * @param layer     draw to this layer
+ */
+static void scale_draw(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_scale_t * scale = (lv_scale_t *)obj;
+
+    scale_find_section_tick_idx(obj);
+    scale_calculate_main_compensation(obj);
+
+    if(scale->draw_ticks_on_top) {
+        scale_draw_main(obj, layer);
+        scale_draw_indicator(obj, layer);
+    }
+    else {
+        scale_draw_indicator(obj, layer);
+        scale_draw_main(obj, layer);
+    }
+}
+
+/**
+ * Draw the cached image of the ticks, labels, main line and sections. Render it first if needed.
+ * @param obj       pointer to a scale object
+ * @param layer     draw to this layer
+ */
+static void scale_draw_cached(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_scale_t * scale = (lv_scale_t *)obj;
+
+    lv_area_t cache_area;
+    lv_obj_get_coords(obj, &cache_area);
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&cache_area, ext_size, ext_size);
+    int32_t w = lv_area_get_width(&cache_area);
+    int32_t h = lv_area_get_height(&cache_area);
+
+    if(scale->static_cache && (scale->static_cache->header.w != w || scale->static_cache->header.h != h)) {
+        lv_image_cache_drop(scale->static_cache);
+        lv_draw_buf_destroy(scale->static_cache);
+        scale->static_cache = NULL;
+    }
+
+    if(scale->static_cache == NULL) {
+        scale->static_cache = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        if(scale->static_cache == NULL) {
+            LV_LOG_WARN("Couldn't allocate the static cache, drawing directly");
+            scale_draw(obj, layer);
+            return;
+        }
+        scale->static_cache_valid = false;
+    }
+
+    /*Not all style changes are reported to the widget so check the used style properties too*/
+    uint32_t style_hash = scale_get_style_hash(obj);
+    if(!scale->static_cache_valid || scale->static_cache_style_hash != style_hash) {
+        scale_render_static_cache(obj, &cache_area);
+        scale->static_cache_valid = true;
+        scale->static_cache_style_hash = style_hash;
+    }
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.base.layer = layer;
+    img_dsc.src = scale->static_cache;
+    lv_draw_image(layer, &img_dsc, &cache_area);
+}
+
+/**
+ * Render the ticks, labels, main line and sections to `static_cache` and wait until it's ready.
+ * @param obj           pointer to a scale object
+ * @param cache_area    the absolute coordinates of `static_cache`
+ */
+static void scale_render_static_cache(lv_obj_t * obj, const lv_area_t * cache_area)
+{
+    lv_scale_t * scale = (lv_scale_t *)obj;
+
+    /*The old content might be cached by the image decoders*/
+    lv_image_cache_drop(scale->static_cache);
+    lv_draw_buf_clear(scale->static_cache, NULL);
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = scale->static_cache;
+    layer.buf_area = *cache_area;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer._clip_area = *cache_area;
+    layer.phy_clip_area = *cache_area;
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_CREATED, &layer);
+
+    /*Dispatch only the tasks of the new layer like `lv_snapshot_take_to_draw_buf()`*/
+    lv_display_t * disp_old = lv_refr_get_disp_refreshing();
+    lv_display_t * disp = lv_obj_get_display(obj);
+    lv_layer_t * layer_old = disp->layer_head;
+    disp->layer_head = &layer;
+    lv_refr_set_disp_refreshing(disp);
+
+    scale_draw(obj, &layer);
+
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    disp->layer_head = layer_old;
+    lv_refr_set_disp_refreshing(disp_old);
+
+    lv_draw_unit_send_event(NULL, LV_EVENT_CHILD_DELETED, &layer);
+}
+
+/**
+ * Invalidate the scale and its static cache
+ * @param obj       pointer to a scale object
+ */
+static void scale_invalidate(lv_obj_t * obj)
+{
+    lv_scale_t * scale = (lv_scale_t *)obj;
+    scale->static_cache_valid = false;
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * Get a hash of the draw descriptors and style properties used to draw the scale
+ * @param obj       pointer to a scale object
+ * @return          FNV-1a hash of the styles
+ */
+static uint32_t scale_get_style_hash(lv_obj_t * obj)
+{
+    static const lv_part_t parts[] = {LV_PART_MAIN, LV_PART_ITEMS, LV_PART_INDICATOR};
+
+    /*Hash the descriptors byte by byte. They are zeroed by their init functions so there is no garbage in them.*/
+    struct {
+        lv_draw_line_dsc_t line_dsc[3];
+        int32_t props[3][10];
+        lv_draw_label_dsc_t label_dsc;
+        lv_draw_arc_dsc_t arc_dsc;
+    } styles;
+    lv_memzero(&styles, sizeof(styles));
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_draw_line_dsc_init(&styles.line_dsc[i]);
+        lv_obj_init_draw_line_dsc(obj, parts[i], &styles.line_dsc[i]);
+        styles.props[i][0] = lv_obj_get_style_length(obj, parts[i]);
+        styles.props[i][1] = lv_obj_get_style_pad_top(obj, parts[i]);
+        styles.props[i][2] = lv_obj_get_style_pad_bottom(obj, parts[i]);
+        styles.props[i][3] = lv_obj_get_style_pad_left(obj, parts[i]);
+        styles.props[i][4] = lv_obj_get_style_pad_right(obj, parts[i]);
+        styles.props[i][5] = lv_obj_get_style_pad_radial(obj, parts[i]);
+        styles.props[i][6] = lv_obj_get_style_radial_offset(obj, parts[i]);
+        styles.props[i][7] = lv_obj_get_style_translate_radial(obj, parts[i]);
+        styles.props[i][8] = lv_obj_get_style_transform_rotation(obj, parts[i]);
+        styles.props[i][9] = lv_obj_get_style_border_width(obj, parts[i]);
+    }
+
+    lv_draw_label_dsc_init(&styles.label_dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_INDICATOR, &styles.label_dsc);
+    lv_draw_arc_dsc_init(&styles.arc_dsc);
+    lv_obj_init_draw_arc_dsc(obj, LV_PART_MAIN, &styles.arc_dsc);
+
+    const uint8_t * bytes = (const uint8_t *)&styles;
+    uint32_t hash = 2166136261u;
+    for(i = 0; i < sizeof(styles); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+static void scale_draw_indicator(lv_obj_t * obj, lv_layer_t * layer)
 {
     lv_scale_t * scale = (lv_scale_t *)obj;
-    lv_layer_t * layer = lv_event_get_layer(event);
 
     if(scale->total_tick_count <= 1) return;
 
@@ -812,7 +1006,7 @@ static void scale_draw_indicator(lv_obj_t * obj, lv_event_t * event)
 
         /* Setup a label if they're enabled and we're drawing a major tick */
         if(scale->label_enabled && is_major_tick) {
-            scale_draw_label(obj, event, &label_dsc, major_tick_idx, tick_value, &tick_point_b, tick_idx);
+            scale_draw_label(obj, layer, &label_dsc, major_tick_idx, tick_value, &tick_point_b, tick_idx);
         }
 
         if(is_major_tick) {
@@ -832,12 +1026,11 @@ static void scale_draw_indicator(lv_obj_t * obj, lv_event_t * event)
     }
 }
 
-static void scale_draw_label(lv_obj_t * obj, lv_event_t * event, lv_draw_label_dsc_t * label_dsc,
+static void scale_draw_label(lv_obj_t * obj, lv_layer_t * layer, lv_draw_label_dsc_t * label_dsc,
                              const uint32_t major_tick_idx, const int32_t tick_value, lv_point_t * tick_point_b,
                              const uint32_t tick_idx)
 {
     lv_scale_t * scale = (lv_scale_t *)obj;
-    lv_layer_t * layer = lv_event_get_layer(event);
 
     /* Label text setup */
     char text_buffer[LV_SCALE_LABEL_TXT_LEN] = {0};
@@ -1013,10 +1206,9 @@ static void scale_calculate_main_compensation(lv_obj_t * obj)
     }
 }
 
-static void scale_draw_main(lv_obj_t * obj, lv_event_t * event)
+static void scale_draw_main(lv_obj_t * obj, lv_layer_t * layer)
 {
     lv_scale_t * scale = (lv_scale_t *)obj;
-    lv_layer_t * layer = lv_event_get_layer(event);
 
     if(scale->total_tick_count <= 1) return;
 
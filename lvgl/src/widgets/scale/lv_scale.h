@@ -224,6 +224,16 @@ void lv_scale_set_post_draw(lv_obj_t * obj, bool en);
  */
 void lv_scale_set_draw_ticks_on_top(lv_obj_t * obj, bool en);
 
+/**
+ * Render the ticks, labels and sections only once into an image and draw only this image later.
+ * It makes redrawing the Scale much faster (e.g. when only a needle moves) but the image
+ * needs an ARGB8888 buffer with the size of the Scale plus its extra draw size.
+ * The image is rendered again when the Scale's properties, styles, state, or size change.
+ * @param obj       pointer to Scale Widget
+ * @param en        true: enable the cached image; false: delete the image and draw directly again
+ */
+void lv_scale_set_static_cache(lv_obj_t * obj, bool en);
+
 /**
  * Add a Section to specified Scale.  Section will not be drawn until
  * a valid range is set for it using `lv_scale_set_section_range()`.
@@ -338,6 +348,13 @@ int32_t lv_scale_get_rotation(lv_obj_t * obj);
  */
 bool lv_scale_get_label_show(lv_obj_t * obj);
 
+/**
+ * Get whether the ticks, labels and sections are drawn from a cached image
+ * @param obj   pointer to Scale Widget
+ * @return      true if the static cache is enabled
+ */
+bool lv_scale_get_static_cache(lv_obj_t * obj);
+
 /**
  * Get Scale's range in degrees
  * @param obj   pointer to Scale Widget
@@ -75,6 +75,8 @@ struct _lv_scale_t {
     uint32_t post_draw          : 1;   /**< false: drawing occurs during LV_EVENT_DRAW_MAIN;
                                         *   true : drawing occurs during LV_EVENT_DRAW_POST. */
     uint32_t draw_ticks_on_top  : 1;   /**< Draw ticks on top of main line? */
+    uint32_t static_cache_en    : 1;   /**< Draw ticks, labels and sections from `static_cache`? */
+    uint32_t static_cache_valid : 1;   /**< false: `static_cache` needs to be rendered again */
     /* Round scale */
     uint32_t angle_range;              /**< Degrees between low end and high end of scale */
     int32_t rotation;                  /**< Clockwise angular offset from 3-o'clock position of low end of scale */
@@ -83,6 +85,8 @@ struct _lv_scale_t {
     int32_t last_tick_width;           /**< Width of last tick in pixels */
     int32_t first_tick_width;          /**< Width of first tick in pixels */
     lv_array_t needles;                /**< Needle list of this scale */
+    lv_draw_buf_t * static_cache;      /**< Ticks, labels and sections rendered once if `static_cache_en` is set */
+    uint32_t static_cache_style_hash;  /**< Hash of the styles used to render `static_cache` */
 };
 
 
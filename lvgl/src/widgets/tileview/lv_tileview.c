@@ -10,11 +10,22 @@
 #include "../../core/lv_obj_class_private.h"
 #include "../../indev/lv_indev.h"
 #include "../../indev/lv_indev_private.h"
+#include "../../core/lv_refr_private.h"
+#include "../../core/lv_obj_draw_private.h"
+#include "../../misc/lv_area_private.h"
+#include "../../draw/snapshot/lv_snapshot.h"
+#include "../../draw/lv_draw_image.h"
+#include "../../misc/cache/instance/lv_image_cache.h"
 #if LV_USE_TILEVIEW
 
 /*********************
  *      DEFINES
  *********************/
+#define MY_CLASS (&lv_tileview_class)
+#define MY_TILE_CLASS (&lv_tileview_tile_class)
+
+/*The live widgets hidden for the snapshot are tracked in a 32 bit mask*/
+#define LIVE_WIDGET_MAX 32
 
 /**********************
  *      TYPEDEFS
@@ -26,6 +37,15 @@
 static void lv_tileview_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_tileview_tile_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void tileview_event_cb(lv_event_t * e);
+#if LV_USE_SNAPSHOT
+    static void lv_tileview_tile_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+    static void lv_tileview_tile_event(const lv_obj_class_t * class_p, lv_event_t * e);
+    static void tile_draw_snapshot(lv_obj_t * obj, lv_layer_t * layer);
+    static void tiles_snapshot_take(lv_obj_t * obj);
+    static void tiles_snapshot_free(lv_obj_t * obj);
+    static void tile_snapshot_free(lv_obj_t * obj);
+    static void live_widget_delete_cb(lv_event_t * e);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -40,6 +60,10 @@ const lv_obj_class_t lv_tileview_class = {
 
 const lv_obj_class_t lv_tileview_tile_class = {
     .constructor_cb = lv_tileview_tile_constructor,
+#if LV_USE_SNAPSHOT
+    .destructor_cb = lv_tileview_tile_destructor,
+    .event_cb = lv_tileview_tile_event,
+#endif
     .base_class = &lv_obj_class,
     .instance_size = sizeof(lv_tileview_tile_t),
     .name = "lv_tile",
@@ -125,6 +149,76 @@ lv_obj_t * lv_tileview_get_tile_active(lv_obj_t * obj)
     return tv->tile_act;
 }
 
+#if LV_USE_SNAPSHOT
+
+void lv_tileview_set_scroll_snapshot(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_tileview_t * tv = (lv_tileview_t *) obj;
+    tv->scroll_snapshot = en;
+    if(!en) tiles_snapshot_free(obj);
+}
+
+bool lv_tileview_get_scroll_snapshot(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_tileview_t * tv = (lv_tileview_t *) obj;
+    return tv->scroll_snapshot;
+}
+
+void lv_tileview_tile_add_live_widget(lv_obj_t * obj, lv_obj_t * widget)
+{
+    LV_ASSERT_OBJ(obj, MY_TILE_CLASS);
+    LV_ASSERT_NULL(widget);
+
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)obj;
+    uint32_t i;
+    for(i = 0; i < tile->live_widget_cnt; i++) {
+        if(tile->live_widgets[i] == widget) return;
+    }
+
+    if(tile->live_widget_cnt >= LIVE_WIDGET_MAX) {
+        LV_LOG_WARN("A tile can have at most %d live widgets", LIVE_WIDGET_MAX);
+        return;
+    }
+
+    lv_obj_t ** new_widgets = lv_realloc(tile->live_widgets, (tile->live_widget_cnt + 1) * sizeof(lv_obj_t *));
+    LV_ASSERT_MALLOC(new_widgets);
+    if(new_widgets == NULL) return;
+
+    tile->live_widgets = new_widgets;
+    tile->live_widgets[tile->live_widget_cnt] = widget;
+    tile->live_widget_cnt++;
+    lv_obj_add_event_cb(widget, live_widget_delete_cb, LV_EVENT_DELETE, obj);
+
+    /*The widget is still part of the current snapshot*/
+    tile_snapshot_free(obj);
+}
+
+void lv_tileview_tile_remove_live_widget(lv_obj_t * obj, lv_obj_t * widget)
+{
+    LV_ASSERT_OBJ(obj, MY_TILE_CLASS);
+
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)obj;
+    uint32_t i;
+    for(i = 0; i < tile->live_widget_cnt; i++) {
+        if(tile->live_widgets[i] == widget) break;
+    }
+    if(i == tile->live_widget_cnt) return;
+
+    lv_memmove(&tile->live_widgets[i], &tile->live_widgets[i + 1],
+               (tile->live_widget_cnt - i - 1) * sizeof(lv_obj_t *));
+    tile->live_widget_cnt--;
+    lv_obj_remove_event_cb_with_user_data(widget, live_widget_delete_cb, obj);
+
+    /*The snapshot doesn't contain the widget*/
+    tile_snapshot_free(obj);
+}
+
+#endif /*LV_USE_SNAPSHOT*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -134,6 +228,9 @@ static void lv_tileview_constructor(const lv_obj_class_t * class_p, lv_obj_t * o
     LV_UNUSED(class_p);
     lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
     lv_obj_add_event_cb(obj, tileview_event_cb, LV_EVENT_SCROLL_END, NULL);
+#if LV_USE_SNAPSHOT
+    lv_obj_add_event_cb(obj, tileview_event_cb, LV_EVENT_SCROLL_BEGIN, NULL);
+#endif
     lv_obj_add_flag(obj, LV_OBJ_FLAG_SCROLL_ONE);
     lv_obj_set_scroll_snap_x(obj, LV_SCROLL_SNAP_CENTER);
     lv_obj_set_scroll_snap_y(obj, LV_SCROLL_SNAP_CENTER);
@@ -147,12 +244,201 @@ static void lv_tileview_tile_constructor(const lv_obj_class_t * class_p, lv_obj_
     lv_obj_update_layout(obj);  /*Be sure the size is correct*/
 }
 
+#if LV_USE_SNAPSHOT
+
+static void lv_tileview_tile_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)obj;
+
+    tile_snapshot_free(obj);
+
+    /*The live widgets moved to other parents are still alive*/
+    uint32_t i;
+    for(i = 0; i < tile->live_widget_cnt; i++) {
+        lv_obj_remove_event_cb_with_user_data(tile->live_widgets[i], live_widget_delete_cb, obj);
+    }
+    lv_free(tile->live_widgets);
+    tile->live_widgets = NULL;
+    tile->live_widget_cnt = 0;
+}
+
+static void lv_tileview_tile_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)obj;
+
+    if(tile->snapshot && code == LV_EVENT_DRAW_MAIN) {
+        tile_draw_snapshot(obj, lv_event_get_layer(e));
+        return;
+    }
+
+    lv_result_t res = lv_obj_event_base(MY_TILE_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    if(tile->snapshot && code == LV_EVENT_DRAW_MAIN_END) {
+        /*The children are on the snapshot already. With zero opacity `lv_obj_redraw()` skips them.
+         *`lv_obj_refr()` restores the opacity after the tile is drawn.*/
+        lv_layer_t * layer = lv_event_get_layer(e);
+        layer->opa = LV_OPA_TRANSP;
+    }
+}
+
+/**
+ * Draw the snapshot of a tile and its live widgets on top of it
+ * @param obj       pointer to a tile having a snapshot
+ * @param layer     the layer to draw to
+ */
+static void tile_draw_snapshot(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)obj;
+
+    lv_area_t snapshot_area;
+    lv_obj_get_coords(obj, &snapshot_area);
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&snapshot_area, ext_draw_size, ext_draw_size);
+
+    /*The tile was resized since the snapshot was taken*/
+    if(tile->snapshot->header.w != lv_area_get_width(&snapshot_area) ||
+       tile->snapshot->header.h != lv_area_get_height(&snapshot_area)) {
+        tile_snapshot_free(obj);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.base.layer = layer;
+    img_dsc.src = tile->snapshot;
+    lv_draw_image(layer, &img_dsc, &snapshot_area);
+
+    uint32_t i;
+    for(i = 0; i < tile->live_widget_cnt; i++) {
+        lv_obj_refr(layer, tile->live_widgets[i]);
+    }
+}
+
+/**
+ * Take snapshots of the tiles around the visible area of the tileview
+ * @param obj       pointer to a tileview
+ */
+static void tiles_snapshot_take(lv_obj_t * obj)
+{
+    LV_PROFILER_BEGIN;
+
+    /*The neighbors of the visible tiles can be scrolled in*/
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    lv_area_increase(&area, lv_obj_get_width(obj), lv_obj_get_height(obj));
+
+    lv_color_format_t disp_cf = lv_display_get_color_format(lv_obj_get_display(obj));
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * tile_obj = lv_obj_get_child(obj, i);
+        if(!lv_obj_check_type(tile_obj, MY_TILE_CLASS)) continue;
+        if(lv_obj_has_flag(tile_obj, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        lv_area_t tile_area;
+        if(!lv_area_intersect(&tile_area, &area, &tile_obj->coords)) continue;
+
+        lv_tileview_tile_t * tile = (lv_tileview_tile_t *)tile_obj;
+        if(tile->snapshot) continue;
+
+        /*Opaque tiles don't need an alpha channel*/
+        lv_color_format_t cf = LV_COLOR_FORMAT_ARGB8888;
+        if(lv_obj_get_style_bg_opa(tile_obj, LV_PART_MAIN) >= LV_OPA_MAX &&
+           lv_obj_get_style_radius(tile_obj, LV_PART_MAIN) == 0 &&
+           lv_obj_get_ext_draw_size(tile_obj) == 0 &&
+           (disp_cf == LV_COLOR_FORMAT_RGB565 || disp_cf == LV_COLOR_FORMAT_RGB888 ||
+            disp_cf == LV_COLOR_FORMAT_XRGB8888)) {
+            cf = disp_cf;
+        }
+
+        /*Set the flag directly to leave out the live widgets without invalidating,
+         *refocusing or updating the layout*/
+        uint32_t j;
+        uint32_t hidden_mask = 0;
+        for(j = 0; j < tile->live_widget_cnt; j++) {
+            lv_obj_t * widget = tile->live_widgets[j];
+            if(!lv_obj_has_flag(widget, LV_OBJ_FLAG_HIDDEN)) {
+                widget->flags |= LV_OBJ_FLAG_HIDDEN;
+                hidden_mask |= (uint32_t)1 << j;
+            }
+        }
+
+        tile->snapshot = lv_snapshot_take(tile_obj, cf);
+
+        for(j = 0; j < tile->live_widget_cnt; j++) {
+            if(hidden_mask & ((uint32_t)1 << j)) tile->live_widgets[j]->flags &= ~LV_OBJ_FLAG_HIDDEN;
+        }
+
+        if(tile->snapshot == NULL) {
+            LV_LOG_WARN("Couldn't take the snapshot of a tile, drawing it directly");
+        }
+    }
+
+    LV_PROFILER_END;
+}
+
+/**
+ * Free the snapshots of all tiles of a tileview
+ * @param obj       pointer to a tileview
+ */
+static void tiles_snapshot_free(lv_obj_t * obj)
+{
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * tile_obj = lv_obj_get_child(obj, i);
+        if(lv_obj_check_type(tile_obj, MY_TILE_CLASS)) tile_snapshot_free(tile_obj);
+    }
+}
+
+static void tile_snapshot_free(lv_obj_t * obj)
+{
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)obj;
+    if(tile->snapshot == NULL) return;
+
+    /*The snapshot might be cached by the image decoders*/
+    lv_image_cache_drop(tile->snapshot);
+    lv_draw_buf_destroy(tile->snapshot);
+    tile->snapshot = NULL;
+    lv_obj_invalidate(obj);
+}
+
+static void live_widget_delete_cb(lv_event_t * e)
+{
+    lv_obj_t * tile_obj = lv_event_get_user_data(e);
+    lv_tileview_tile_remove_live_widget(tile_obj, lv_event_get_current_target(e));
+}
+
+#endif /*LV_USE_SNAPSHOT*/
+
 static void tileview_event_cb(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
     lv_obj_t * obj = lv_event_get_current_target(e);
     lv_tileview_t * tv = (lv_tileview_t *) obj;
 
+#if LV_USE_SNAPSHOT
+    if(code == LV_EVENT_SCROLL_BEGIN) {
+        if(!tv->scroll_snapshot) return;
+
+        /*Scrolling without animation is done at once so there is nothing to draw meanwhile*/
+        lv_indev_t * indev = lv_indev_active();
+        bool anim = lv_event_get_param(e) != NULL;
+        if(anim || (indev && indev->state == LV_INDEV_STATE_PRESSED)) {
+            tiles_snapshot_take(obj);
+        }
+        return;
+    }
+#endif
+
     if(code == LV_EVENT_SCROLL_END) {
         lv_indev_t * indev = lv_indev_active();
         if(indev && indev->state == LV_INDEV_STATE_PRESSED) {
@@ -185,6 +471,15 @@ static void tileview_event_cb(lv_event_t * e)
             }
         }
         lv_obj_set_scroll_dir(obj, dir);
+
+#if LV_USE_SNAPSHOT
+        /*The input device ends the scrolling before the snap animation is finished
+         *and before it stops scrolling the tileview*/
+        bool by_indev = lv_event_get_param(e) != NULL;
+        if(by_indev ? lv_anim_get(obj, NULL) == NULL : !lv_obj_is_scrolling(obj)) {
+            tiles_snapshot_free(obj);
+        }
+#endif
     }
 }
 #endif /*LV_USE_TILEVIEW*/
@@ -69,6 +69,44 @@ void lv_tileview_set_tile_by_index(lv_obj_t * tv, uint32_t col_id, uint32_t row_
  */
 lv_obj_t * lv_tileview_get_tile_active(lv_obj_t * obj);
 
+#if LV_USE_SNAPSHOT
+
+/**
+ * Draw the tiles from snapshots while the tileview is scrolled.
+ * The tiles around the visible area are captured when the scrolling starts
+ * and the snapshots are freed when the scrolling has settled.
+ * Changes on the tiles are not visible meanwhile, except on their live widgets.
+ * @param tv          pointer to the tileview object
+ * @param en          true: enable snapshots; false: always draw the tiles directly
+ */
+void lv_tileview_set_scroll_snapshot(lv_obj_t * tv, bool en);
+
+/**
+ * Get whether the tiles are drawn from snapshots while the tileview is scrolled.
+ * @param tv          pointer to the tileview object
+ * @return            true: snapshots are enabled
+ */
+bool lv_tileview_get_scroll_snapshot(lv_obj_t * tv);
+
+/**
+ * Keep drawing a widget of a tile directly while the tile is drawn from its snapshot.
+ * The widget is left out from the snapshot and drawn on top of it in its current state.
+ * The styles and clipping of its parents (except the tile's) are not applied on it.
+ * A tile can have at most 32 live widgets.
+ * @param tile        pointer to a tile
+ * @param widget      pointer to a widget on the tile
+ */
+void lv_tileview_tile_add_live_widget(lv_obj_t * tile, lv_obj_t * widget);
+
+/**
+ * Draw a widget as part of the tile's snapshot again.
+ * @param tile        pointer to a tile
+ * @param widget      pointer to a widget added by `lv_tileview_tile_add_live_widget()`
+ */
+void lv_tileview_tile_remove_live_widget(lv_obj_t * tile, lv_obj_t * widget);
+
+#endif /*LV_USE_SNAPSHOT*/
+
 /*=====================
  * Other functions
  *====================*/
@@ -33,11 +33,19 @@ extern "C" {
 struct _lv_tileview_t {
     lv_obj_t obj;
     lv_obj_t * tile_act;
+#if LV_USE_SNAPSHOT
+    uint8_t scroll_snapshot : 1;    /**< Draw the tiles from snapshots while scrolling*/
+#endif
 };
 
 struct _lv_tileview_tile_t {
     lv_obj_t obj;
     lv_dir_t dir;
+#if LV_USE_SNAPSHOT
+    lv_draw_buf_t * snapshot;       /**< The tile without its live widgets, taken when the scrolling started*/
+    lv_obj_t ** live_widgets;       /**< Widgets drawn in their current state on the snapshot*/
+    uint32_t live_widget_cnt;
+#endif
 };
 
 
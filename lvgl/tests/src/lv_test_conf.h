@@ -31,6 +31,14 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_OBJ_STYLE_PROP_CACHE 1
+#define LV_OBJ_LOCAL_STYLE_INTERN 1
+#define LV_DRAW_LAYER_BUF_POOL_SIZE (1024 * 1024)
+#define LV_OBJ_CACHE_LAYER_MAX_MEMORY (1024 * 1024)
+#define LV_REFR_OCCLUSION_CULLING 1
+#define LV_REFR_SCROLL_BLIT 1
+#define LV_LAYOUT_INCREMENTAL 1
+#define LV_DRAW_SW_GRADIENT_CACHE_SIZE (16 * 1024)
 #define LV_BIN_DECODER_RAM_LOAD 0
 #endif
 
@@ -139,6 +139,7 @@
 #define LV_USE_OBJ_NAME         1
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_USE_IMAGE_DISK_CACHE 1
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
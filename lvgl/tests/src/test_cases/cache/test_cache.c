@@ -272,6 +272,93 @@ void test_cache_lru_ll_count_eviction(void)
     lv_cache_destroy(cache, NULL);
 }
 
+void test_cache_2q_count_add_acquire(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_2q_count, CACHE_EXPECTED_DATA_CNT);
+    test_data_t expected_data[CACHE_EXPECTED_DATA_CNT];
+    cache_add_acquire_test(cache, expected_data, CACHE_EXPECTED_DATA_CNT);
+    lv_cache_destroy(cache, NULL);
+}
+
+void test_cache_2q_count_eviction(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_2q_count, CACHE_EXPECTED_DATA_CNT);
+    test_data_t expected_data[CACHE_EXPECTED_DATA_CNT];
+    cache_eviction_test(cache, expected_data, CACHE_EXPECTED_DATA_CNT);
+    lv_cache_destroy(cache, NULL);
+}
+
+/**
+ * Get an entry of `size` bytes, add it on a miss as an application would do
+ */
+static void cache_use(lv_cache_t * cache, int32_t key, uint32_t size)
+{
+    test_data_t search_key = { .slot.size = size, .key1 = key, .key2 = 0 };
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry == NULL) {
+        entry = lv_cache_add(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        data->data = lv_malloc(size);
+    }
+    lv_cache_release(cache, entry, NULL);
+}
+
+static uint32_t scan_trace_hits(const lv_cache_class_t * cache_class)
+{
+    lv_cache_t * cache = create_cache(cache_class, CACHE_SIZE_BYTES);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    /*4 hot entries are used twice, then 50 others once, then the hot ones again*/
+    int32_t i;
+    int32_t round;
+    for(round = 0; round < 2; round++) {
+        for(i = 0; i < 4; i++) cache_use(cache, i, 100);
+    }
+    for(i = 100; i < 150; i++) cache_use(cache, i, 50);
+    for(i = 0; i < 4; i++) cache_use(cache, i, 100);
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL(8 + 50 + 4, stats.hit_cnt + stats.miss_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(CACHE_SIZE_BYTES, lv_cache_get_size(cache, NULL));
+
+    lv_cache_destroy(cache, NULL);
+    return stats.hit_cnt;
+}
+
+void test_cache_2q_size_scan_resistance(void)
+{
+    /*LRU: only the second round hits, the scan evicts the hot entries*/
+    TEST_ASSERT_EQUAL(4, scan_trace_hits(&lv_cache_class_lru_rb_size));
+
+    /*2Q: the hot entries are protected from the scan*/
+    TEST_ASSERT_EQUAL(8, scan_trace_hits(&lv_cache_class_2q_size));
+}
+
+void test_cache_stats(void)
+{
+    lv_cache_t * cache = create_cache(&lv_cache_class_lru_rb_count, 2);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    cache_use(cache, 1, 8);
+    cache_use(cache, 1, 8);
+    cache_use(cache, 2, 8);
+    cache_use(cache, 3, 8);
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL(1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(3, stats.miss_cnt);
+    TEST_ASSERT_EQUAL(1, stats.evict_cnt);
+
+    lv_cache_reset_stats(cache);
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL(0, stats.hit_cnt + stats.miss_cnt + stats.evict_cnt);
+
+    lv_cache_destroy(cache, NULL);
+}
+
 void test_cache_sc_da_eviction_second_chance_spares_referenced_entries(void)
 {
     lv_cache_t * cache = create_cache(&lv_cache_class_sc_da, CACHE_EXPECTED_DATA_CNT);
@@ -0,0 +1,200 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define SHARD_CNT       4
+#define CACHE_CNT       64
+#define KEY_CNT         256
+#define THREAD_CNT      4
+#define OP_CNT          20000
+
+typedef struct {
+    int32_t key;
+    int32_t value;      /*Always `key * 3`, checked by the readers*/
+} test_data_t;
+
+typedef struct {
+    lv_cache_t * cache;
+    uint32_t seed;
+    uint32_t error_cnt;
+} worker_t;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static lv_cache_compare_res_t compare_cb(const test_data_t * lhs, const test_data_t * rhs)
+{
+    if(lhs->key == rhs->key) return 0;
+    return lhs->key > rhs->key ? 1 : -1;
+}
+
+static bool create_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->value = node->key * 3;
+    return true;
+}
+
+static void free_cb(test_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->value = -1;
+}
+
+static uint32_t hash_cb(const test_data_t * node)
+{
+    return (uint32_t)node->key * 2654435761u;
+}
+
+static lv_cache_t * create_cache(uint32_t shard_cnt)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = (lv_cache_create_cb_t)create_cb,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+        .hash_cb = (lv_cache_hash_cb_t)hash_cb,
+    };
+    return lv_cache_create_sharded(&lv_cache_class_lru_rb_count, sizeof(test_data_t), CACHE_CNT, ops, shard_cnt);
+}
+
+static uint32_t count_entries(lv_cache_t * cache)
+{
+    lv_iter_t * iter = lv_cache_iter_create(cache);
+    TEST_ASSERT_NOT_NULL(iter);
+
+    uint8_t elem[64];
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(elem), lv_cache_entry_get_size(sizeof(test_data_t)));
+    uint32_t cnt = 0;
+    while(lv_iter_next(iter, elem) == LV_RESULT_OK) cnt++;
+    lv_iter_destroy(iter);
+
+    return cnt;
+}
+
+void test_cache_sharded_basic(void)
+{
+    lv_cache_t * cache = create_cache(SHARD_CNT);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_EQUAL(CACHE_CNT, lv_cache_get_max_size(cache, NULL));
+
+    int32_t i;
+    for(i = 0; i < KEY_CNT; i++) {
+        test_data_t search_key = { .key = i };
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        TEST_ASSERT_NOT_NULL(entry);
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        TEST_ASSERT_EQUAL(i * 3, data->value);
+        lv_cache_release(cache, entry, NULL);
+    }
+
+    /*Each shard is full, but the whole cache stays in its limit*/
+    TEST_ASSERT_EQUAL(CACHE_CNT, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL(0, lv_cache_get_free_size(cache, NULL));
+    TEST_ASSERT_EQUAL(CACHE_CNT, count_entries(cache));
+
+    /*The last used keys are still there*/
+    test_data_t search_key = { .key = KEY_CNT - 1 };
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    TEST_ASSERT_NOT_NULL(entry);
+    lv_cache_release(cache, entry, NULL);
+
+    lv_cache_drop(cache, &search_key, NULL);
+    TEST_ASSERT_NULL(lv_cache_acquire(cache, &search_key, NULL));
+    TEST_ASSERT_EQUAL(CACHE_CNT - 1, lv_cache_get_size(cache, NULL));
+
+    TEST_ASSERT_TRUE(lv_cache_evict_one(cache, NULL));
+    TEST_ASSERT_EQUAL(CACHE_CNT - 2, lv_cache_get_size(cache, NULL));
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_EQUAL(1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(KEY_CNT + 1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL(KEY_CNT - CACHE_CNT + 1, stats.evict_cnt);
+    TEST_ASSERT_GREATER_THAN(0, stats.lock_cnt);
+
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_EQUAL(0, count_entries(cache));
+
+    lv_cache_destroy(cache, NULL);
+}
+
+#if LV_USE_OS != LV_OS_NONE
+static void worker_cb(void * user_data)
+{
+    worker_t * worker = user_data;
+
+    uint32_t i;
+    for(i = 0; i < OP_CNT; i++) {
+        worker->seed = worker->seed * 1103515245 + 12345;
+        test_data_t search_key = { .key = (int32_t)((worker->seed >> 16) % KEY_CNT) };
+
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(worker->cache, &search_key, NULL);
+        if(entry == NULL) {
+            /*All entries of the shard are in use by the other threads*/
+            continue;
+        }
+
+        test_data_t * data = lv_cache_entry_get_data(entry);
+        if(data->key != search_key.key || data->value != search_key.key * 3) worker->error_cnt++;
+
+        lv_cache_release(worker->cache, entry, NULL);
+    }
+}
+
+static void stress(lv_cache_t * cache, const char * name)
+{
+    lv_thread_t threads[THREAD_CNT];
+    worker_t workers[THREAD_CNT];
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        workers[i].cache = cache;
+        workers[i].seed = i + 1;
+        workers[i].error_cnt = 0;
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_thread_init(&threads[i], "cache_stress", LV_THREAD_PRIO_MID, worker_cb,
+                                                       8 * 1024, &workers[i]));
+    }
+
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+        TEST_ASSERT_EQUAL(0, workers[i].error_cnt);
+    }
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+    TEST_ASSERT_LESS_OR_EQUAL(THREAD_CNT * OP_CNT, stats.hit_cnt + stats.miss_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(CACHE_CNT, lv_cache_get_size(cache, NULL));
+    TEST_PRINTF("%s: %" LV_PRIu32 " locks, %" LV_PRIu32 " contended", name, stats.lock_cnt, stats.lock_contended_cnt);
+
+    /*No entries are left referenced*/
+    lv_cache_drop_all(cache, NULL);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+}
+#endif
+
+void test_cache_sharded_stress(void)
+{
+#if LV_USE_OS != LV_OS_NONE
+    lv_cache_t * cache = create_cache(1);
+    TEST_ASSERT_NOT_NULL(cache);
+    stress(cache, "single lock");
+    lv_cache_destroy(cache, NULL);
+
+    cache = create_cache(SHARD_CNT);
+    TEST_ASSERT_NOT_NULL(cache);
+    stress(cache, "sharded");
+    lv_cache_destroy(cache, NULL);
+#endif
+}
+
+#endif
@@ -0,0 +1,155 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    lv_refr_cache_layer_flush();
+}
+
+static lv_obj_t * card_create(lv_obj_t * parent, lv_obj_t ** label)
+{
+    lv_obj_t * card = lv_obj_create(parent);
+    lv_obj_set_size(card, 300, 200);
+    lv_obj_set_style_bg_color(card, lv_color_hex(0x181818), 0);
+    lv_obj_set_style_radius(card, 15, 0);
+    lv_obj_remove_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+
+    *label = lv_label_create(card);
+    lv_label_set_text(*label, "NEXT TURN");
+    lv_obj_set_style_text_color(*label, lv_color_hex(0x39ff14), 0);
+    lv_obj_align(*label, LV_ALIGN_TOP_MID, 0, 10);
+
+    lv_obj_t * btn = lv_button_create(card);
+    lv_obj_align(btn, LV_ALIGN_BOTTOM_MID, 0, -10);
+    lv_obj_t * btn_label = lv_label_create(btn);
+    lv_label_set_text(btn_label, "Route");
+
+    return card;
+}
+
+void test_cache_layer_reuse_and_invalidate(void)
+{
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    lv_obj_t * label;
+    lv_obj_t * card = card_create(lv_screen_active(), &label);
+    lv_obj_center(card);
+    lv_obj_add_flag(card, LV_OBJ_FLAG_CACHE_LAYER);
+
+    lv_refr_cache_layer_stats_t stats_before;
+    lv_refr_cache_layer_get_stats(&stats_before);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/cache_layer_1.png");
+
+    lv_refr_cache_layer_stats_t stats;
+    lv_refr_cache_layer_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt + 1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(300 * 200 * 4, stats.used_size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_OBJ_CACHE_LAYER_MAX_MEMORY, stats.used_peak);
+
+    /*Redrawing the parent shouldn't render the card again*/
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/cache_layer_1.png");
+    stats_before = stats;
+    lv_refr_cache_layer_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt, stats.miss_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_before.hit_cnt, stats.hit_cnt);
+
+    /*Changing a child should render the card again*/
+    lv_label_set_text(label, "ROUTE CALCULATING");
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/cache_layer_2.png");
+    stats_before = stats;
+    lv_refr_cache_layer_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt + 1, stats.miss_cnt);
+
+    /*The opacity is applied while rendering, so the bitmap should be rendered again*/
+    lv_obj_set_style_opa(card, LV_OPA_50, 0);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/cache_layer_3.png");
+    stats_before = stats;
+    lv_refr_cache_layer_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt + 1, stats.miss_cnt);
+
+    /*Removing the flag frees the bitmap*/
+    lv_obj_remove_flag(card, LV_OBJ_FLAG_CACHE_LAYER);
+    lv_refr_cache_layer_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.used_size);
+#endif
+}
+
+void test_cache_layer_parent_opa_change(void)
+{
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_center(cont);
+
+    lv_obj_t * label;
+    lv_obj_t * card = card_create(cont, &label);
+    lv_obj_center(card);
+    lv_obj_add_flag(card, LV_OBJ_FLAG_CACHE_LAYER);
+    lv_refr_now(NULL);
+
+    /*The card's bitmap was rendered with a different opacity, so it should be rendered again*/
+    lv_refr_cache_layer_stats_t stats_before;
+    lv_refr_cache_layer_get_stats(&stats_before);
+    lv_obj_set_style_opa(cont, LV_OPA_50, 0);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/cache_layer_4.png");
+
+    lv_refr_cache_layer_stats_t stats;
+    lv_refr_cache_layer_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt + 1, stats.miss_cnt);
+#endif
+}
+
+void test_cache_layer_evict_and_delete(void)
+{
+#if LV_OBJ_CACHE_LAYER_MAX_MEMORY
+    /*Each bitmap needs ~480 kB, so only 2 of them fit into the 1 MB limit*/
+    lv_obj_t * objs[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        objs[i] = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(objs[i], 400, 300);
+        lv_obj_add_flag(objs[i], LV_OBJ_FLAG_CACHE_LAYER);
+        lv_obj_add_flag(objs[i], LV_OBJ_FLAG_HIDDEN);
+    }
+
+    lv_obj_remove_flag(objs[0], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_flag(objs[1], LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+
+    lv_refr_cache_layer_stats_t stats_before;
+    lv_refr_cache_layer_get_stats(&stats_before);
+    TEST_ASSERT_EQUAL_UINT32(2, stats_before.entry_cnt);
+
+    /*The least recently used bitmap should be freed for the new one*/
+    lv_obj_add_flag(objs[0], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(objs[1], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_flag(objs[2], LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+
+    lv_refr_cache_layer_stats_t stats;
+    lv_refr_cache_layer_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.evict_cnt + 1, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.entry_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_OBJ_CACHE_LAYER_MAX_MEMORY, stats.used_peak);
+
+    /*Deleting the widgets frees their bitmaps*/
+    lv_obj_clean(lv_screen_active());
+    lv_refr_cache_layer_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.used_size);
+#endif
+}
+
+#endif
@@ -0,0 +1,57 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+static lv_obj_t * shadow_obj_create(int32_t shadow_w, int32_t radius)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 60);
+    lv_obj_set_style_radius(obj, radius, 0);
+    lv_obj_set_style_shadow_width(obj, shadow_w, 0);
+    return obj;
+}
+#endif
+
+void test_draw_sw_box_shadow_cache_shares_corners(void)
+{
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->sw_shadow_cache;
+    TEST_ASSERT_NOT_NULL(cache);
+    lv_cache_drop_all(cache, NULL);
+
+    /*The corner size is shadow width + radius, keep it in the cacheable range*/
+    lv_obj_t * obj1 = shadow_obj_create(4, 2);
+    lv_obj_align(obj1, LV_ALIGN_TOP_LEFT, 20, 20);
+    lv_refr_now(NULL);
+    uint32_t size = (uint32_t)lv_cache_get_size(cache, NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, size);
+
+    /*The same shadow on an other widget uses the same corner*/
+    lv_obj_t * obj2 = shadow_obj_create(4, 2);
+    lv_obj_align(obj2, LV_ALIGN_BOTTOM_RIGHT, -20, -20);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(size, lv_cache_get_size(cache, NULL));
+
+    /*A different radius needs a new corner while the old one is kept too*/
+    lv_obj_set_style_radius(obj2, 3, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(size, lv_cache_get_size(cache, NULL));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DRAW_SW_SHADOW_CACHE_MAX_MEMORY, lv_cache_get_size(cache, NULL));
+#endif
+}
+
+#endif
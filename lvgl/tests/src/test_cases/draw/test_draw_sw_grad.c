@@ -0,0 +1,66 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "src/draw/sw/lv_draw_sw_grad.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+static lv_obj_t * grad_obj_create(int32_t w, lv_grad_dir_t dir)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, w, 100);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_color(obj, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_dir(obj, dir, 0);
+    return obj;
+}
+#endif
+
+void test_draw_sw_grad_cache_reuses_color_maps(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE
+    lv_obj_t * obj1 = grad_obj_create(200, LV_GRAD_DIR_HOR);
+    lv_refr_now(NULL);
+
+    lv_draw_sw_grad_cache_stats_t stats_before;
+    lv_draw_sw_grad_cache_get_stats(&stats_before);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats_before.size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DRAW_SW_GRADIENT_CACHE_SIZE, stats_before.size);
+
+    /*Redrawing the same gradient reuses its color map*/
+    lv_obj_invalidate(obj1);
+    lv_refr_now(NULL);
+
+    lv_draw_sw_grad_cache_stats_t stats;
+    lv_draw_sw_grad_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_before.hit_cnt, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt, stats.miss_cnt);
+
+    /*An other widget with the same gradient and width shares the color map*/
+    lv_obj_t * obj2 = grad_obj_create(200, LV_GRAD_DIR_HOR);
+    lv_obj_align(obj2, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_refr_now(NULL);
+    lv_draw_sw_grad_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt, stats.miss_cnt);
+
+    /*A different width needs a new color map*/
+    lv_obj_set_width(obj2, 150);
+    lv_refr_now(NULL);
+    lv_draw_sw_grad_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt + 1, stats.miss_cnt);
+#endif
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include <stdio.h>
 
 void setUp(void)
 {
@@ -21,4 +22,158 @@ void test_image_cache_dump(void)
     lv_image_header_cache_dump();
 }
 
+static bool image_is_cached(const void * src)
+{
+    lv_image_cache_data_t search_key;
+    search_key.src_type = lv_image_src_get_type(src);
+    search_key.src = src;
+
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->img_cache;
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(cache, entry, NULL);
+    return true;
+}
+
+void test_image_prefetch(void)
+{
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.png";
+    lv_image_cache_drop(src);
+    TEST_ASSERT_FALSE(image_is_cached(src));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_prefetch(src));
+
+    /*Wait for the background decoding*/
+    uint32_t i;
+    for(i = 0; i < 100 && !image_is_cached(src); i++) {
+        lv_timer_handler();
+        lv_delay_ms(10);
+    }
+    TEST_ASSERT_TRUE(image_is_cached(src));
+
+#if !LV_IMAGE_DECODER_ASYNC
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_prefetch("A:src/test_assets/not_existing.png"));
+#endif
+}
+
+void test_image_decoder_async_decodes_drawn_images(void)
+{
+#if LV_IMAGE_DECODER_ASYNC
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.png";
+    lv_image_cache_drop(src);
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, src);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 100 && !image_is_cached(src); i++) {
+        lv_timer_handler();
+        lv_delay_ms(10);
+    }
+    TEST_ASSERT_TRUE(image_is_cached(src));
+
+    lv_obj_delete(img);
+#endif
+}
+
+#if LV_USE_IMAGE_DISK_CACHE
+static void disk_cache_files_for_each(void (*cb)(const char * path))
+{
+    lv_fs_dir_t dir;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_dir_open(&dir, "A:src/test_files"));
+
+    char fn[64];
+    char path[128];
+    while(lv_fs_dir_read(&dir, fn, sizeof(fn)) == LV_FS_RES_OK && fn[0] != '\0') {
+        if(lv_strcmp(lv_fs_get_ext(fn), "lvdc") != 0) continue;
+        lv_snprintf(path, sizeof(path), "src/test_files/%s", fn);
+        cb(path);
+    }
+    lv_fs_dir_close(&dir);
+}
+
+static void disk_cache_file_corrupt(const char * path)
+{
+    FILE * f = fopen(path, "r+b");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 1000, SEEK_SET);
+    int c = fgetc(f);
+    fseek(f, 1000, SEEK_SET);
+    fputc(c ^ 0xff, f);
+    fclose(f);
+}
+
+static void disk_cache_file_remove(const char * path)
+{
+    remove(path);
+}
+#endif
+
+void test_image_disk_cache(void)
+{
+#if LV_USE_IMAGE_DISK_CACHE
+    const char * src = "A:src/test_assets/test_img_lvgl_logo.png";
+    lv_image_disk_cache_stats_t stats;
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_disk_cache_set_path("A:src/not_existing"));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_disk_cache_set_path("A:src/test_files"));
+    lv_image_disk_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(0, stats.size);
+    uint32_t hit_cnt = stats.hit_cnt;
+    uint32_t store_cnt = stats.store_cnt;
+
+    /*Decode and store the image*/
+    lv_image_cache_drop(src);
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, NULL));
+    lv_draw_buf_t * ref = lv_draw_buf_dup(dsc.decoded);
+    lv_image_decoder_close(&dsc);
+
+    lv_image_disk_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(store_cnt + 1, stats.store_cnt);
+    TEST_ASSERT_EQUAL(hit_cnt, stats.hit_cnt);
+    TEST_ASSERT_GREATER_THAN(ref->data_size, stats.size);
+
+    /*The stored files are found as after a reboot and the image is loaded instead of decoded*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_disk_cache_set_path("A:src/test_files"));
+    lv_image_disk_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(ref->data_size, stats.size);
+
+    lv_image_cache_drop(src);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, NULL));
+    lv_image_disk_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(hit_cnt + 1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(ref->header.w, dsc.decoded->header.w);
+    TEST_ASSERT_EQUAL(ref->header.h, dsc.decoded->header.h);
+    TEST_ASSERT_EQUAL(ref->header.cf, dsc.decoded->header.cf);
+    TEST_ASSERT_EQUAL(ref->header.stride, dsc.decoded->header.stride);
+    TEST_ASSERT_EQUAL_MEMORY(ref->data, dsc.decoded->data, ref->header.stride * ref->header.h);
+    lv_image_decoder_close(&dsc);
+
+    /*A corrupted file is not used but the image is decoded and stored again*/
+    disk_cache_files_for_each(disk_cache_file_corrupt);
+    lv_image_cache_drop(src);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, NULL));
+    TEST_ASSERT_EQUAL_MEMORY(ref->data, dsc.decoded->data, ref->header.stride * ref->header.h);
+    lv_image_decoder_close(&dsc);
+
+    lv_image_disk_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(hit_cnt + 1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(store_cnt + 2, stats.store_cnt);
+
+    lv_image_cache_drop(src);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, NULL));
+    lv_image_decoder_close(&dsc);
+    lv_image_disk_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL(hit_cnt + 2, stats.hit_cnt);
+
+    lv_image_disk_cache_set_path(NULL);
+    lv_image_cache_drop(src);
+    lv_draw_buf_destroy(ref);
+    disk_cache_files_for_each(disk_cache_file_remove);
+#endif
+}
+
 #endif
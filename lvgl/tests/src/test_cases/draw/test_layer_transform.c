@@ -59,4 +59,35 @@ void test_update_layer_type_on_state_change(void)
 
 }
 
+void test_layer_buf_pool_reuses_buffers(void)
+{
+#if LV_DRAW_LAYER_BUF_POOL_SIZE
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 100);
+    lv_obj_center(obj);
+    lv_obj_set_style_transform_rotation(obj, 300, 0);
+    lv_refr_now(NULL);
+
+    lv_draw_buf_pool_stats_t stats_before;
+    lv_draw_buf_pool_get_stats(&stats_before);
+    TEST_ASSERT_EQUAL_UINT32(0, stats_before.used_size);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats_before.pooled_size);
+
+    /*The same layer is rendered again, so its buffer should be reused*/
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+
+    lv_draw_buf_pool_stats_t stats;
+    lv_draw_buf_pool_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_before.hit_cnt, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.miss_cnt, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.used_size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DRAW_LAYER_BUF_POOL_SIZE, stats.pooled_peak);
+
+    lv_draw_buf_pool_flush();
+    lv_draw_buf_pool_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.pooled_size);
+#endif
+}
+
 #endif
@@ -0,0 +1,107 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t draw_main_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    draw_main_cnt = 0;
+    lv_display_reset_occlusion_stats(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void draw_main_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_main_cnt++;
+}
+
+static lv_obj_t * rect_create(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(color), 0);
+    return obj;
+}
+
+void test_occlusion_culling_fully_covered(void)
+{
+#if LV_REFR_OCCLUSION_CULLING
+    lv_obj_t * bottom = rect_create(100, 100, 200, 100, 0xff0000);
+    lv_obj_add_event_cb(bottom, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_t * label = lv_label_create(bottom);
+    lv_label_set_text(label, "Hidden");
+
+    /*A rounded card covering the bottom widget even without its corners*/
+    lv_obj_t * top = rect_create(50, 50, 300, 200, 0x181818);
+    lv_obj_set_style_radius(top, 20, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/occlusion_culling_1.png");
+    TEST_ASSERT_EQUAL_UINT32(0, draw_main_cnt);
+
+    lv_display_occlusion_stats_t stats;
+    lv_display_get_occlusion_stats(NULL, &stats);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats.culled_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(200 * 100, stats.frame_culled_px);
+    TEST_ASSERT_EQUAL_UINT64(stats.culled_px, stats.frame_culled_px);
+
+    /*Not opaque anymore so the bottom widget should be drawn*/
+    lv_obj_set_style_bg_opa(top, LV_OPA_50, 0);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/occlusion_culling_2.png");
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_main_cnt);
+#endif
+}
+
+void test_occlusion_culling_partially_covered(void)
+{
+#if LV_REFR_OCCLUSION_CULLING
+    lv_obj_t * bottom = rect_create(100, 100, 200, 100, 0xff0000);
+    lv_obj_add_event_cb(bottom, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_set_style_border_width(bottom, 4, 0);
+    lv_obj_set_style_border_color(bottom, lv_color_hex(0x0000ff), 0);
+
+    /*Covers the top 60 rows of the bottom widget in full width*/
+    rect_create(50, 50, 300, 110, 0x00ff00);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/occlusion_culling_3.png");
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_main_cnt);
+
+    lv_display_occlusion_stats_t stats;
+    lv_display_get_occlusion_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.culled_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats.clipped_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(200 * 60, stats.frame_culled_px);
+#endif
+}
+
+void test_occlusion_culling_older_sibling_is_not_occluder(void)
+{
+#if LV_REFR_OCCLUSION_CULLING
+    /*The large widget is behind the small one so the small one should be drawn*/
+    rect_create(50, 50, 300, 200, 0x181818);
+    lv_obj_t * small = rect_create(100, 100, 200, 100, 0xff0000);
+    lv_obj_add_event_cb(small, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/occlusion_culling_4.png");
+    TEST_ASSERT_GREATER_THAN_UINT32(0, draw_main_cnt);
+
+    lv_display_occlusion_stats_t stats;
+    lv_display_get_occlusion_stats(NULL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.culled_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.clipped_cnt);
+#endif
+}
+
+#endif
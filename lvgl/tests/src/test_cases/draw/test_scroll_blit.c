@@ -0,0 +1,201 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * list;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    list = lv_list_create(lv_screen_active());
+    lv_obj_set_size(list, 240, 300);
+    lv_obj_center(list);
+
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_list_add_button(list, LV_SYMBOL_AUDIO, "Track");
+        if(i % 10 == 0) lv_list_add_text(list, "Album");
+    }
+
+    /*Start from a fully rendered frame*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_display_reset_sync_stats(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+    lv_obj_clean(lv_layer_top());
+}
+
+/**
+ * Refresh the invalidated areas only, then redraw the whole screen
+ * and check that the result is the same.
+ */
+static void refr_and_compare(void)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+
+    lv_refr_now(NULL);
+    uint8_t * refr_data = lv_malloc(size);
+    lv_memcpy(refr_data, buf->data, size);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(buf->data, refr_data, size);
+
+    lv_free(refr_data);
+}
+
+static uint32_t get_blit_cnt(void)
+{
+    lv_display_sync_stats_t stats;
+    lv_display_get_sync_stats(NULL, &stats);
+    return stats.scroll_blit_cnt;
+}
+
+static void draw_main_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+void test_scroll_blit_list(void)
+{
+#if LV_REFR_SCROLL_BLIT
+    lv_obj_scroll_by(list, 0, -37, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(1, get_blit_cnt());
+
+    lv_display_sync_stats_t stats;
+    lv_display_get_sync_stats(NULL, &stats);
+    TEST_ASSERT_GREATER_THAN_UINT64(0, stats.scroll_blit_bytes);
+
+    /*Scroll back and forth before the refresh*/
+    lv_display_reset_sync_stats(NULL);
+    lv_obj_scroll_by(list, 0, -50, LV_ANIM_OFF);
+    lv_obj_scroll_by(list, 0, 21, LV_ANIM_OFF);
+    lv_obj_scroll_by(list, 0, -80, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(1, get_blit_cnt());
+
+    /*Change a moved and a newly exposed item in the same frame*/
+    lv_obj_t * btn = lv_obj_get_child(list, 8);
+    lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_scroll_by(list, 0, 45, LV_ANIM_OFF);
+    lv_obj_set_style_bg_color(lv_obj_get_child(list, 3), lv_palette_main(LV_PALETTE_GREEN), 0);
+    refr_and_compare();
+#endif
+}
+
+void test_scroll_blit_static_widgets(void)
+{
+#if LV_REFR_SCROLL_BLIT
+    /*A floating button in the list, a younger sibling and a widget on the top layer over the list*/
+    lv_obj_t * floating = lv_button_create(list);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_set_size(floating, 40, 40);
+    lv_obj_align(floating, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+
+    lv_obj_t * sibling = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(sibling, 100, 60);
+    lv_obj_align_to(sibling, list, LV_ALIGN_TOP_LEFT, -30, 40);
+
+    lv_obj_t * label = lv_label_create(lv_layer_top());
+    lv_label_set_text(label, "Top layer");
+    lv_obj_align_to(label, list, LV_ALIGN_CENTER, 0, 0);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_display_reset_sync_stats(NULL);
+
+    lv_obj_scroll_by(list, 0, -64, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(1, get_blit_cnt());
+
+    lv_obj_scroll_by(list, 0, 31, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(2, get_blit_cnt());
+#endif
+}
+
+void test_scroll_blit_nested(void)
+{
+#if LV_REFR_SCROLL_BLIT
+    /*A horizontally scrolled row in the list, scrolled together with the list*/
+    lv_obj_t * row = lv_obj_create(list);
+    lv_obj_move_to_index(row, 2);
+    lv_obj_set_size(row, lv_pct(100), 80);
+    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * btn = lv_button_create(row);
+        lv_obj_set_size(btn, 60, 40);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "%d", (int)i);
+    }
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_display_reset_sync_stats(NULL);
+
+    lv_obj_scroll_by(row, -45, 0, LV_ANIM_OFF);
+    lv_obj_scroll_by(list, 0, -20, LV_ANIM_OFF);
+    lv_obj_scroll_by(row, -12, 0, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(3, get_blit_cnt());
+#endif
+}
+
+void test_scroll_blit_fallback(void)
+{
+#if LV_REFR_SCROLL_BLIT
+    /*Scrolled more than the size of the list*/
+    lv_obj_scroll_by(list, 0, -400, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(0, get_blit_cnt());
+
+    /*Custom drawing on the list*/
+    lv_obj_add_event_cb(list, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_scroll_by(list, 0, 30, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(0, get_blit_cnt());
+    lv_obj_remove_event_cb(list, draw_main_cb);
+
+    /*Transparent background*/
+    lv_obj_set_style_bg_opa(list, LV_OPA_50, 0);
+    lv_obj_scroll_by(list, 0, 30, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(0, get_blit_cnt());
+    lv_obj_set_style_bg_opa(list, LV_OPA_COVER, 0);
+
+    /*Semi transparent parent*/
+    lv_obj_set_style_opa(lv_screen_active(), LV_OPA_80, 0);
+    lv_obj_scroll_by(list, 0, 30, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(0, get_blit_cnt());
+    lv_obj_set_style_opa(lv_screen_active(), LV_OPA_COVER, 0);
+
+    /*Widgets with their own drawing*/
+    lv_obj_t * table = lv_table_create(lv_screen_active());
+    lv_obj_set_size(table, 200, 150);
+    uint32_t i;
+    for(i = 0; i < 20; i++) lv_table_set_cell_value_fmt(table, i, 0, "Row %d", (int)i);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_obj_scroll_by(table, 0, -30, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(0, get_blit_cnt());
+
+    /*Moved again when the list is back to normal*/
+    lv_obj_scroll_by(list, 0, 30, LV_ANIM_OFF);
+    refr_and_compare();
+    TEST_ASSERT_EQUAL_UINT32(1, get_blit_cnt());
+#endif
+}
+
+#endif
@@ -4,6 +4,12 @@
 
 #include "unity/unity.h"
 
+#if LV_USE_LZ4_INTERNAL
+    #include "src/libs/lz4/lz4.h"
+#endif
+
+#include <stdio.h>
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -317,4 +323,114 @@ void test_bin_decoder_open_stride_zero_handling(void)
 
     lv_bin_decoder_close(decoder_dsc->decoder, decoder_dsc);
 }
+#if LV_USE_LZ4_INTERNAL
+#define TILE_SIZE   32  /*The last tiles of the 100x100 image are smaller*/
+
+/**
+ * Compress an image to `LV_IMAGE_COMPRESS_LZ4_TILED` format like LVGLImage.py does
+ */
+static uint8_t * tiled_create(const lv_image_dsc_t * image, uint32_t * size)
+{
+    uint32_t w = image->header.w;
+    uint32_t h = image->header.h;
+    uint32_t px_size = lv_color_format_get_size(image->header.cf);
+    uint32_t col_cnt = (w + TILE_SIZE - 1) / TILE_SIZE;
+    uint32_t tile_cnt = col_cnt * ((h + TILE_SIZE - 1) / TILE_SIZE);
+    uint32_t head_size = 12 + 4 + (tile_cnt + 1) * 4;
+    uint32_t buf_size = head_size + tile_cnt * LZ4_compressBound(TILE_SIZE * TILE_SIZE * px_size);
+    uint8_t * buf = lv_malloc(buf_size);
+    uint8_t * tile = lv_malloc(TILE_SIZE * TILE_SIZE * px_size);
+    uint32_t * offsets = (uint32_t *)(buf + 16);
+
+    uint32_t pos = 0;
+    uint32_t i;
+    for(i = 0; i < tile_cnt; i++) {
+        uint32_t x = (i % col_cnt) * TILE_SIZE;
+        uint32_t y = (i / col_cnt) * TILE_SIZE;
+        uint32_t tile_stride = LV_MIN(TILE_SIZE, w - x) * px_size;
+        uint32_t tile_h = LV_MIN(TILE_SIZE, h - y);
+        uint32_t row;
+        for(row = 0; row < tile_h; row++) {
+            lv_memcpy(tile + row * tile_stride, image->data + (y + row) * image->header.stride + x * px_size, tile_stride);
+        }
+
+        offsets[i] = pos;
+        pos += LZ4_compress_default((const char *)tile, (char *)buf + head_size + pos, (int)(tile_stride * tile_h),
+                                    (int)(buf_size - head_size - pos));
+    }
+    offsets[tile_cnt] = pos;
+    lv_free(tile);
+
+    uint32_t compressed_head[3] = {LV_IMAGE_COMPRESS_LZ4_TILED, head_size - 12 + pos, image->header.stride * h};
+    uint16_t tile_size[2] = {TILE_SIZE, TILE_SIZE};
+    lv_memcpy(buf, compressed_head, sizeof(compressed_head));
+    lv_memcpy(buf + 12, tile_size, sizeof(tile_size));
+
+    *size = head_size + pos;
+    return buf;
+}
+#endif
+
+void test_bin_decoder_lz4_tiled(void)
+{
+#if LV_USE_LZ4_INTERNAL
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    uint32_t size;
+    uint8_t * data = tiled_create(&test_image_cogwheel_argb8888, &size);
+
+    lv_image_dsc_t tiled = test_image_cogwheel_argb8888;
+    tiled.header.flags = LV_IMAGE_FLAGS_COMPRESSED | LV_IMAGE_FLAGS_TILED;
+    tiled.data = data;
+    tiled.data_size = size;
+
+    /*Only the tiles of the drawn area are decompressed*/
+    bin_decoder(&tiled, "libs/bin_decoder_3.png");
+    bin_decoder_tile(&tiled, "libs/bin_decoder_4.png");
+
+    lv_image_decoder_args_t args = {.partial_tiles = true};
+    lv_image_decoder_dsc_t decoder_dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&decoder_dsc, &tiled, &args));
+    TEST_ASSERT_NULL(decoder_dsc.decoded);
+
+    lv_area_t full_area = {40, 40, 70, 45};
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&decoder_dsc, &full_area, &decoded_area));
+    TEST_ASSERT_EQUAL_INT32(32, decoded_area.x1);
+    TEST_ASSERT_EQUAL_INT32(63, decoded_area.y2);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&decoder_dsc, &full_area, &decoded_area));
+    TEST_ASSERT_EQUAL_INT32(64, decoded_area.x1);
+    TEST_ASSERT_EQUAL_UINT32(32 * 4, decoder_dsc.decoded->header.stride);
+    TEST_ASSERT_EQUAL_MEMORY(test_image_cogwheel_argb8888.data + 32 * 400 + 64 * 4, decoder_dsc.decoded->data, 32 * 4);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&decoder_dsc, &full_area, &decoded_area));
+    lv_image_decoder_close(&decoder_dsc);
+
+    /*Decompressed as a whole when needed, e.g. for transformations*/
+    args.partial_tiles = false;
+    args.no_cache = true;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&decoder_dsc, &tiled, &args));
+    TEST_ASSERT_NOT_NULL(decoder_dsc.decoded);
+    uint32_t y;
+    for(y = 0; y < 100; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(test_image_cogwheel_argb8888.data + y * 400,
+                                 decoder_dsc.decoded->data + y * decoder_dsc.decoded->header.stride, 400);
+    }
+    lv_image_decoder_close(&decoder_dsc);
+
+    /*From a file with mapping (A: stdio) and with reading the tiles (T: test driver)*/
+    lv_image_header_t header = tiled.header;
+    header.magic = LV_IMAGE_HEADER_MAGIC;
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:src/test_files/tiled.bin", LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, &header, sizeof(header), NULL));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, data, size, NULL));
+    lv_fs_close(&f);
+
+    bin_decoder("A:src/test_files/tiled.bin", "libs/bin_decoder_3.png");
+    bin_decoder("T:src/test_files/tiled.bin", "libs/bin_decoder_3.png");
+
+    remove("src/test_files/tiled.bin");
+    lv_free(data);
+#endif
+}
+
 #endif
@@ -260,6 +260,48 @@ void test_display_triple_buffer(void)
     lv_draw_buf_destroy(buf3);
 }
 
+void test_display_direct_mode_sync_tiles(void)
+{
+    lv_display_t * disp = lv_display_create(480, 320);
+    lv_display_set_flush_cb(disp, dummy_flush_cb);
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(480, 320, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(480, 320, LV_COLOR_FORMAT_NATIVE, 0);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_draw_buffers(disp, buf1, buf2);
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    uint32_t px_size = lv_color_format_get_size(LV_COLOR_FORMAT_NATIVE);
+    lv_display_sync_stats_t stats;
+
+    lv_obj_invalidate(scr);
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+    lv_display_get_sync_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT64(480 * 320 * px_size, stats.rendered_bytes);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.sync_copied_bytes);
+
+    /*The redrawn tiles needn't be copied, all the others do*/
+    lv_display_reset_sync_stats(disp);
+    lv_area_t a1 = {0, 0, 31, 15};
+    lv_obj_invalidate_area(scr, &a1);
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+    lv_display_get_sync_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT64(32 * 16 * px_size, stats.rendered_bytes);
+    TEST_ASSERT_EQUAL_UINT64((480 * 320 - 32 * 16) * px_size, stats.sync_copied_bytes);
+
+    /*Partially covered tiles are copied and adjacent tiles are copied together*/
+    lv_display_reset_sync_stats(disp);
+    lv_area_t a2 = {5, 5, 20, 10};
+    lv_obj_invalidate_area(scr, &a2);
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+    lv_display_get_sync_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT64(16 * 6 * px_size, stats.rendered_bytes);
+    TEST_ASSERT_EQUAL_UINT64(32 * 16 * px_size, stats.sync_copied_bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.sync_copy_cnt);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+}
+
 static void refr_event_handler(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
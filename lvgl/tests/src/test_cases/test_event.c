@@ -177,4 +177,65 @@ void test_event_remove_event_cb(void)
     lv_obj_delete(obj);
 }
 
+static uint32_t code_mask_cnt;
+static void event_code_mask_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    code_mask_cnt++;
+}
+
+void test_event_code_mask(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(obj, event_code_mask_cb, LV_EVENT_CLICKED, NULL);
+    lv_event_dsc_t * dsc = lv_obj_add_event_cb(obj, event_code_mask_cb, LV_EVENT_VALUE_CHANGED | LV_EVENT_PREPROCESS,
+                                               NULL);
+
+    /*The list shouldn't be searched for codes without callbacks*/
+    lv_event_stats_t stats_before;
+    lv_event_get_stats(&stats_before);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+
+    lv_event_stats_t stats;
+    lv_event_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.sent_cnt + 1, stats.sent_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.handled_cnt, stats.handled_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.skip_cnt + 2, stats.skip_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, code_mask_cnt);
+
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_event_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.sent_cnt + 3, stats.sent_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.handled_cnt + 2, stats.handled_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, code_mask_cnt);
+
+    /*Removing a callback removes its code from the mask, custom codes work as well*/
+    lv_obj_remove_event_dsc(obj, dsc);
+    uint32_t custom_code = lv_event_register_id();
+    lv_obj_add_event_cb(obj, event_code_mask_cb, custom_code, NULL);
+    lv_obj_send_event(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_send_event(obj, custom_code, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, code_mask_cnt);
+
+    /*LV_EVENT_ALL receives everything*/
+    lv_obj_add_event_cb(obj, event_code_mask_cb, LV_EVENT_ALL, NULL);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, code_mask_cnt);
+
+    /*The frame counters start again on refresh*/
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    lv_event_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.frame_sent_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(stats.sent_cnt - stats_before.sent_cnt, stats.frame_sent_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.frame_handled_cnt);
+
+    lv_event_reset_stats();
+    lv_event_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.sent_cnt);
+
+    lv_obj_delete(obj);
+}
+
 #endif
@@ -450,6 +450,40 @@ void test_fs_load_to_buf(void)
     lv_test_fs_set_ready(true);
 }
 
+static void mmap_drv(const char * path)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+
+    uint32_t size;
+    const char * buf = lv_fs_mmap(&f, &size);
+    lv_fs_close(&f);
+
+    /*The mapping stays valid after closing the file*/
+    TEST_ASSERT_NOT_NULL(buf);
+    TEST_ASSERT_EQUAL_UINT32(lv_strlen(read_exp) + 1, size);
+    TEST_ASSERT_TRUE(lv_memcmp(buf, read_exp, lv_strlen(read_exp)) == 0);
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_munmap(buf + 10));
+    TEST_ASSERT_EQUAL(LV_FS_RES_INV_PARAM, lv_fs_munmap(buf));
+}
+
+void test_fs_mmap(void)
+{
+    mmap_drv("A:src/test_files/readtest.txt");
+#ifndef _WIN32
+    mmap_drv("B:src/test_files/readtest.txt");
+#endif
+
+    /*The driver doesn't support mapping*/
+    lv_fs_file_t f;
+    uint32_t size;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "T:src/test_files/readtest.txt", LV_FS_MODE_RD));
+    TEST_ASSERT_NULL(lv_fs_mmap(&f, &size));
+    TEST_ASSERT_EQUAL_UINT32(0, size);
+    lv_fs_close(&f);
+}
+
 void test_fs_dir_open(void)
 {
     lv_fs_res_t res;
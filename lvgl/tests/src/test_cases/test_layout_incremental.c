@@ -0,0 +1,204 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_obj_clean(lv_screen_active());
+    lv_obj_update_layout(lv_screen_active());
+#if LV_LAYOUT_INCREMENTAL
+    lv_layout_reset_stats();
+#endif
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static lv_obj_t * flex_cont_create(int32_t y, lv_obj_t * labels[], uint32_t label_cnt)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(cont, 10, y);
+    lv_obj_set_size(cont, 300, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_START);
+
+    uint32_t i;
+    for(i = 0; i < label_cnt; i++) {
+        labels[i] = lv_label_create(cont);
+        lv_label_set_text_fmt(labels[i], "Item %" LV_PRIu32, i);
+        lv_obj_set_style_margin_left(labels[i], i, 0);
+    }
+
+    return cont;
+}
+
+static lv_obj_t * grid_cont_create(int32_t y, lv_obj_t * labels[], uint32_t label_cnt)
+{
+    static const int32_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static const int32_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(cont, 400, y);
+    lv_obj_set_size(cont, 300, LV_SIZE_CONTENT);
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+
+    uint32_t i;
+    for(i = 0; i < label_cnt; i++) {
+        labels[i] = lv_label_create(cont);
+        lv_label_set_text_fmt(labels[i], "Cell %" LV_PRIu32, i);
+        lv_obj_set_grid_cell(labels[i], i % 3 == 2 ? LV_GRID_ALIGN_STRETCH : LV_GRID_ALIGN_CENTER, i % 3, 1,
+                             LV_GRID_ALIGN_CENTER, i / 3, 1);
+    }
+
+    return cont;
+}
+
+/*The children of both containers should be at the same place relative to their parent*/
+static void assert_same_layout(lv_obj_t * cont1, lv_obj_t * cont2)
+{
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_width(cont1), lv_obj_get_width(cont2));
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(cont1), lv_obj_get_height(cont2));
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(cont1); i++) {
+        lv_obj_t * child1 = lv_obj_get_child(cont1, i);
+        lv_obj_t * child2 = lv_obj_get_child(cont2, i);
+        TEST_ASSERT_EQUAL_INT32(child1->coords.x1 - cont1->coords.x1, child2->coords.x1 - cont2->coords.x1);
+        TEST_ASSERT_EQUAL_INT32(child1->coords.y1 - cont1->coords.y1, child2->coords.y1 - cont2->coords.y1);
+        TEST_ASSERT_EQUAL_INT32(lv_obj_get_width(child1), lv_obj_get_width(child2));
+        TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(child1), lv_obj_get_height(child2));
+    }
+}
+
+void test_layout_incremental_flex(void)
+{
+#if LV_LAYOUT_INCREMENTAL
+    lv_obj_t * labels[9];
+    lv_obj_t * ref_labels[9];
+    lv_obj_t * cont = flex_cont_create(10, labels, 9);
+    lv_obj_t * ref_cont = flex_cont_create(200, ref_labels, 9);
+    lv_obj_update_layout(cont);
+
+    /*Only the last tracks should be placed again*/
+    lv_layout_stats_t stats_before;
+    lv_layout_get_stats(&stats_before);
+    lv_label_set_text(labels[5], "A longer item");
+    lv_obj_update_layout(cont);
+
+    lv_layout_stats_t stats;
+    lv_layout_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_before.incremental_cnt, stats.incremental_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_before.track_reuse_cnt, stats.track_reuse_cnt);
+
+    /*The result should be the same as the full update's*/
+    lv_label_set_text(ref_labels[5], "A longer item");
+    lv_layout_cache_invalidate_all();
+    lv_obj_update_layout(ref_cont);
+    assert_same_layout(cont, ref_cont);
+
+    /*Shrinking back and changing a track in the middle*/
+    lv_label_set_text(labels[5], "Item 5");
+    lv_label_set_text(labels[2], "Item 2 is longer");
+    lv_obj_update_layout(cont);
+    lv_label_set_text(ref_labels[5], "Item 5");
+    lv_label_set_text(ref_labels[2], "Item 2 is longer");
+    lv_layout_cache_invalidate_all();
+    lv_obj_update_layout(ref_cont);
+    assert_same_layout(cont, ref_cont);
+
+    /*Changing a style should update everything*/
+    lv_layout_get_stats(&stats_before);
+    lv_obj_set_style_margin_left(labels[0], 20, 0);
+    lv_obj_update_layout(cont);
+    lv_layout_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_before.full_cnt, stats.full_cnt);
+
+    lv_obj_set_style_margin_left(ref_labels[0], 20, 0);
+    lv_obj_update_layout(ref_cont);
+    assert_same_layout(cont, ref_cont);
+
+    /*Hiding a child should update everything too*/
+    lv_obj_add_flag(labels[3], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(ref_labels[3], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(cont);
+    assert_same_layout(cont, ref_cont);
+
+    /*Nothing has changed so there is nothing to do*/
+    lv_layout_get_stats(&stats_before);
+    lv_obj_mark_layout_as_dirty(cont);
+    lv_obj_update_layout(cont);
+    lv_layout_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.skip_cnt + 1, stats.skip_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.full_cnt, stats.full_cnt);
+#endif
+}
+
+void test_layout_incremental_grid(void)
+{
+#if LV_LAYOUT_INCREMENTAL
+    lv_obj_t * labels[9];
+    lv_obj_t * ref_labels[9];
+    lv_obj_t * cont = grid_cont_create(10, labels, 9);
+    lv_obj_t * ref_cont = grid_cont_create(200, ref_labels, 9);
+    lv_obj_update_layout(cont);
+
+    /*The size of the first column doesn't change so only the label should be placed again*/
+    lv_layout_stats_t stats_before;
+    lv_layout_get_stats(&stats_before);
+    lv_label_set_text(labels[3], "Cell");
+    lv_obj_update_layout(cont);
+
+    lv_layout_stats_t stats;
+    lv_layout_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_before.incremental_cnt, stats.incremental_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before.track_update_cnt, stats.track_update_cnt);
+
+    lv_label_set_text(ref_labels[3], "Cell");
+    lv_layout_cache_invalidate_all();
+    lv_obj_update_layout(ref_cont);
+    assert_same_layout(cont, ref_cont);
+
+    /*Making the first column wider moves the other columns and makes the last row taller*/
+    lv_label_set_text(labels[6], "Wider cell\nin 2 lines");
+    lv_obj_update_layout(cont);
+    lv_label_set_text(ref_labels[6], "Wider cell\nin 2 lines");
+    lv_layout_cache_invalidate_all();
+    lv_obj_update_layout(ref_cont);
+    assert_same_layout(cont, ref_cont);
+
+    /*Changing a cell should update everything*/
+    lv_layout_get_stats(&stats_before);
+    lv_obj_set_grid_cell(labels[0], LV_GRID_ALIGN_END, 0, 1, LV_GRID_ALIGN_END, 0, 1);
+    lv_obj_update_layout(cont);
+    lv_layout_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(stats_before.full_cnt, stats.full_cnt);
+
+    lv_obj_set_grid_cell(ref_labels[0], LV_GRID_ALIGN_END, 0, 1, LV_GRID_ALIGN_END, 0, 1);
+    lv_obj_update_layout(ref_cont);
+    assert_same_layout(cont, ref_cont);
+#endif
+}
+
+void test_layout_incremental_delete(void)
+{
+#if LV_LAYOUT_INCREMENTAL
+    size_t mem_before = lv_test_get_free_mem();
+
+    lv_obj_t * labels[9];
+    lv_obj_t * cont = flex_cont_create(10, labels, 9);
+    grid_cont_create(200, labels, 9);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_NOT_NULL(lv_layout_cache_get(cont, LV_LAYOUT_FLEX));
+
+    /*Deleting the containers should free the saved data*/
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 32);
+#endif
+}
+
+#endif
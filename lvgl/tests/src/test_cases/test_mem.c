@@ -165,4 +165,53 @@ void test_memcpy_unaligned(void)
     }
 }
 
+void test_pool_realloc_keeps_data(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL
+    uint8_t * buf = lv_malloc(10);
+    uint32_t i;
+    for(i = 0; i < 10; i++) buf[i] = (uint8_t)i;
+
+    /*Same size class*/
+    TEST_ASSERT_EQUAL_PTR(buf, lv_realloc(buf, 16));
+
+    /*Larger class, then a large block and back*/
+    buf = lv_realloc(buf, 200);
+    buf = lv_realloc(buf, 100 * 1024);
+    buf = lv_realloc(buf, 200 * 1024);
+    buf = lv_realloc(buf, 20);
+    for(i = 0; i < 10; i++) TEST_ASSERT_EQUAL_UINT8(i, buf[i]);
+
+    lv_free(buf);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
+void test_pool_monitor(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_POOL
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    void * small[100];
+    uint32_t i;
+    for(i = 0; i < 100; i++) small[i] = lv_malloc(24);
+    void * large = lv_malloc(64 * 1024);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_GREATER_OR_EQUAL(mon_start.total_size + 64 * 1024, mon.total_size);
+    TEST_ASSERT_GREATER_THAN(mon_start.used_cnt, mon.used_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(mon.total_size - mon.free_size, mon.max_used);
+
+    lv_free(large);
+    for(i = 0; i < 100; i++) lv_free(small[i]);
+
+    lv_mem_monitor(&mon);
+    /*The large block is given back to the C library, the slabs are kept*/
+    TEST_ASSERT_LESS_THAN(mon_start.total_size + 64 * 1024, mon.total_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
 #endif
@@ -996,6 +996,138 @@ void test_observer_dropdown_value(void)
     TEST_ASSERT_EQUAL(0, lv_subject_get_int(&subject));
 }
 
+void test_observer_batch(void)
+{
+    static lv_subject_t subject;
+    lv_subject_init_int(&subject, 0);
+    lv_subject_add_observer(&subject, observer_basic, NULL);
+    lv_subject_add_observer(&subject, observer_int, NULL);
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_bind_text(label, &subject, NULL);
+    TEST_ASSERT_EQUAL(1, observer_called);
+
+    /*Notified only once with the final value in the next timer handler call*/
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject, 10);
+    lv_subject_set_int(&subject, 20);
+    lv_subject_set_int(&subject, 30);
+    lv_subject_batch_end();
+    TEST_ASSERT_EQUAL(1, observer_called);
+    TEST_ASSERT_EQUAL_STRING("0", lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_INT32(30, lv_subject_get_int(&subject));
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(2, observer_called);
+    TEST_ASSERT_EQUAL_INT32(0, prev_v);
+    TEST_ASSERT_EQUAL_INT32(30, current_v);
+    TEST_ASSERT_EQUAL_STRING("30", lv_label_get_text(label));
+
+    /*Changed back to the original value, nothing to notify*/
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject, 40);
+    lv_subject_set_int(&subject, 30);
+    lv_subject_batch_end();
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(2, observer_called);
+
+    /*Not notified until the outer batch is closed*/
+    lv_subject_batch_begin();
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject, 50);
+    lv_subject_batch_end();
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(2, observer_called);
+    lv_subject_batch_end();
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(3, observer_called);
+
+    /*A deleted Subject shouldn't be notified*/
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject, 60);
+    lv_subject_batch_end();
+    lv_subject_deinit(&subject);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(3, observer_called);
+}
+
+void test_observer_batch_group(void)
+{
+    static lv_subject_t subject_main;
+    static lv_subject_t subject_sub1;
+    static lv_subject_t subject_sub2;
+    static lv_subject_t * subject_list[2] = { &subject_sub1, &subject_sub2 };
+
+    lv_subject_init_int(&subject_sub1, 1);
+    lv_subject_init_int(&subject_sub2, 2);
+    lv_subject_init_group(&subject_main, subject_list, 2);
+
+    group_observer_called = 0;
+    lv_subject_add_observer(&subject_main, group_observer_cb, NULL);
+    TEST_ASSERT_EQUAL(1, group_observer_called);
+
+    /*The group is notified once after both elements*/
+    lv_subject_batch_begin();
+    lv_subject_set_int(&subject_sub1, 10);
+    lv_subject_set_int(&subject_sub2, 20);
+    lv_subject_set_int(&subject_sub1, 11);
+    lv_subject_batch_end();
+    lv_subject_notify_pending();
+    TEST_ASSERT_EQUAL(2, group_observer_called);
+
+    lv_subject_deinit(&subject_main);
+    lv_subject_deinit(&subject_sub1);
+    lv_subject_deinit(&subject_sub2);
+}
+
+static lv_subject_t subject_rpm;
+static lv_subject_t subject_zone;
+static uint32_t zone_observer_called;
+
+static void rpm_to_zone_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
+{
+    LV_UNUSED(observer);
+    lv_subject_set_int(&subject_zone, lv_subject_get_int(subject) > 6000 ? 2 : 1);
+}
+
+static void zone_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
+{
+    LV_UNUSED(observer);
+    LV_UNUSED(subject);
+    zone_observer_called++;
+}
+
+void test_observer_deferred(void)
+{
+    lv_subject_init_int(&subject_rpm, 1000);
+    lv_subject_init_int(&subject_zone, 0);
+    lv_subject_set_deferred(&subject_rpm, true);
+    lv_subject_set_deferred(&subject_zone, true);
+    lv_subject_add_observer(&subject_rpm, rpm_to_zone_observer_cb, NULL);
+    lv_subject_add_observer(&subject_zone, zone_observer_cb, NULL);
+    lv_subject_notify_pending();
+    zone_observer_called = 0;
+
+    /*The dependent Subject settles in the same timer handler call*/
+    lv_subject_set_int(&subject_rpm, 5000);
+    lv_subject_set_int(&subject_rpm, 7000);
+    lv_subject_set_int(&subject_rpm, 6500);
+    TEST_ASSERT_EQUAL(0, zone_observer_called);
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(1, zone_observer_called);
+    TEST_ASSERT_EQUAL_INT32(2, lv_subject_get_int(&subject_zone));
+
+    /*Immediate notification again*/
+    lv_subject_set_deferred(&subject_rpm, false);
+    lv_subject_set_deferred(&subject_zone, false);
+    lv_subject_set_int(&subject_rpm, 3000);
+    TEST_ASSERT_EQUAL(2, zone_observer_called);
+    TEST_ASSERT_EQUAL_INT32(1, lv_subject_get_int(&subject_zone));
+
+    lv_subject_deinit(&subject_rpm);
+    lv_subject_deinit(&subject_zone);
+}
+
 void test_observer_deinit(void)
 {
     static lv_subject_t subject;
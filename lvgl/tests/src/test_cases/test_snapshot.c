@@ -92,6 +92,9 @@ void test_snapshot_with_transform_should_not_leak_memory(void)
         lv_draw_buf_destroy(snapshots[idx]);
     }
 
+    /*The buffers of the transformed layers are kept for reuse*/
+    lv_draw_buf_pool_flush();
+
     lv_mem_monitor(&monitor);
     final_available_memory = monitor.free_size;
     lv_obj_delete(label);
@@ -226,4 +226,131 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+void test_style_resolved_value_follows_changes(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_text_color(&style, lv_color_hex(0x112233));
+
+    lv_obj_t * parent1 = lv_obj_create(lv_screen_active());
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_t * label = lv_label_create(parent1);
+
+    /*Inherited from the parent*/
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0xff0000), LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0x00ff00), LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*New parent*/
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x0000ff), LV_PART_MAIN);
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*Inherited from the parent's new state*/
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0xffff00), LV_STATE_CHECKED);
+    lv_obj_add_state(parent2, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xffff00), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+    lv_obj_remove_state(parent2, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*Shared style changed and reported*/
+    lv_obj_add_style(label, &style, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x112233), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+    lv_style_set_text_color(&style, lv_color_hex(0x445566));
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x445566), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*Disabled style and removed local property*/
+    lv_obj_set_style_text_color(label, lv_color_hex(0x778899), LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x778899), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+    lv_obj_remove_local_style_prop(label, LV_STYLE_TEXT_COLOR, LV_PART_MAIN);
+    lv_obj_style_set_disabled(label, &style, LV_PART_MAIN, true);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    lv_obj_delete(parent1);
+    lv_obj_delete(parent2);
+    lv_style_reset(&style);
+}
+
+static void style_changed_event_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+void test_style_set_same_local_value_is_noop(void)
+{
+    uint32_t cnt = 0;
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(obj, style_changed_event_cb, LV_EVENT_STYLE_CHANGED, &cnt);
+
+    lv_obj_set_style_width(obj, 50, LV_PART_MAIN);
+    lv_obj_set_style_pad_left(obj, 7, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(2, cnt);
+
+    lv_obj_set_style_width(obj, 50, LV_PART_MAIN);
+    lv_obj_set_style_pad_left(obj, 7, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(2, cnt);
+
+    lv_obj_set_style_pad_left(obj, 8, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(3, cnt);
+    TEST_ASSERT_EQUAL(8, lv_obj_get_style_pad_left(obj, LV_PART_MAIN));
+}
+
+#if LV_OBJ_LOCAL_STYLE_INTERN
+static const lv_style_t * get_local_style(lv_obj_t * obj)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(obj->styles[i].is_local) return obj->styles[i].style;
+    }
+    return NULL;
+}
+#endif
+
+void test_style_local_styles_are_shared(void)
+{
+#if LV_OBJ_LOCAL_STYLE_INTERN
+    lv_obj_clean(lv_screen_active());
+    uint32_t cnt_start = lv_style_intern_get_count();
+
+    lv_obj_t * objs[10];
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        objs[i] = lv_obj_create(lv_screen_active());
+        lv_obj_set_style_bg_color(objs[i], lv_color_hex(0x123456), LV_PART_MAIN);
+        lv_obj_set_style_radius(objs[i], 7, LV_PART_MAIN);
+    }
+
+    /*Only {bg_color, radius} is used, the intermediate {bg_color} is already freed*/
+    TEST_ASSERT_EQUAL(cnt_start + 1, lv_style_intern_get_count());
+    TEST_ASSERT_EQUAL_PTR(get_local_style(objs[0]), get_local_style(objs[9]));
+
+    /*The same properties set in an other order result in the same style*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_radius(obj, 7, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x123456), LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(cnt_start + 1, lv_style_intern_get_count());
+    TEST_ASSERT_EQUAL_PTR(get_local_style(objs[0]), get_local_style(obj));
+
+    /*Changing one widget doesn't affect the others*/
+    lv_obj_set_style_radius(objs[0], 3, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_radius(objs[0], LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(7, lv_obj_get_style_radius(objs[1], LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(cnt_start + 2, lv_style_intern_get_count());
+
+    lv_obj_remove_local_style_prop(objs[1], LV_STYLE_RADIUS, LV_PART_MAIN);
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_obj_get_local_style_prop(objs[1], LV_STYLE_RADIUS, &v, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(7, lv_obj_get_style_radius(objs[2], LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x123456), lv_obj_get_style_bg_color(objs[1], LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(cnt_start + 3, lv_style_intern_get_count());
+
+    /*Unused styles are freed*/
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_EQUAL(cnt_start, lv_style_intern_get_count());
+#endif
+}
+
 #endif
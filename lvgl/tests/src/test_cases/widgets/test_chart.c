@@ -219,6 +219,116 @@ void test_chart_scatter(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_scatter.png");
 }
 
+static void count_line_tasks_cb(lv_event_t * e)
+{
+    lv_draw_task_t * draw_task = lv_event_get_param(e);
+    uint32_t * cnt = lv_event_get_user_data(e);
+    if(lv_draw_task_get_type(draw_task) == LV_DRAW_TASK_TYPE_LINE) (*cnt)++;
+}
+
+void test_chart_scatter_one_line_task_per_series(void)
+{
+    lv_obj_center(chart);
+    lv_obj_set_size(chart, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_line_width(chart, 6, LV_PART_ITEMS);
+    lv_obj_set_style_line_opa(chart, LV_OPA_50, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);
+    lv_chart_set_div_line_count(chart, 0, 0);
+
+    lv_chart_set_type(chart, LV_CHART_TYPE_SCATTER);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_PRIMARY_X, 0, 1000);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_PRIMARY_Y, -1000, 1000);
+
+    lv_chart_set_point_count(chart, 200);
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        /*A spiral and a zigzag to have joints in every direction*/
+        int32_t angle = i * 9;
+        int32_t radius = 50 + i * 2;
+        lv_chart_set_next_value2(chart, ser1, 500 + lv_trigo_cos(angle) * radius / LV_TRIGO_SIN_MAX,
+                                 lv_trigo_sin(angle) * radius * 2 / LV_TRIGO_SIN_MAX);
+        lv_chart_set_next_value2(chart, ser2, i * 5, i % 2 ? 900 : -900);
+    }
+
+    /*Break the zigzag*/
+    lv_chart_set_series_value_by_id2(chart, ser2, 100, 500, LV_CHART_POINT_NONE);
+
+    uint32_t line_task_cnt = 0;
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, count_line_tasks_cb, LV_EVENT_DRAW_TASK_ADDED, &line_task_cnt);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_scatter_polyline.png");
+    TEST_ASSERT_EQUAL_UINT32(2, line_task_cnt);
+}
+
+void test_chart_stream(void)
+{
+    lv_chart_set_point_count(chart, 100);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_chart_push_stream_value(ser, 1));
+
+    /*Rounded up to 64*/
+    lv_chart_set_series_stream(chart, ser, 50);
+    int32_t i;
+    for(i = 0; i < 64; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_chart_push_stream_value(ser, i));
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_chart_push_stream_value(ser, 100));
+
+    /*The values are added only when the chart reads them*/
+    int32_t * y_array = lv_chart_get_series_y_array(chart, ser);
+    TEST_ASSERT_EQUAL_INT32(LV_CHART_POINT_NONE, y_array[0]);
+
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    for(i = 0; i < 64; i++) {
+        TEST_ASSERT_EQUAL_INT32(i, y_array[i]);
+    }
+    TEST_ASSERT_EQUAL_INT32(LV_CHART_POINT_NONE, y_array[64]);
+    TEST_ASSERT_EQUAL_UINT32(64, lv_chart_get_x_start_point(chart, ser));
+
+    /*There is space again and the values continue circularly*/
+    for(i = 0; i < 50; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_chart_push_stream_value(ser, 1000 + i));
+    }
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_EQUAL_INT32(1000, y_array[64]);
+    TEST_ASSERT_EQUAL_INT32(1049, y_array[13]);
+    TEST_ASSERT_EQUAL_INT32(14, y_array[14]);
+
+    lv_chart_set_series_stream(chart, ser, 0);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_chart_push_stream_value(ser, 1));
+}
+
+void test_chart_crowded_line(void)
+{
+    lv_obj_set_size(chart, 400, 300);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 2000);
+    lv_chart_set_axis_range(chart, LV_CHART_AXIS_PRIMARY_Y, -1000, 1000);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t i;
+    for(i = 0; i < 2000; i++) {
+        lv_chart_set_next_value(chart, ser, lv_trigo_sin(i) * 500 / LV_TRIGO_SIN_MAX + (i % 7) * 20);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_crowded.png");
+
+    /*Shift the values with a single peak: only the changed columns are searched again but no peak can be missed*/
+    for(i = 0; i < 300; i++) {
+        lv_chart_set_next_value(chart, ser, i == 150 ? 950 : -200);
+    }
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_crowded_peak.png");
+
+    /*Recalculating all the columns gives the same result*/
+    lv_chart_refresh(chart);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_crowded_peak.png");
+}
+
 void test_chart_properties(void)
 {
 #if LV_USE_OBJ_PROPERTY
@@ -579,6 +579,73 @@ void test_scale_needle_updates_when_style_changes(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/scale_8.png");
 }
 
+static void count_line_tasks_cb(lv_event_t * e)
+{
+    lv_draw_task_t * draw_task = lv_event_get_param(e);
+    uint32_t * cnt = lv_event_get_user_data(e);
+    if(lv_draw_task_get_type(draw_task) == LV_DRAW_TASK_TYPE_LINE) (*cnt)++;
+}
+
+void test_scale_static_cache(void)
+{
+    lv_obj_t * scale = lv_scale_create(lv_screen_active());
+    lv_scale_set_static_cache(scale, true);
+    TEST_ASSERT_TRUE(lv_scale_get_static_cache(scale));
+
+    lv_obj_align(scale, LV_ALIGN_LEFT_MID, 0, 0);
+    lv_obj_set_style_width(scale, 200, LV_PART_MAIN);
+    lv_obj_set_style_height(scale, 200, LV_PART_MAIN);
+
+    lv_scale_set_mode(scale, LV_SCALE_MODE_ROUND_INNER);
+
+    lv_scale_set_range(scale, 0, 100);
+    lv_scale_set_angle_range(scale, 270);
+    lv_scale_set_rotation(scale, 135);
+
+    lv_scale_set_total_tick_count(scale, 20);
+    lv_scale_set_major_tick_every(scale, 5);
+
+    lv_obj_t * needle_line = lv_line_create(scale);
+    lv_obj_set_style_line_width(needle_line, 6, LV_PART_MAIN);
+    lv_obj_set_style_line_rounded(needle_line, true, LV_PART_MAIN);
+    lv_scale_set_line_needle_value(scale, needle_line, 60, 26);
+
+    LV_IMAGE_DECLARE(img_hand);
+    lv_obj_t * needle_img = lv_image_create(scale);
+    lv_image_set_src(needle_img, &img_hand);
+    lv_scale_set_image_needle_value(scale, needle_img, 78);
+    lv_obj_align(needle_img, LV_ALIGN_CENTER, 47, -2);
+    lv_image_set_pivot(needle_img, 3, 4);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/scale_static_cache.png");
+
+    uint32_t line_task_cnt = 0;
+    lv_obj_add_flag(scale, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(scale, count_line_tasks_cb, LV_EVENT_DRAW_TASK_ADDED, &line_task_cnt);
+
+    /*Moving the needles doesn't draw the ticks again*/
+    lv_scale_set_line_needle_value(scale, needle_line, 60, 60);
+    lv_scale_set_image_needle_value(scale, needle_img, 40);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, line_task_cnt);
+
+    /*Changing the properties renders the cache again*/
+    lv_scale_set_total_tick_count(scale, 31);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(31, line_task_cnt);
+
+    line_task_cnt = 0;
+    lv_obj_set_style_line_color(scale, lv_palette_main(LV_PALETTE_RED), LV_PART_ITEMS);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/scale_static_cache_2.png");
+    TEST_ASSERT_EQUAL_UINT32(31, line_task_cnt);
+
+    /*Disabling it draws the ticks directly again*/
+    line_task_cnt = 0;
+    lv_scale_set_static_cache(scale, false);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(31, line_task_cnt);
+}
+
 void test_scale_properties(void)
 {
 #if LV_USE_OBJ_PROPERTY
@@ -0,0 +1,135 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * tv;
+static lv_obj_t * tile1;
+static lv_obj_t * tile2;
+static lv_obj_t * static_label;
+static lv_obj_t * live_label;
+
+void setUp(void)
+{
+    tv = lv_tileview_create(lv_screen_active());
+    tile1 = lv_tileview_add_tile(tv, 0, 0, LV_DIR_RIGHT);
+    tile2 = lv_tileview_add_tile(tv, 1, 0, LV_DIR_LEFT);
+    lv_obj_set_style_bg_color(tile2, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_opa(tile2, LV_OPA_COVER, 0);
+
+    static_label = lv_label_create(tile1);
+    lv_label_set_text(static_label, "Static");
+    lv_obj_align(static_label, LV_ALIGN_CENTER, 0, -40);
+
+    lv_obj_t * cont = lv_obj_create(tile1);
+    lv_obj_set_size(cont, 200, 100);
+    lv_obj_align(cont, LV_ALIGN_CENTER, 0, 40);
+
+    live_label = lv_label_create(cont);
+    lv_label_set_text(live_label, "Live");
+    lv_obj_center(live_label);
+
+    lv_obj_t * label = lv_label_create(tile2);
+    lv_label_set_text(label, "Second tile");
+    lv_obj_center(label);
+
+    lv_obj_update_layout(tv);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_tileview_scroll_snapshot(void)
+{
+#if LV_USE_SNAPSHOT
+    lv_tileview_tile_t * t1 = (lv_tileview_tile_t *)tile1;
+    lv_tileview_tile_t * t2 = (lv_tileview_tile_t *)tile2;
+
+    lv_tileview_set_scroll_snapshot(tv, true);
+    TEST_ASSERT_TRUE(lv_tileview_get_scroll_snapshot(tv));
+    lv_tileview_tile_add_live_widget(tile1, live_label);
+
+    /*Without animation the tiles are not captured*/
+    lv_tileview_set_tile(tv, tile1, LV_ANIM_OFF);
+    TEST_ASSERT_NULL(t1->snapshot);
+
+    lv_tileview_set_tile(tv, tile2, LV_ANIM_ON);
+    TEST_ASSERT_NOT_NULL(t1->snapshot);
+    TEST_ASSERT_NOT_NULL(t2->snapshot);
+
+    /*Only the live widget should be updated during the scrolling*/
+    lv_label_set_text(static_label, "Changed");
+    lv_label_set_text(live_label, "Updated live");
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/tileview_scroll_snapshot_1.png");
+
+    /*Draw the tiles directly again when the scrolling has settled*/
+    lv_test_wait(1000);
+    TEST_ASSERT_NULL(t1->snapshot);
+    TEST_ASSERT_NULL(t2->snapshot);
+    TEST_ASSERT_EQUAL_PTR(tile2, lv_tileview_get_tile_active(tv));
+
+    lv_tileview_set_tile(tv, tile1, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/tileview_scroll_snapshot_2.png");
+#endif
+}
+
+void test_tileview_scroll_snapshot_disable(void)
+{
+#if LV_USE_SNAPSHOT
+    lv_tileview_tile_t * t1 = (lv_tileview_tile_t *)tile1;
+
+    lv_tileview_set_scroll_snapshot(tv, true);
+    lv_tileview_set_tile(tv, tile2, LV_ANIM_ON);
+    TEST_ASSERT_NOT_NULL(t1->snapshot);
+
+    lv_tileview_set_scroll_snapshot(tv, false);
+    TEST_ASSERT_NULL(t1->snapshot);
+
+    lv_test_wait(1000);
+    TEST_ASSERT_EQUAL_PTR(tile2, lv_tileview_get_tile_active(tv));
+#endif
+}
+
+void test_tileview_live_widget_delete(void)
+{
+#if LV_USE_SNAPSHOT
+    lv_obj_clean(lv_screen_active());
+    size_t mem_before = lv_test_get_free_mem();
+
+    tv = lv_tileview_create(lv_screen_active());
+    tile1 = lv_tileview_add_tile(tv, 0, 0, LV_DIR_RIGHT);
+    tile2 = lv_tileview_add_tile(tv, 1, 0, LV_DIR_LEFT);
+    lv_obj_t * label1 = lv_label_create(tile1);
+    lv_obj_t * label2 = lv_label_create(tile1);
+    lv_obj_update_layout(tv);
+
+    lv_tileview_tile_t * t1 = (lv_tileview_tile_t *)tile1;
+    lv_tileview_tile_add_live_widget(tile1, label1);
+    lv_tileview_tile_add_live_widget(tile1, label1);
+    lv_tileview_tile_add_live_widget(tile1, label2);
+    TEST_ASSERT_EQUAL_UINT32(2, t1->live_widget_cnt);
+
+    lv_obj_delete(label1);
+    TEST_ASSERT_EQUAL_UINT32(1, t1->live_widget_cnt);
+    TEST_ASSERT_EQUAL_PTR(label2, t1->live_widgets[0]);
+
+    lv_tileview_tile_remove_live_widget(tile1, label2);
+    TEST_ASSERT_EQUAL_UINT32(0, t1->live_widget_cnt);
+
+    /*The live widget moved to an other parent shouldn't refer to the deleted tile*/
+    lv_tileview_tile_add_live_widget(tile1, label2);
+    lv_tileview_set_scroll_snapshot(tv, true);
+    lv_tileview_set_tile(tv, tile2, LV_ANIM_ON);
+    lv_obj_set_parent(label2, lv_screen_active());
+    lv_obj_delete(tv);
+    lv_obj_delete(label2);
+
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 32);
+#endif
+}
+
+#endif
@@ -0,0 +1,101 @@
+/* Trace driven benchmark of the cache classes: a small hot set (e.g. gauge glyphs and icons)
+ * is used all the time, while long lists are scrolled through now and then*/
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define CACHE_SIZE_BYTES    (32 * 1024)
+#define TRACE_LEN           20000
+#define HOT_CNT             16
+#define SCAN_LEN            300
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    int32_t key;
+} trace_data_t;
+
+static int32_t trace[TRACE_LEN];
+
+static lv_cache_compare_res_t compare_cb(const trace_data_t * lhs, const trace_data_t * rhs)
+{
+    if(lhs->key == rhs->key) return 0;
+    return lhs->key > rhs->key ? 1 : -1;
+}
+
+static void free_cb(trace_data_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+    LV_UNUSED(user_data);
+}
+
+/*Sizes between 256 and 2047 bytes*/
+static uint32_t key_to_size(int32_t key)
+{
+    return 256 + (((uint32_t)key * 2654435761u) >> 21);
+}
+
+void setUp(void)
+{
+    /*Deterministic trace: mostly hot keys, with a scan of never repeated keys every 2000 requests*/
+    uint32_t seed = 1;
+    int32_t scan_key = 1000;
+    uint32_t i;
+    for(i = 0; i < TRACE_LEN; i++) {
+        if(i % 2000 >= 2000 - SCAN_LEN) {
+            trace[i] = scan_key++;
+        }
+        else {
+            seed = seed * 1103515245 + 12345;
+            trace[i] = (int32_t)((seed >> 16) % HOT_CNT);
+        }
+    }
+}
+
+void tearDown(void)
+{
+}
+
+static void replay(lv_cache_t * cache)
+{
+    uint32_t i;
+    for(i = 0; i < TRACE_LEN; i++) {
+        trace_data_t search_key = { .slot.size = key_to_size(trace[i]), .key = trace[i] };
+        lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+        if(entry == NULL) entry = lv_cache_add(cache, &search_key, NULL);
+        if(entry) lv_cache_release(cache, entry, NULL);
+    }
+}
+
+static uint32_t run(const lv_cache_class_t * cache_class, const char * name)
+{
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)free_cb,
+    };
+    lv_cache_t * cache = lv_cache_create(cache_class, sizeof(trace_data_t), CACHE_SIZE_BYTES, ops);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    TEST_ASSERT_MAX_TIME(replay, 100, cache);
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(cache, &stats);
+    TEST_PRINTF("%s: %" LV_PRIu32 " hits, %" LV_PRIu32 " misses, %" LV_PRIu32 " evictions",
+                name, stats.hit_cnt, stats.miss_cnt, stats.evict_cnt);
+
+    lv_cache_destroy(cache, NULL);
+    return stats.hit_cnt;
+}
+
+void test_cache_trace_2q_vs_lru(void)
+{
+    uint32_t lru_rb_hits = run(&lv_cache_class_lru_rb_size, "lru_rb_size");
+    uint32_t lru_ll_hits = run(&lv_cache_class_lru_ll_size, "lru_ll_size");
+    uint32_t q2_hits = run(&lv_cache_class_2q_size, "2q_size");
+
+    TEST_ASSERT_GREATER_THAN(lru_rb_hits, q2_hits);
+    TEST_ASSERT_GREATER_THAN(lru_ll_hits, q2_hits);
+}
+
+#endif
@@ -0,0 +1,84 @@
+/* Stress benchmark for the configured `lv_malloc` implementation.
+ * Build the perf tests with `LV_USE_STDLIB_MALLOC` set to `LV_STDLIB_BUILTIN` (TLSF) or `LV_STDLIB_POOL`
+ * to compare them. The same workload is run with the C library's malloc as a reference. */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SLOT_CNT    1024
+#define ITER_CNT    500000
+
+typedef void * (*alloc_cb_t)(size_t size);
+typedef void (*free_cb_t)(void * p);
+
+static void * slots[SLOT_CNT];
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/**
+ * Get the size of the next allocation like the typical LVGL usage:
+ * mostly small objects (styles, draw tasks, label texts, cache entries)
+ * and sometimes large buffers (layers, decoded images).
+ */
+static size_t get_next_size(uint32_t * seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    uint32_t r = (*seed >> 8) & 0xffff;
+    if(r < 45000) return 8 + (r % 120);             /*~69% up to 128 bytes*/
+    if(r < 63000) return 128 + (r % 1920);          /*~27% up to 2 kB*/
+    return 4 * 1024 + (r % 60) * 1024;              /*~4% up to 64 kB*/
+}
+
+static void churn(alloc_cb_t alloc_cb, free_cb_t free_cb)
+{
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < ITER_CNT; i++) {
+        uint32_t idx = (seed >> 4) % SLOT_CNT;
+        free_cb(slots[idx]);
+        slots[idx] = alloc_cb(get_next_size(&seed));
+        TEST_ASSERT_NOT_NULL(slots[idx]);
+        /*Touch the memory like a real user would*/
+        *(uint8_t *)slots[idx] = (uint8_t)i;
+    }
+
+    for(i = 0; i < SLOT_CNT; i++) {
+        free_cb(slots[i]);
+        slots[i] = NULL;
+    }
+}
+
+static double run(alloc_cb_t alloc_cb, free_cb_t free_cb)
+{
+    clock_t t = clock();
+    churn(alloc_cb, free_cb);
+    return ((double)(clock() - t) * 1000.) / CLOCKS_PER_SEC;
+}
+
+void test_mem_churn(void)
+{
+    double clib_ms = run(malloc, free);
+
+    lv_mem_monitor_t mon_before;
+    lv_mem_monitor(&mon_before);
+
+    double lv_ms = run(lv_malloc, lv_free);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("lv_malloc: %.1f ms, malloc: %.1f ms, %d iterations\n", lv_ms, clib_ms, ITER_CNT);
+    printf("total: %zu, max used: %zu, free: %zu, frag: %d %%\n",
+           mon.total_size, mon.max_used, mon.free_size, mon.frag_pct);
+
+    TEST_ASSERT_EQUAL(mon_before.used_cnt, mon.used_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_DOUBLE(clib_ms * 3 + 100, lv_ms);
+}
+
+#endif
@@ -0,0 +1,51 @@
+/* Performance test for resolving style properties while redrawing many widgets */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define LABEL_CNT   1000
+
+static lv_obj_t * active_screen = NULL;
+static lv_style_t style;
+
+static void redraw_all(lv_obj_t * scr)
+{
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+}
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+
+    lv_style_init(&style);
+    lv_style_set_text_color(&style, lv_palette_main(LV_PALETTE_BLUE));
+    lv_style_set_bg_color(&style, lv_palette_lighten(LV_PALETTE_GREY, 3));
+    lv_style_set_bg_opa(&style, LV_OPA_COVER);
+    lv_style_set_border_width(&style, 1);
+    lv_style_set_radius(&style, 4);
+    lv_style_set_pad_all(&style, 2);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+    lv_style_reset(&style);
+}
+
+void test_style_redraw_many_labels(void)
+{
+    uint32_t i;
+    for(i = 0; i < LABEL_CNT; i++) {
+        lv_obj_t * label = lv_label_create(active_screen);
+        lv_obj_add_style(label, &style, 0);
+        lv_obj_set_style_text_color(label, lv_palette_main(i % 2 ? LV_PALETTE_RED : LV_PALETTE_GREEN), 0);
+        lv_label_set_text_fmt(label, "%" LV_PRIu32, i);
+        lv_obj_set_pos(label, (i % 25) * 32, (i / 25) * 12);
+    }
+
+    /*The first refresh fills the caches*/
+    redraw_all(active_screen);
+
+    TEST_ASSERT_MAX_TIME_ITER(redraw_all, 500, 10, active_screen);
+}
+#endif
@@ -57,6 +57,8 @@ static void create_top_panel(view_components_t *components, lv_obj_t *parent)
     lv_obj_set_style_border_width(top_panel, 1, 0);
     lv_obj_align(top_panel, LV_ALIGN_TOP_MID, 0, 0);
     lv_obj_clear_flag(top_panel, LV_OBJ_FLAG_SCROLLABLE);
+    // Changes only when a label is updated, reuse its rendered bitmap otherwise
+    lv_obj_add_flag(top_panel, LV_OBJ_FLAG_CACHE_LAYER);
 
     // ODO (Left)
     components->odo_label = lv_label_create(top_panel);
@@ -259,6 +261,7 @@ static void create_music_player(view_components_t *components, lv_obj_t *parent)
     lv_obj_align(art_box, LV_ALIGN_TOP_MID, 0, 15);
     lv_obj_set_style_bg_color(art_box, lv_color_hex(0x333333), 0);
     lv_obj_set_style_border_width(art_box, 0, 0);
+    lv_obj_add_flag(art_box, LV_OBJ_FLAG_CACHE_LAYER);
     
     lv_obj_t * icon = lv_label_create(art_box);
     lv_label_set_text(icon, LV_SYMBOL_AUDIO);
@@ -370,6 +373,7 @@ static void create_navigation_card(view_components_t *components, lv_obj_t *pare
     lv_obj_set_style_radius(nav_cont, 15, 0);
     lv_obj_set_style_border_width(nav_cont, 0, 0);
     lv_obj_clear_flag(nav_cont, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(nav_cont, LV_OBJ_FLAG_CACHE_LAYER);
 
     // 2. Header
     lv_obj_t * header = lv_label_create(nav_cont);
@@ -427,6 +431,9 @@ void view_init(view_components_t *components)
 
     lv_obj_t * tile_drive = lv_tileview_add_tile(tileview, 0, 0, LV_DIR_RIGHT);
     lv_obj_t * tile_music = lv_tileview_add_tile(tileview, 1, 0, LV_DIR_LEFT);
+    components->tileview = tileview;
+    components->tile_gauges = tile_drive;
+    components->tile_music = tile_music;
     
     // 3. GLOBAL ELEMENTS (Top Panel + Alerts)
     create_top_panel(components, root_wrapper);
@@ -440,6 +447,16 @@ void view_init(view_components_t *components)
     create_temp_display(components, tile_drive);
     create_turn_signals(components, tile_drive);
 
+#if LV_USE_SNAPSHOT
+    // Swipe between the pages using snapshots, but keep the live values and the turn signals updating
+    lv_tileview_set_scroll_snapshot(tileview, true);
+    lv_tileview_tile_add_live_widget(tile_drive, components->speed_label);
+    lv_tileview_tile_add_live_widget(tile_drive, components->gear_label);
+    lv_tileview_tile_add_live_widget(tile_drive, components->rpm_label);
+    lv_tileview_tile_add_live_widget(tile_drive, components->left_turn_signal);
+    lv_tileview_tile_add_live_widget(tile_drive, components->right_turn_signal);
+#endif
+
     // 5. POPULATE PAGE 2: MUSIC/NAV (Attached to tile_music)
     create_music_player(components, tile_music);     
     create_navigation_card(components, tile_music);  